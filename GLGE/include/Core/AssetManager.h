@@ -25,6 +25,18 @@
 //add the profiler
 #include "Profiler.h"
 
+//add tiny jobs for parallel prefetching
+#define TINY_JOBS_NO_FIBERS
+#define TINY_JOBS_NO_LOCKFREE
+#include "dependencies/TinyJobs.h"
+//for load timings
+#include <chrono>
+//for stable dependency graph nodes
+#include <deque>
+#include <memory>
+//for error messages of embedded dependencies
+#include <sstream>
+
 //use the library namespace
 namespace GLGE {
 
@@ -45,6 +57,13 @@ namespace GLGE {
          */
         AssetManager() = default;
 
+        /**
+         * @brief Destroy the Asset Manager
+         * 
+         * Waits until no dependency is queued on or loaded by the employer anymore, as those tasks point into the manager. 
+         */
+        ~AssetManager();
+
         /**
          * @brief load a new asset
          * 
@@ -58,23 +77,16 @@ namespace GLGE {
         AssetHandle<T> load(const std::filesystem::path& from, u32 format = 0) {
             GLGE_PROFILER_SCOPE();
             constexpr u64 type_hash = getTypeHash64<T>();
-            //check if the type exists
-            auto it = m_typeStorage.find(type_hash);
-            //if the element does not exist, add it
-            if (it == m_typeStorage.end()) {
-                //lock and re-check (to avoid race condition)
-                std::unique_lock lock(m_typeLock);
-                it = m_typeStorage.find(type_hash);
-                if (it == m_typeStorage.end()) {
-                    m_typeStorage.insert_or_assign(type_hash, static_cast<void*>(new TypeStorage<T>{}));
-                    it = m_typeStorage.find(type_hash);
-                }
-            }
-            TypeStorage<T>* storage = static_cast<TypeStorage<T>*>(it->second);
+            TypeStorage<T>* storage = __getStorage<T>();
             //create the assets
             T* ass = new T();
             ass->__make_valid(type_hash);
-            ass->import_from(this, from, format);
+            try {
+                ass->import_from(this, from, format);
+            } catch (...) {
+                delete ass;
+                throw;
+            }
             UUID uuid = ass->getUUID();
             {
                 //make sure to obtain a lock
@@ -104,20 +116,17 @@ namespace GLGE {
         AssetHandle<T> load(const std::vector<u8>& data) {
             GLGE_PROFILER_SCOPE();
             constexpr u64 type_hash = getTypeHash64<T>();
-            //check if the type exists
-            auto it = m_typeStorage.find(type_hash);
-            //if the element does not exist, add it
-            if (it == m_typeStorage.end()) {
-                //lock and re-check (to avoid race condition)
-                std::unique_lock lock(m_typeLock);
-                it = m_typeStorage.find(type_hash);
-                if (it == m_typeStorage.end()) {
-                    m_typeStorage.insert_or_assign(type_hash, static_cast<void*>(new TypeStorage<T>{}));
-                    it = m_typeStorage.find(type_hash);
-                }
+            TypeStorage<T>* storage = __getStorage<T>();
+            //decode the asset outside of the storage lock so multiple assets of the same type can be decoded in parallel
+            T* ass = new T();
+            ass->__make_valid(type_hash);
+            try {
+                ass->load(this, data);
+            } catch (...) {
+                delete ass;
+                throw;
             }
-            TypeStorage<T>* storage = static_cast<TypeStorage<T>*>(it->second);
-            UUID uuid;
+            UUID uuid = ass->getUUID();
             {
                 //make sure to obtain a lock
                 std::unique_lock lock(storage->mtx);
@@ -125,10 +134,7 @@ namespace GLGE {
                 //now safe to work on the data
 
                 //add the new element to the back
-                storage->assets.push_back(new T());
-                storage->assets.back()->__make_valid(type_hash);
-                storage->assets.back()->load(this, data);
-                uuid = storage->assets.back()->getUUID();
+                storage->assets.push_back(ass);
                 storage->uuid_to_index.insert_or_assign(uuid, storage->assets.size()-1);
             }
 
@@ -162,6 +168,238 @@ namespace GLGE {
             return m_typeStorage.find(getTypeHash64<T>()) != m_typeStorage.end();
         }
 
+        /**
+         * @brief a summary of the dependency closure of an asset
+         */
+        struct DependencyReport {
+            /**
+             * @brief the chain of assets with the longest summed load time, starting at the root
+             * 
+             * Even with infinite threads a load of the root can't finish faster than the load time of this chain. 
+             */
+            std::vector<std::filesystem::path> criticalPath;
+            /**
+             * @brief the summed load time of all assets on the critical path
+             */
+            std::chrono::nanoseconds criticalPathTime{0};
+            /**
+             * @brief the summed load time of all assets in the closure (the time a serial load would take)
+             */
+            std::chrono::nanoseconds serialTime{0};
+            /**
+             * @brief the wall time of the last `loadWithDependencies` call for the root (0 if never loaded that way)
+             */
+            std::chrono::nanoseconds wallTime{0};
+            /**
+             * @brief the amount of assets in the closure, including the root
+             */
+            size_t assetCount = 0;
+        };
+
+        /**
+         * @brief Set the employer used to prefetch dependencies
+         * 
+         * Without an employer dependencies are still tracked, but only loaded on the thread that requires them. 
+         * 
+         * @param employer a pointer to the employer to use or `nullptr` to disable parallel prefetching
+         */
+        inline void setEmployer(Tiny::Jobs::Employer* employer) noexcept
+        {m_employer = employer;}
+
+        /**
+         * @brief declare that the asset that is currently loaded on this thread depends on another asset
+         * 
+         * This should be called by assets as early as possible during `load` / `import_from` (e.g. directly after parsing a header). 
+         * It records the edge in the dependency graph and immediately queues the dependency on the employer, so it is 
+         * loaded in parallel to the rest of the current asset. Use `require` to get the loaded dependency later. 
+         * 
+         * @tparam T the type of the dependency
+         * @param path the path to the dependency
+         * @param format the format of the dependency
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        void declareDependency(const std::filesystem::path& path, u32 format = 0) {
+            GLGE_PROFILER_SCOPE();
+            DependencyNode* node = __getDependencyNode<T>(path, format);
+            __addDependencyEdge(node);
+            __scheduleDependency(node);
+        }
+
+        /**
+         * @brief declare that the asset that is currently loaded on this thread embeds another asset
+         * 
+         * Works like `declareDependency`, but the dependency is loaded from raw data (e.g. an entry of a compound asset) 
+         * instead of a file. The path only names the asset in the dependency graph, it should be derived from the path 
+         * returned by `claimDependencyPath`. Use `requireEmbedded` to get the loaded dependency later. 
+         * 
+         * @tparam T the type of the dependency
+         * @param path the name of the dependency in the dependency graph
+         * @param data the raw data to load the dependency from
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        void declareEmbeddedDependency(const std::filesystem::path& path, std::vector<u8>&& data) {
+            GLGE_PROFILER_SCOPE();
+            DependencyNode* node = __getDependencyNode<T>(path, 0, true);
+            {
+                //a loaded node keeps its asset, the data is only needed until the next load
+                std::unique_lock lock(m_dependencyMtx);
+                u8 state = node->state.load(std::memory_order_acquire);
+                if (state == DEPENDENCY_IDLE || state == DEPENDENCY_QUEUED) {node->data = std::move(data);}
+            }
+            __addDependencyEdge(node);
+            __scheduleDependency(node);
+        }
+
+        /**
+         * @brief get an embedded dependency of the asset that is currently loaded on this thread
+         * 
+         * @throws `GLGE::Exception` if the dependency failed to load or was never declared using `declareEmbeddedDependency`
+         * 
+         * @tparam T the type of the dependency
+         * @param path the name of the dependency in the dependency graph
+         * @return `AssetHandle<T>` a handle to the loaded dependency
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        AssetHandle<T> requireEmbedded(const std::filesystem::path& path) {
+            GLGE_PROFILER_SCOPE();
+            DependencyNode* node = __getDependencyNode<T>(path, 0, true);
+            __addDependencyEdge(node);
+            __resolveDependency(node);
+            return node->handle.template getTyped<T>();
+        }
+
+        /**
+         * @brief get the path of the asset that is currently loaded through the dependency graph on this thread
+         * 
+         * Assets that embed other assets use it to name them in the dependency graph. Only the first call during the load 
+         * of an asset returns the path, so assets that are loaded directly while it loads don't name their embedded assets 
+         * after it. 
+         * 
+         * @return `std::filesystem::path` the path of the asset or an empty path if the thread does not load an asset of 
+         *         this manager through the dependency graph or the path was allready claimed
+         */
+        std::filesystem::path claimDependencyPath();
+
+        /**
+         * @brief get a dependency of the asset that is currently loaded on this thread
+         * 
+         * If the dependency was already prefetched the prefetched asset is returned. If it is queued but not yet running, 
+         * the dependency is loaded on the calling thread, so waiting never blocks a worker on queued work. 
+         * 
+         * @throws `GLGE::Exception` if the dependency failed to load or if a cyclic dependency is detected
+         * 
+         * @tparam T the type of the dependency
+         * @param path the path to the dependency
+         * @param format the format of the dependency
+         * @return `AssetHandle<T>` a handle to the loaded dependency
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        AssetHandle<T> require(const std::filesystem::path& path, u32 format = 0) {
+            GLGE_PROFILER_SCOPE();
+            DependencyNode* node = __getDependencyNode<T>(path, format);
+            __addDependencyEdge(node);
+            __resolveDependency(node);
+            return node->handle.template getTyped<T>();
+        }
+
+        /**
+         * @brief start loading an asset and its whole known dependency closure in the background
+         * 
+         * Dependencies that were recorded during earlier loads of the asset are queued immediately, so the whole closure is 
+         * loaded in parallel instead of waiting for each parent to discover its children. 
+         * 
+         * @tparam T the type of the root asset
+         * @param path the path to the root asset
+         * @param format the format of the root asset
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        void prefetch(const std::filesystem::path& path, u32 format = 0) {
+            GLGE_PROFILER_SCOPE();
+            DependencyNode* root = __getDependencyNode<T>(path, format);
+            for (DependencyNode* node : __collectClosure(root)) {
+                //embedded assets are queued by the asset that contains them, only that one has their data
+                if (!node->embedded) {__scheduleDependency(node);}
+            }
+        }
+
+        /**
+         * @brief load an asset and wait until its whole dependency closure is loaded
+         * 
+         * The calling thread helps loading queued dependencies while it waits. 
+         * 
+         * @throws `GLGE::Exception` if the root or one of its dependencies failed to load
+         * 
+         * @tparam T the type of the root asset
+         * @param path the path to the root asset
+         * @param format the format of the root asset
+         * @return `AssetHandle<T>` a handle to the loaded root asset
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        AssetHandle<T> loadWithDependencies(const std::filesystem::path& path, u32 format = 0) {
+            GLGE_PROFILER_SCOPE();
+            auto start = std::chrono::steady_clock::now();
+            DependencyNode* root = __getDependencyNode<T>(path, format);
+            prefetch<T>(path, format);
+            //the root may discover new dependencies while loading, so collect the closure afterwards
+            __resolveDependency(root);
+            for (DependencyNode* node : __collectClosure(root))
+            {__resolveDependency(node);}
+            root->wallTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            return root->handle.template getTyped<T>();
+        }
+
+        /**
+         * @brief load an asset and its whole dependency closure as a task on the employer
+         * 
+         * The returned task can be awaited by a coroutine (`co_await assets.loadAsync<T>(path)`), the result is an 
+         * `AssetHandle<T>` to the loaded root asset. If loading failed, the task failed with the exception of the load. 
+         * 
+         * @throws `GLGE::Exception` if no employer is set
+         * 
+         * @tparam T the type of the root asset
+         * @param path the path to the root asset
+         * @param format the format of the root asset
+         * @return `Tiny::Jobs::SharedTask` the task that loads the asset
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        Tiny::Jobs::SharedTask loadAsync(const std::filesystem::path& path, u32 format = 0) {
+            GLGE_PROFILER_SCOPE();
+            if (!m_employer)
+            {throw Exception("Can not load an asset asynchronously without an employer", "GLGE::AssetManager::loadAsync");}
+            return m_employer->async([this, path, format]() {return loadWithDependencies<T>(path, format);});
+        }
+
+        /**
+         * @brief compute the dependency report for an asset
+         * 
+         * The report uses the load times measured during the last load of each asset in the closure. 
+         * 
+         * @tparam T the type of the root asset
+         * @param path the path to the root asset
+         * @param format the format of the root asset
+         * @return `DependencyReport` the report of the closure
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T> && std::is_default_constructible_v<T>
+        DependencyReport getDependencyReport(const std::filesystem::path& path, u32 format = 0)
+        {return __buildDependencyReport(__getDependencyNode<T>(path, format));}
+
+        /**
+         * @brief drop the handles the dependency graph holds to prefetched assets
+         * 
+         * The recorded graph stays intact, so a later `prefetch` still loads the whole closure in parallel. 
+         * 
+         * @warning must not be called while assets are loaded through the dependency graph
+         */
+        void releasePrefetchedAssets();
+
     protected:
 
         //asset handles are friends
@@ -197,6 +435,247 @@ namespace GLGE {
 
         };
 
+        /**
+         * @brief get the storage for a specific type, creating it if it does not exist
+         * 
+         * @tparam T the type to get the storage for
+         * @return `TypeStorage<T>*` a pointer to the storage of the type
+         */
+        template <typename T>
+        TypeStorage<T>* __getStorage() {
+            constexpr u64 type_hash = getTypeHash64<T>();
+            {
+                //fast path: the type is already known
+                std::shared_lock lock(m_typeLock);
+                auto it = m_typeStorage.find(type_hash);
+                if (it != m_typeStorage.end())
+                {return static_cast<TypeStorage<T>*>(it->second);}
+            }
+            //lock and re-check (to avoid race condition)
+            std::unique_lock lock(m_typeLock);
+            auto it = m_typeStorage.find(type_hash);
+            if (it == m_typeStorage.end())
+            {it = m_typeStorage.insert_or_assign(type_hash, static_cast<void*>(new TypeStorage<T>{})).first;}
+            return static_cast<TypeStorage<T>*>(it->second);
+        }
+
+        /**
+         * @brief the load state of a node in the dependency graph
+         */
+        enum DependencyState : u8 {
+            /**
+             * @brief the asset is not loaded and not queued
+             */
+            DEPENDENCY_IDLE = 0,
+            /**
+             * @brief the asset is queued for loading, but nobody started it yet
+             */
+            DEPENDENCY_QUEUED,
+            /**
+             * @brief a thread is currently loading the asset
+             */
+            DEPENDENCY_LOADING,
+            /**
+             * @brief the asset is loaded
+             */
+            DEPENDENCY_DONE,
+            /**
+             * @brief loading the asset failed
+             */
+            DEPENDENCY_FAILED
+        };
+
+        /**
+         * @brief a single asset in the dependency graph
+         */
+        struct DependencyNode {
+            /**
+             * @brief the path of the asset
+             */
+            std::filesystem::path path;
+            /**
+             * @brief the format of the asset
+             */
+            u32 format = 0;
+            /**
+             * @brief a type-erased function that loads the asset into the handle of the node
+             */
+            void (*loadFn)(AssetManager*, DependencyNode&) = nullptr;
+            /**
+             * @brief `true` if the asset is embedded in another asset and loaded from `data` instead of the path
+             */
+            bool embedded = false;
+            /**
+             * @brief the raw data of an embedded asset until it is loaded (guarded by `m_dependencyMtx`)
+             */
+            std::vector<u8> data;
+            /**
+             * @brief the direct dependencies of the asset (guarded by `m_dependencyMtx`)
+             */
+            std::vector<DependencyNode*> dependencies;
+            /**
+             * @brief the load state of the asset
+             */
+            std::atomic<u8> state{DEPENDENCY_IDLE};
+            /**
+             * @brief a handle to the loaded asset (valid once the state is `DEPENDENCY_DONE`)
+             */
+            UntypedAssetHandle handle;
+            /**
+             * @brief the error message if loading failed
+             */
+            std::string error;
+            /**
+             * @brief the time spent loading this asset itself, excluding the time spent waiting for dependencies
+             */
+            std::chrono::nanoseconds loadTime{0};
+            /**
+             * @brief the wall time of the last `loadWithDependencies` call with this node as root
+             */
+            std::chrono::nanoseconds wallTime{0};
+            /**
+             * @brief the task used to load the asset on the employer
+             * 
+             * It is created once and lives as long as the node, a queued task may run long after the asset was loaded 
+             * on another thread. 
+             */
+            std::unique_ptr<Tiny::Jobs::Task> task;
+            /**
+             * @brief the task node used to queue the task
+             */
+            Tiny::Jobs::Job::TaskNode taskNode;
+            /**
+             * @brief `true` while the task node is queued on the employer or runs, it must not be queued twice
+             */
+            std::atomic_bool queued{false};
+            /**
+             * @brief the asset manager the node belongs to
+             */
+            AssetManager* manager = nullptr;
+            /**
+             * @brief the thread that loads the asset, `nullptr` if nobody does (guarded by `m_dependencyMtx`)
+             */
+            const void* loader = nullptr;
+        };
+
+        /**
+         * @brief get the node for a specific asset, creating it if it does not exist
+         * 
+         * @tparam T the type of the asset
+         * @param path the path to the asset
+         * @param format the format of the asset
+         * @param embedded `true` if the asset is loaded from raw data declared by the asset that contains it
+         * @return `DependencyNode*` a stable pointer to the node
+         */
+        template <typename T>
+        DependencyNode* __getDependencyNode(const std::filesystem::path& path, u32 format, bool embedded = false) {
+            //the key combines type, format and the normalized path, embedded assets never share a node with files
+            std::string key = std::to_string(getTypeHash64<T>()) + (embedded ? ":embedded:" : ":") + std::to_string(format) + ":" + path.lexically_normal().generic_string();
+            std::unique_lock lock(m_dependencyMtx);
+            auto it = m_dependencyLookup.find(key);
+            if (it != m_dependencyLookup.end())
+            {return it->second;}
+            //create a new node
+            DependencyNode& node = m_dependencyNodes.emplace_back();
+            node.path = path;
+            node.format = format;
+            node.manager = this;
+            node.embedded = embedded;
+            if (embedded) {
+                node.loadFn = [](AssetManager* manager, DependencyNode& node) {
+                    std::vector<u8> data;
+                    {
+                        std::unique_lock lock(manager->m_dependencyMtx);
+                        data.swap(node.data);
+                    }
+                    if (data.empty()) {
+                        std::stringstream stream;
+                        stream << "The embedded asset " << node.path << " was not declared by the asset that contains it";
+                        throw Exception(stream.str(), "GLGE::AssetManager::__getDependencyNode");
+                    }
+                    node.handle = manager->load<T>(data);
+                };
+            } else {
+                node.loadFn = [](AssetManager* manager, DependencyNode& node)
+                {node.handle = manager->load<T>(node.path, node.format);};
+            }
+            m_dependencyLookup.emplace(std::move(key), &node);
+            return &node;
+        }
+
+        /**
+         * @brief record that the asset currently loaded on this thread depends on a node
+         * 
+         * @param dependency the node the current asset depends on
+         */
+        void __addDependencyEdge(DependencyNode* dependency);
+
+        /**
+         * @brief queue a node for loading on the employer if it is idle
+         * 
+         * @param node the node to queue
+         */
+        void __scheduleDependency(DependencyNode* node);
+
+        /**
+         * @brief put the task node of a queued node on the employer unless it is still queued from an earlier load
+         * 
+         * A task node that is still queued loads the node once it runs, so it is never added twice. 
+         * 
+         * @param node the node to queue
+         */
+        void __queueDependency(DependencyNode* node);
+
+        /**
+         * @brief load the asset of a node if it is queued and nobody started it yet
+         * 
+         * @param node the node to load
+         */
+        void __runDependency(DependencyNode* node);
+
+        /**
+         * @brief make sure that the asset of a node is loaded, loading it on this thread if possible
+         * 
+         * @param node the node to resolve
+         */
+        void __resolveDependency(DependencyNode* node);
+
+        /**
+         * @brief wait until another load of a node finished
+         * 
+         * The thread loads the queued dependencies of the node in the meantime, they are needed anyway. 
+         * 
+         * @throws `GLGE::Exception` if the loads of the node and this thread wait for each other
+         * 
+         * @param node the node that is loading
+         */
+        void __awaitDependency(DependencyNode* node);
+
+        /**
+         * @brief check if waiting for a node would wait for this thread, must be called with `m_dependencyMtx` locked
+         * 
+         * @throws `GLGE::Exception` if the chain of waiting loads that starts at the node leads back to this thread
+         * 
+         * @param node the node that is loading
+         */
+        void __checkDependencyCycle(DependencyNode* node);
+
+        /**
+         * @brief collect all nodes reachable from a root, including the root
+         * 
+         * @param root the root of the closure
+         * @return `std::vector<DependencyNode*>` all nodes in the closure
+         */
+        std::vector<DependencyNode*> __collectClosure(DependencyNode* root);
+
+        /**
+         * @brief compute the dependency report for a root node
+         * 
+         * @param root the root node
+         * @return `DependencyReport` the filled out report
+         */
+        DependencyReport __buildDependencyReport(DependencyNode* root);
+
         /**
          * @brief a lock to make the type storage thread safe
          */
@@ -206,6 +685,30 @@ namespace GLGE {
          */
         std::unordered_map<u64, void*> m_typeStorage;
 
+        /**
+         * @brief the employer used for prefetching (may be `nullptr`)
+         */
+        Tiny::Jobs::Employer* m_employer = nullptr;
+        /**
+         * @brief the amount of dependency task nodes that are queued on or run by an employer
+         */
+        std::atomic_size_t m_queuedDependencies{0};
+        /**
+         * @brief protect the dependency graph structure
+         */
+        std::mutex m_dependencyMtx;
+        /**
+         * @brief store all nodes of the dependency graph
+         * 
+         * A deque is used so node pointers stay stable. The nodes are declared after the type storage, so the handles 
+         * they hold are released while the storage still exists. 
+         */
+        std::deque<DependencyNode> m_dependencyNodes;
+        /**
+         * @brief map the key of an asset (type, format and path) to its node
+         */
+        std::unordered_map<std::string, DependencyNode*> m_dependencyLookup;
+
     };
 
 }
@@ -0,0 +1,309 @@
+/**
+ * @file ChunkAllocator.h
+ * @author DM8AT
+ * @brief define an arena backed allocator for the chunk storage of worlds
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//header guard
+#ifndef _GLGE_CORE_CHUNK_ALLOCATOR_
+#define _GLGE_CORE_CHUNK_ALLOCATOR_
+
+//add common stuff
+#include "Common.h"
+//add allocators
+#include <memory>
+//add thread safety
+#include <mutex>
+//add the free lists
+#include <map>
+#include <vector>
+
+/**
+ * @brief use the libraries namespace
+ */
+namespace GLGE {
+
+    /**
+     * @brief a set of large memory blocks that the chunks of worlds are carved from
+     * 
+     * Every column of a world stores all of its chunks in a single buffer. Taking these buffers from a few large blocks
+     * instead of the general heap keeps them on few pages, so iterating a large world needs less TLB entries. The blocks
+     * can be backed by transparent huge pages and can be placed on the NUMA node of the thread that requests them.
+     * 
+     * The arena is thread safe and may be shared by multiple worlds. It must outlive all worlds that use it.
+     */
+    class ChunkArena {
+    public:
+
+        /**
+         * @brief the settings for a chunk arena
+         */
+        struct Settings {
+            /**
+             * @brief the size of a single block in bytes. Larger allocations get a block of their own.
+             */
+            size_t blockSize = 64 * 1024 * 1024;
+            /**
+             * @brief `true` to ask the operating system to back the blocks with huge pages
+             * 
+             * If huge pages are not available, normal pages are used.
+             */
+            bool hugePages = true;
+            /**
+             * @brief `true` to place new blocks on the NUMA node of the thread that requests them
+             * 
+             * This is ignored on systems without NUMA support.
+             */
+            bool numaLocal = true;
+        };
+
+        /**
+         * @brief Construct a new Chunk Arena with the default settings
+         * 
+         * No memory is reserved until the first allocation.
+         */
+        ChunkArena();
+
+        /**
+         * @brief Construct a new Chunk Arena
+         * 
+         * No memory is reserved until the first allocation.
+         * 
+         * @param settings the settings for the arena
+         */
+        ChunkArena(const Settings& settings);
+
+        /**
+         * @brief Destroy the Chunk Arena
+         * 
+         * All blocks are released, no world may use the arena anymore.
+         */
+        ~ChunkArena();
+
+        //the arena owns the blocks
+        ChunkArena(const ChunkArena&) = delete;
+        ChunkArena& operator=(const ChunkArena&) = delete;
+
+        /**
+         * @brief allocate memory from the arena
+         * 
+         * @param size the size of the allocation in bytes
+         * @return `void*` a pointer to the memory, aligned to at least a cache line
+         */
+        void* allocate(size_t size);
+
+        /**
+         * @brief give memory back to the arena
+         * 
+         * @param ptr a pointer returned by `allocate` (`nullptr` is ignored)
+         * @param size the size that was passed to `allocate`
+         */
+        void deallocate(void* ptr, size_t size) noexcept;
+
+        /**
+         * @brief get the amount of memory reserved from the operating system
+         * 
+         * @return `size_t` the size of all blocks in bytes
+         */
+        size_t getReservedBytes() const noexcept;
+
+        /**
+         * @brief get the amount of memory that is handed out
+         * 
+         * @return `size_t` the size of all live allocations in bytes
+         */
+        size_t getUsedBytes() const noexcept;
+
+        /**
+         * @brief get the amount of blocks the arena reserved
+         * 
+         * @return `size_t` the amount of blocks
+         */
+        size_t getBlockCount() const noexcept;
+
+        /**
+         * @brief get the settings of the arena
+         * 
+         * @return `const Settings&` a constant reference to the settings
+         */
+        inline const Settings& getSettings() const noexcept
+        {return m_settings;}
+
+    protected:
+
+        /**
+         * @brief a single block of memory reserved from the operating system
+         */
+        struct Block {
+            /**
+             * @brief the start of the block
+             */
+            u8* data = nullptr;
+            /**
+             * @brief the size of the block in bytes
+             */
+            size_t size = 0;
+            /**
+             * @brief all free ranges of the block, mapped from their offset to their size
+             * 
+             * Neighbouring ranges are always merged.
+             */
+            std::map<size_t, size_t> free;
+            /**
+             * @brief `true` if the block was created for a single large allocation
+             */
+            bool dedicated = false;
+        };
+
+        /**
+         * @brief reserve a new block from the operating system
+         * 
+         * @param size the minimum size of the block in bytes
+         * @return `Block` the new block with a single free range
+         */
+        Block __mapBlock(size_t size);
+
+        /**
+         * @brief give a block back to the operating system
+         * 
+         * @param block the block to release
+         */
+        static void __unmapBlock(Block& block) noexcept;
+
+        /**
+         * @brief take a range from the free list of a block
+         * 
+         * @param block the block to take the range from
+         * @param size the size of the range in bytes
+         * @return `void*` a pointer to the range or `nullptr` if no free range is large enough
+         */
+        static void* __take(Block& block, size_t size) noexcept;
+
+        /**
+         * @brief the settings of the arena
+         */
+        Settings m_settings;
+        /**
+         * @brief all reserved blocks
+         */
+        std::vector<Block> m_blocks;
+        /**
+         * @brief the size of all live allocations in bytes
+         */
+        size_t m_used = 0;
+        /**
+         * @brief a mutex to protect the blocks
+         */
+        mutable std::mutex m_mtx;
+
+    };
+
+    /**
+     * @brief an allocator that takes memory from a chunk arena
+     * 
+     * Without an arena, the allocator behaves exactly like `std::allocator`. It derives from `std::allocator` because
+     * TinyECS requires that of all allocators it is instantiated with.
+     * 
+     * @tparam T the type of element to allocate
+     */
+    template <typename T>
+    class ChunkAllocator : public std::allocator<T> {
+    public:
+
+        //the arena is state, so allocators are not interchangeable
+        using value_type = T;
+        using is_always_equal = std::false_type;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        /**
+         * @brief rebind the allocator to another element type, the arena is kept
+         * 
+         * @tparam U the new element type
+         */
+        template <typename U>
+        struct rebind {using other = ChunkAllocator<U>;};
+
+        /**
+         * @brief Construct a new Chunk Allocator that uses the default heap
+         */
+        ChunkAllocator() noexcept = default;
+
+        /**
+         * @brief Construct a new Chunk Allocator
+         * 
+         * @param arena the arena to allocate from or `nullptr` to use the default heap
+         */
+        ChunkAllocator(ChunkArena* arena) noexcept
+         : m_arena(arena)
+        {}
+
+        /**
+         * @brief Construct a new Chunk Allocator from an allocator for another type
+         * 
+         * @tparam U the element type of the other allocator
+         * @param other the allocator to copy the arena from
+         */
+        template <typename U>
+        ChunkAllocator(const ChunkAllocator<U>& other) noexcept
+         : m_arena(other.getArena())
+        {}
+
+        /**
+         * @brief allocate storage for some elements
+         * 
+         * @param n the amount of elements
+         * @return `T*` a pointer to the uninitialized storage
+         */
+        T* allocate(size_t n) {
+            if (!m_arena) {return std::allocator<T>::allocate(n);}
+            return static_cast<T*>(m_arena->allocate(n * sizeof(T)));
+        }
+
+        /**
+         * @brief free storage allocated by an equal allocator
+         * 
+         * @param ptr a pointer to the storage
+         * @param n the amount of elements that where allocated
+         */
+        void deallocate(T* ptr, size_t n) noexcept {
+            if (!m_arena) {std::allocator<T>::deallocate(ptr, n);}
+            else {m_arena->deallocate(ptr, n * sizeof(T));}
+        }
+
+        /**
+         * @brief get the arena of the allocator
+         * 
+         * @return `ChunkArena*` a pointer to the arena or `nullptr` if the default heap is used
+         */
+        inline ChunkArena* getArena() const noexcept
+        {return m_arena;}
+
+        /**
+         * @brief check if two allocators can free each others memory
+         * 
+         * @tparam U the element type of the other allocator
+         * @param other the other allocator
+         * @return `true` if both use the same arena, `false` otherwise
+         */
+        template <typename U>
+        inline bool operator==(const ChunkAllocator<U>& other) const noexcept
+        {return m_arena == other.getArena();}
+
+    protected:
+
+        /**
+         * @brief the arena to allocate from, `nullptr` for the default heap
+         */
+        ChunkArena* m_arena = nullptr;
+
+    };
+
+}
+
+#endif
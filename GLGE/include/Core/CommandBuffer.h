@@ -0,0 +1,562 @@
+/**
+ * @file CommandBuffer.h
+ * @author DM8AT
+ * @brief define command buffers that record structural changes of a world and apply them later
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//header guard
+#ifndef _GLGE_CORE_COMMAND_BUFFER_
+#define _GLGE_CORE_COMMAND_BUFFER_
+
+//add common stuff
+#include "Common.h"
+//add objects and worlds
+#include "Object.h"
+//add atomics and threads for the per-thread recorders
+#include <atomic>
+#include <thread>
+#include <memory>
+
+/**
+ * @brief use the libraries namespace
+ */
+namespace GLGE {
+
+    /**
+     * @brief record structural changes of a world (creating and destroying objects, adding and removing components and
+     * re-parenting) and apply them later
+     * 
+     * Structural changes are not allowed while the world is iterated in parallel. Instead, they are recorded into a command
+     * buffer from inside the iteration and applied by calling `flush` afterwards. Every thread records into its own
+     * `Recorder`, so recording does not need any locks.
+     * 
+     * When flushed, the commands are applied in this order:
+     *  1. all objects are created, objects with the same set of components are created together
+     *  2. all components are added and removed. Every object is moved to its final archtype only once and objects that
+     *     end up with the same set of components are moved together.
+     *  3. all parents are set in the order they where recorded (per thread)
+     *  4. all objects are destroyed
+     */
+    class CommandBuffer {
+    public:
+
+        /**
+         * @brief a handle to an object that is created when the command buffer is flushed
+         * 
+         * The handle can be used as a target for other commands of the same command buffer. After flushing, it can be
+         * turned into an object using `resolve` until the command buffer is flushed again.
+         */
+        struct Pending {
+            /**
+             * @brief the index of the recorder that recorded the creation
+             */
+            u32 recorder = UINT32_MAX;
+            /**
+             * @brief the index of the creation in the recorder
+             */
+            u32 index = UINT32_MAX;
+        };
+
+        /**
+         * @brief the target of a command, either an existing object or an object that is not created yet
+         */
+        struct Target {
+            /**
+             * @brief Construct a new Target
+             * 
+             * @param obj the existing object to target
+             */
+            Target(Object obj) noexcept
+             : object(obj)
+            {}
+
+            /**
+             * @brief Construct a new Target
+             * 
+             * @param obj the pending object to target
+             */
+            Target(Pending obj) noexcept
+             : pending(obj)
+            {}
+
+            /**
+             * @brief check if the target is created by the command buffer
+             * 
+             * @return `true` if the target is a pending object, `false` if it is an existing object
+             */
+            inline bool isPending() const noexcept
+            {return pending.recorder != UINT32_MAX;}
+
+            /**
+             * @brief the existing object, only used if the target is not pending
+             */
+            Object object;
+            /**
+             * @brief the pending object, only used if the target is pending
+             */
+            Pending pending;
+        };
+
+    protected:
+
+        /**
+         * @brief type-erased operations for a single component type
+         */
+        struct ComponentOps {
+            /**
+             * @brief `true` if the component is stored in a sparse set instead of the archtypes
+             */
+            bool sparse;
+            /**
+             * @brief make sure the column of the component exists and get its ID (`nullptr` for sparse components)
+             */
+            Registry::column_t (*registerColumn)(Registry&);
+            /**
+             * @brief add a recorded value to an entity or remove the component if the value is `nullptr` (only for sparse components)
+             */
+            void (*apply)(Registry&, Tiny::ECS::Entity, void*);
+            /**
+             * @brief move a recorded value into the component of an entity
+             */
+            void (*assign)(Registry&, Tiny::ECS::Entity, void*);
+            /**
+             * @brief destroy a recorded value
+             */
+            void (*destroy)(void*);
+        };
+
+        /**
+         * @brief the operations of a specific component type
+         * 
+         * @tparam C the component type
+         */
+        template <typename C>
+        inline static constexpr ComponentOps OPS = {
+            Tiny::ECS::sparse_storage_v<C>,
+            [] {
+                if constexpr (Tiny::ECS::sparse_storage_v<C>) {return static_cast<Registry::column_t (*)(Registry&)>(nullptr);}
+                else {return +[](Registry& reg) {return reg.registerComponent<C>();};}
+            }(),
+            [](Registry& reg, Tiny::ECS::Entity ent, void* data) {
+                if constexpr (Tiny::ECS::sparse_storage_v<C>) {
+                    if (data) {reg.add<C>(ent, std::move(*static_cast<C*>(data)));}
+                    else {reg.remove<C>(ent);}
+                }
+            },
+            [](Registry& reg, Tiny::ECS::Entity ent, void* data) {
+                if (C* comp = reg.get<C>(ent)) {*comp = std::move(*static_cast<C*>(data));}
+            },
+            [](void* data) {static_cast<C*>(data)->~C();}
+        };
+
+        /**
+         * @brief a recorded component value
+         */
+        struct Value {
+            /**
+             * @brief the operations of the component type
+             */
+            const ComponentOps* ops;
+            /**
+             * @brief a pointer to the value or `nullptr` if the component is removed
+             */
+            void* data;
+        };
+
+    public:
+
+        /**
+         * @brief the commands recorded by a single thread
+         * 
+         * @warning a recorder must only be used by the thread it belongs to, see `CommandBuffer::local`
+         */
+        class Recorder {
+        public:
+
+            /**
+             * @brief Construct a new Recorder
+             * 
+             * @param index the index of the recorder in the command buffer
+             */
+            Recorder(u32 index) noexcept
+             : m_index(index), m_thread(std::this_thread::get_id())
+            {}
+
+            /**
+             * @brief Destroy the Recorder
+             */
+            ~Recorder()
+            {reset();}
+
+            //recorders are owned by the command buffer
+            Recorder(const Recorder&) = delete;
+            Recorder& operator=(const Recorder&) = delete;
+
+            /**
+             * @brief record the creation of a new object at the root of the world
+             * 
+             * @tparam Cs the components to add to the object
+             * @param name the name of the object
+             * @param components the initial values of all components
+             * @return `Pending` a handle to the object that is created on flush
+             */
+            template <typename... Cs>
+            requires (!Tiny::ECS::util::contains_type_v<Object, std::decay_t<Cs>...> && !Tiny::ECS::util::contains_type_v<Pending, std::decay_t<Cs>...>)
+            Pending create(const std::string& name, Cs&&... components)
+            {return create(name, Target(World::getRoot()), std::forward<Cs>(components)...);}
+
+            /**
+             * @brief record the creation of a new object
+             * 
+             * @tparam Cs the components to add to the object
+             * @param name the name of the object
+             * @param parent the parent of the object
+             * @param components the initial values of all components
+             * @return `Pending` a handle to the object that is created on flush
+             */
+            template <typename... Cs>
+            Pending create(const std::string& name, Target parent, Cs&&... components) {
+                u32 first = static_cast<u32>(m_values.size());
+                (m_values.push_back(Value{&OPS<std::decay_t<Cs>>, __store<std::decay_t<Cs>>(std::forward<Cs>(components))}), ...);
+                m_creations.push_back(Creation{name, parent, first, static_cast<u32>(sizeof...(Cs))});
+                return Pending{m_index, static_cast<u32>(m_creations.size() - 1)};
+            }
+
+            /**
+             * @brief record the destruction of an object
+             * 
+             * @param obj the object to destroy
+             */
+            inline void destroy(Target obj)
+            {m_destroyed.push_back(obj);}
+
+            /**
+             * @brief record adding a component to an object
+             * 
+             * If the object allready has the component, the component is overwritten.
+             * 
+             * @tparam C the type of the component to add
+             * @tparam Args the argument types used to initialize the component
+             * @param obj the object to add the component to
+             * @param args the arguments used for initialization
+             */
+            template <typename C, typename... Args>
+            void add(Target obj, Args&&... args)
+            {m_changes.push_back(Change{obj, Value{&OPS<C>, __store<C>(std::forward<Args>(args)...)}});}
+
+            /**
+             * @brief record removing a component from an object
+             * 
+             * @tparam C the type of the component to remove
+             * @param obj the object to remove the component from
+             */
+            template <typename C>
+            void remove(Target obj)
+            {m_changes.push_back(Change{obj, Value{&OPS<C>, nullptr}});}
+
+            /**
+             * @brief record setting the parent of an object
+             * 
+             * @param subject the object to set the parent for
+             * @param parent the new parent of the object
+             */
+            inline void setParent(Target subject, Target parent)
+            {m_links.push_back({subject, parent});}
+
+            /**
+             * @brief check if the recorder holds any commands
+             * 
+             * @return `true` if no commands where recorded, `false` otherwise
+             */
+            inline bool empty() const noexcept
+            {return m_creations.empty() && m_changes.empty() && m_links.empty() && m_destroyed.empty();}
+
+            /**
+             * @brief drop all recorded commands
+             */
+            void reset() noexcept;
+
+        protected:
+
+            //the command buffer applies the commands
+            friend class CommandBuffer;
+
+            /**
+             * @brief a recorded object creation
+             */
+            struct Creation {
+                /**
+                 * @brief the name of the object
+                 */
+                std::string name;
+                /**
+                 * @brief the parent of the object
+                 */
+                Target parent;
+                /**
+                 * @brief the index of the first component value
+                 */
+                u32 firstValue;
+                /**
+                 * @brief the amount of component values
+                 */
+                u32 valueCount;
+            };
+
+            /**
+             * @brief a recorded component change
+             */
+            struct Change {
+                /**
+                 * @brief the object to change
+                 */
+                Target target;
+                /**
+                 * @brief the added value (or the removed type if the data is `nullptr`)
+                 */
+                Value value;
+            };
+
+            /**
+             * @brief construct a component value in the storage of the recorder
+             * 
+             * @tparam C the type of the component
+             * @tparam Args the argument types used to initialize the component
+             * @param args the arguments used for initialization
+             * @return `void*` a pointer to the new value
+             */
+            template <typename C, typename... Args>
+            void* __store(Args&&... args) {
+                static_assert(alignof(C) <= alignof(std::max_align_t), "Over-aligned components can not be recorded");
+                return new (__allocate(sizeof(C))) C(std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief allocate storage for a component value
+             * 
+             * The storage is kept between flushes, so recording does not allocate once the recorder warmed up.
+             * 
+             * @param size the size of the value in bytes
+             * @return `void*` a pointer to the storage, aligned for any type
+             */
+            void* __allocate(size_t size);
+
+            /**
+             * @brief the index of the recorder in the command buffer
+             */
+            u32 m_index;
+            /**
+             * @brief the thread the recorder belongs to
+             */
+            std::thread::id m_thread;
+            /**
+             * @brief the next recorder of the same command buffer
+             */
+            Recorder* m_next = nullptr;
+
+            /**
+             * @brief all recorded object creations
+             */
+            std::vector<Creation> m_creations;
+            /**
+             * @brief the component values of all creations
+             */
+            std::vector<Value> m_values;
+            /**
+             * @brief all recorded component changes
+             */
+            std::vector<Change> m_changes;
+            /**
+             * @brief all recorded parent changes (subject, parent)
+             */
+            std::vector<std::pair<Target, Target>> m_links;
+            /**
+             * @brief all recorded object destructions
+             */
+            std::vector<Target> m_destroyed;
+
+            /**
+             * @brief the storage blocks for component values
+             */
+            std::vector<std::unique_ptr<std::max_align_t[]>> m_blocks;
+            /**
+             * @brief the size of each storage block in bytes
+             */
+            std::vector<size_t> m_blockSizes;
+            /**
+             * @brief the index of the block that is currently filled
+             */
+            size_t m_block = 0;
+            /**
+             * @brief the amount of bytes used in the current block
+             */
+            size_t m_used = 0;
+        };
+
+        /**
+         * @brief Construct a new Command Buffer
+         * 
+         * @param world the world the commands are applied to
+         */
+        CommandBuffer(World& world);
+
+        /**
+         * @brief Destroy the Command Buffer
+         * 
+         * Commands that where not flushed are dropped.
+         */
+        ~CommandBuffer();
+
+        //the recorders refer to the command buffer
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        /**
+         * @brief get the recorder of the calling thread
+         * 
+         * This is lock free. A recorder is created the first time a thread records into the command buffer.
+         * 
+         * @return `Recorder&` the recorder of the calling thread
+         */
+        Recorder& local();
+
+        /**
+         * @brief record the creation of a new object from the calling thread
+         * 
+         * @tparam Args the name, the optional parent and the initial values of all components
+         * @param args the arguments, see `Recorder::create`
+         * @return `Pending` a handle to the object that is created on flush
+         */
+        template <typename... Args>
+        inline Pending create(Args&&... args)
+        {return local().create(std::forward<Args>(args)...);}
+
+        /**
+         * @brief record the destruction of an object from the calling thread
+         * 
+         * @param obj the object to destroy
+         */
+        inline void destroy(Target obj)
+        {local().destroy(obj);}
+
+        /**
+         * @brief record adding a component to an object from the calling thread
+         * 
+         * @tparam C the type of the component to add
+         * @tparam Args the argument types used to initialize the component
+         * @param obj the object to add the component to
+         * @param args the arguments used for initialization
+         */
+        template <typename C, typename... Args>
+        inline void add(Target obj, Args&&... args)
+        {local().template add<C>(obj, std::forward<Args>(args)...);}
+
+        /**
+         * @brief record removing a component from an object from the calling thread
+         * 
+         * @tparam C the type of the component to remove
+         * @param obj the object to remove the component from
+         */
+        template <typename C>
+        inline void remove(Target obj)
+        {local().template remove<C>(obj);}
+
+        /**
+         * @brief record setting the parent of an object from the calling thread
+         * 
+         * @param subject the object to set the parent for
+         * @param parent the new parent of the object
+         */
+        inline void setParent(Target subject, Target parent)
+        {local().setParent(subject, parent);}
+
+        /**
+         * @brief apply all recorded commands to the world
+         * 
+         * @warning this must not be called while other threads record into the command buffer or access the world
+         */
+        void flush();
+
+        /**
+         * @brief drop all recorded commands without applying them
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief get the object that was created for a pending handle by the last flush
+         * 
+         * @param obj the pending handle
+         * @return `Object` the created object or an invalid object if the handle is unknown
+         */
+        Object resolve(Pending obj) const noexcept;
+
+        /**
+         * @brief get the world the commands are applied to
+         * 
+         * @return `World&` a reference to the world
+         */
+        inline World& getWorld() noexcept
+        {return *m_world;}
+
+    protected:
+
+        /**
+         * @brief get the object a target refers to
+         * 
+         * @param target the target to resolve
+         * @return `Object` the object (invalid if the pending object is unknown)
+         */
+        inline Object __resolve(const Target& target) const noexcept
+        {return target.isPending() ? resolve(target.pending) : target.object;}
+
+        /**
+         * @brief get all recorders sorted by their index
+         * 
+         * @return `std::vector<Recorder*>` all recorders
+         */
+        std::vector<Recorder*> __recorders() const;
+
+        /**
+         * @brief create all recorded objects
+         * 
+         * @param recorders all recorders
+         */
+        void __applyCreations(const std::vector<Recorder*>& recorders);
+
+        /**
+         * @brief add and remove all recorded components
+         * 
+         * @param recorders all recorders
+         */
+        void __applyChanges(const std::vector<Recorder*>& recorders);
+
+        /**
+         * @brief the world the commands are applied to
+         */
+        World* m_world;
+        /**
+         * @brief a unique identifier of the command buffer, used to cache the recorder of a thread
+         */
+        u64 m_id;
+        /**
+         * @brief the first recorder of the lock-free list of all recorders
+         */
+        std::atomic<Recorder*> m_head{nullptr};
+        /**
+         * @brief the amount of recorders
+         */
+        std::atomic<u32> m_recorderCount{0};
+        /**
+         * @brief the objects created by the last flush, indexed by recorder and creation index
+         */
+        std::vector<std::vector<Object>> m_created;
+
+    };
+
+}
+
+#endif
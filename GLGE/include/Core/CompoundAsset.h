@@ -67,6 +67,24 @@ namespace GLGE {
             UntypedAssetHandle handle;
         };
 
+        /**
+         * @brief an entry of the flat path index
+         */
+        struct IndexEntry {
+            /**
+             * @brief the full virtual path relative to the indexing compound asset
+             */
+            std::string path;
+            /**
+             * @brief the (possibly nested) compound asset that owns the entry
+             */
+            CompoundAsset* owner;
+            /**
+             * @brief the entry in the map of the owner
+             */
+            FileEntry* entry;
+        };
+
     public:
 
         //iterators are declared later
@@ -353,14 +371,36 @@ namespace GLGE {
         virtual void export_as(const std::filesystem::path& file, u32 format) noexcept(false) override;
 
         /**
-         * @brief check if a file entry exists
+         * @brief compute the hash of a virtual path
          * 
-         * @warning this function is recursive
+         * The hash is the FNV-1a hash of the path using `/` as separator, so `__FNV_1A_64_HASH("models/truck")` computes
+         * the same hash at compile time. 
+         * 
+         * @param virtualPath the virtual path to hash
+         * @return `u64` the hash of the path
+         */
+        inline static u64 hashPath(const std::filesystem::path& virtualPath) noexcept
+        {return __FNV_1A_64_HASH(virtualPath.generic_string());}
+
+        /**
+         * @brief check if a file entry exists
          * 
          * @param virtualPath the virtual path to the virtual file
          * @return `true` if the virtual file was found, `false` if not
          */
-        bool hasEntry(const std::filesystem::path& virtualPath);
+        inline bool hasEntry(const std::filesystem::path& virtualPath)
+        {return __findEntry(virtualPath) != nullptr;}
+
+        /**
+         * @brief check if a file entry exists
+         * 
+         * Nested compound assets are part of the index, so this is a single hash lookup regardless of the depth of the path. 
+         * The path itself is not compared, a path that is not stored may share its hash with one that is. 
+         * 
+         * @param pathHash the hash of the virtual path (see `hashPath`)
+         * @return `true` if the virtual file was found, `false` if not
+         */
+        bool hasEntry(u64 pathHash);
 
         /**
          * @brief erase an entry from the compound asset
@@ -435,75 +475,62 @@ namespace GLGE {
                 m_rawBlob.insert(m_rawBlob.end(), compressed.begin(), compressed.end());
                 m_virtualEntryMap[name].reference = meta;
                 //store the handle
-                m_virtualEntryMap[name].handle.getTyped<T>() = handle;
+                m_virtualEntryMap[name].handle = handle;
+                //the entry moved, so the index must be rebuilt
+                m_indexDirty = true;
             } else {
                 //if not, recurse deeper
-                if (m_virtualEntryMap.at(beg->string()).reference.fileType == getTypeHash64<CompoundAsset>())
-                {m_virtualEntryMap.at(beg->string()).handle.getTyped<CompoundAsset>().reference()->open<T>(*beg);}
+                auto dir = m_virtualEntryMap.find(ent->string());
+                if ((dir == m_virtualEntryMap.end()) || (dir->second.reference.fileType != getTypeHash64<CompoundAsset>()) || !dir->second.handle.isValid()) {
+                    std::stringstream stream;
+                    stream << "Failed to write the virtual asset " << virtualPath << ": " << *ent << " is not a directory";
+                    throw GLGE::Exception(stream.str(), "GLGE::CompoundAsset::write");
+                }
+                //collect the remaining path
+                std::filesystem::path rest;
+                for (; beg != virtualPath.end(); ++beg) {rest /= *beg;}
+                AssetHandle<CompoundAsset> child = dir->second.handle.getTyped<CompoundAsset>();
+                child.reference()->write<T>(rest, handle);
+                //re-store the modified directory so the own data stays up to date
+                write<CompoundAsset>(*ent, child);
             }
         }
 
         /**
          * @brief a function to open a virtual asset like a file
          * 
-         * @warning this function may throw if the virtual path is invalid. 
-         * 
-         * @warning this function is recursive. 
-         * 
          * @tparam T the type of the asset to open
          * @param virtualPath the virtual path to open the file at
-         * @return `AssetHandle<T>` the filled asset handle
+         * @return `AssetHandle<T>` the filled asset handle or an invalid handle if the path does not exist or has another type
          */
         template <typename T>
         requires std::is_base_of_v<Asset, T>
-        AssetHandle<T> open(const std::filesystem::path& virtualPath) {
-            //get only the top most entry
-            //the actual virtual file that is looked for may be in sub-directories
-
-            //sanity check if the front exists
-            auto beg = virtualPath.begin();
-            if (beg == virtualPath.end()) {
-                //return an invalid handle
-                return AssetHandle<T>{};
-            }
-
-            //check for the top most entry to exist
-            bool exists = m_virtualEntryMap.contains(beg->string());
+        inline AssetHandle<T> open(const std::filesystem::path& virtualPath) {
+            const IndexEntry* entry = __findEntry(virtualPath);
+            return entry ? entry->owner->template __openEntry<T>(*entry->entry) : AssetHandle<T>{};
+        }
 
-            //if it does not exist, stop
-            if (!exists) {
+        /**
+         * @brief a function to open a virtual asset like a file
+         * 
+         * The path itself is not compared, a path that is not stored may share its hash with one that is. 
+         * 
+         * @tparam T the type of the asset to open
+         * @param pathHash the hash of the virtual path to open the file at (see `hashPath`)
+         * @return `AssetHandle<T>` the filled asset handle or an invalid handle if the path does not exist or has another type
+         */
+        template <typename T>
+        requires std::is_base_of_v<Asset, T>
+        AssetHandle<T> open(u64 pathHash) {
+            GLGE_PROFILER_SCOPE();
+            __ensureIndex();
+            auto it = m_pathIndex.find(pathHash);
+            if (it == m_pathIndex.end()) {
                 //return an invalid handle
                 return AssetHandle<T>{};
             }
-
-            //else, check if the asset can be opend
-            auto el = beg;
-            ++beg;
-            if (beg == virtualPath.end()) {
-                //get the element
-                FileEntry& entry = m_virtualEntryMap.at(el->string());
-                //check if it is allready loaded
-                if (entry.handle.isValid())
-                {return entry.handle.getTyped<T>();}
-                //sanity check the type
-                if (entry.reference.fileType != getTypeHash64<T>()){
-                    //return an invalid handle
-                    return AssetHandle<T>{};
-                }
-                //extract the raw data
-                std::vector<u8> data;
-                entry.reference.uncompressedSize = getUncompressed(data, entry.reference);
-                //actual load to the asset
-                AssetHandle<T> handle = m_manager->load<T>(data);
-                entry.handle.getTyped<T>() = handle;
-                return handle;
-            }
-            //if not, recurse deeper
-            if (m_virtualEntryMap.at(el->string()).reference.fileType == getTypeHash64<CompoundAsset>())
-            {return m_virtualEntryMap.at(el->string()).handle.getTyped<CompoundAsset>().reference()->open<T>(*beg);}
-
-            //return an invalid handle
-            return AssetHandle<T>{};
+            //the entry is decompressed by the compound asset that owns it
+            return it->second.owner->template __openEntry<T>(*it->second.entry);
         }
 
         /**
@@ -543,6 +570,63 @@ namespace GLGE {
          */
         void compress(const std::vector<u8>& from, std::vector<u8>& to);
 
+        /**
+         * @brief load the asset of an entry of this compound asset
+         * 
+         * @tparam T the type of the asset to load
+         * @param entry the entry to load
+         * @return `AssetHandle<T>` the filled asset handle or an invalid handle if the type does not match
+         */
+        template <typename T>
+        AssetHandle<T> __openEntry(FileEntry& entry) {
+            //check if it is allready loaded
+            if (entry.handle.isValid())
+            {return entry.handle.getTyped<T>();}
+            //sanity check the type
+            if (entry.reference.fileType != getTypeHash64<T>()) {
+                //return an invalid handle
+                return AssetHandle<T>{};
+            }
+            //extract the raw data
+            std::vector<u8> data;
+            entry.reference.uncompressedSize = getUncompressed(data, entry.reference);
+            //actual load to the asset
+            AssetHandle<T> handle = m_manager->load<T>(data);
+            entry.handle = handle;
+            return handle;
+        }
+
+        /**
+         * @brief rebuild the path index if an entry changed since it was built
+         */
+        inline void __ensureIndex() {
+            if (m_indexDirty) {__rebuildIndex();}
+        }
+
+        /**
+         * @brief rebuild the flat path index from the entries and the indices of all nested compound assets
+         * 
+         * @throws `GLGE::Exception` if two virtual paths have the same hash
+         */
+        void __rebuildIndex();
+
+        /**
+         * @brief add an entry to the path index
+         * 
+         * @throws `GLGE::Exception` if another virtual path with the same hash is allready indexed
+         * 
+         * @param entry the entry to add
+         */
+        void __addIndexEntry(IndexEntry&& entry);
+
+        /**
+         * @brief find the index entry of a virtual path
+         * 
+         * @param virtualPath the virtual path to find
+         * @return `const IndexEntry*` a pointer to the entry or `nullptr` if the path is not stored
+         */
+        const IndexEntry* __findEntry(const std::filesystem::path& virtualPath);
+
         /**
          * @brief store a pointer to the asset manager that this compound asset is loaded to
          */
@@ -558,6 +642,16 @@ namespace GLGE {
          * Data is stored compressed by default to not eat up too much ram
          */
         std::vector<u8> m_rawBlob;
+        /**
+         * @brief map the hashes of all virtual paths (including the ones in nested compound assets) to their entries
+         * 
+         * @warning nested compound assets must be modified through this compound asset, else the index may hold dangling entries
+         */
+        std::unordered_map<u64, IndexEntry> m_pathIndex;
+        /**
+         * @brief store if the path index is out of date
+         */
+        bool m_indexDirty = true;
 
     };
 
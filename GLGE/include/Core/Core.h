@@ -46,11 +46,21 @@
 #include "BaseClass.h"
 //add the asset system
 #include "AssetManager.h"
+//add the arena allocator for world storage
+#include "ChunkAllocator.h"
 //add objects and worlds
 #include "Object.h"
+//add deferred structural changes
+#include "CommandBuffer.h"
+//add prefabs
+#include "Prefab.h"
 
 //add transforms
 #include "Transform.h"
+//add spatial queries
+#include "SpatialIndex.h"
+//add the system scheduler
+#include "SystemScheduler.h"
 
 //add apps
 #include "Application.h"
@@ -61,5 +71,7 @@
 #include "CompoundAsset.h"
 #include "WorldAsset.h"
 #include "MeshAsset.h"
+//add the derived data cache for cooked imports
+#include "DerivedDataCache.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,149 @@
+/**
+ * @file DerivedDataCache.h
+ * @author DM8AT
+ * @brief define a local cache for derived (cooked) asset data
+ *
+ * Importing assets from general purpose formats (assimp meshes, stb images, ...) is expensive, but the result only depends
+ * on the source file, the importer settings and the version of the produced GLGE format. The derived data cache stores
+ * the cooked GLGE binary form of an import keyed by exactly those inputs, so later imports of the same file can skip the
+ * importer completely and just run the (cheap) GLGE loader.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+//header guard
+#ifndef _GLGE_CORE_DERIVED_DATA_CACHE_
+#define _GLGE_CORE_DERIVED_DATA_CACHE_
+
+//add common stuff
+#include "Common.h"
+//add type info (for hashing)
+#include "TypeInfo.h"
+
+//add paths
+#include <filesystem>
+//add strings
+#include <string_view>
+//add vectors
+#include <vector>
+
+//use the library namespace
+namespace GLGE {
+
+    /**
+     * @brief a process wide cache for cooked asset data
+     *
+     * Entries are stored as single files named after their key in the cache directory. Writes go to a temporary file first
+     * and are then renamed, so concurrent imports (from multiple threads or processes) never observe partially written entries.
+     * Every entry carries a checksum, corrupted entries are treated as a cache miss and removed.
+     *
+     * All functions are thread safe.
+     */
+    class DerivedDataCache {
+    public:
+
+        //the cache is only a namespace for static state
+        DerivedDataCache() = delete;
+
+        /**
+         * @brief compute the cache key for a specific import
+         *
+         * The key covers the full content of the source file (not its path or time stamp), the importer, the importer settings,
+         * the format version of the produced data and the GLGE version.
+         *
+         * @param source the path to the source file to import
+         * @param importer a unique name for the importer (for example `"GLGE::MeshAsset::ASSIMP"`)
+         * @param settings a value encoding all settings that influence the import (for example post processing flags)
+         * @param formatVersion the version of the cooked binary format
+         * @return `u64` the key to use for the cache entry
+         */
+        static u64 computeKey(const std::filesystem::path& source, std::string_view importer, u64 settings, u32 formatVersion) noexcept(false);
+
+        /**
+         * @brief try to read the cooked data for a key
+         *
+         * @param key the key of the entry to read
+         * @param data a vector to APPEND the cooked data to
+         * @return `true` if the entry was found and is valid, `false` on a miss (the vector is not modified then)
+         */
+        static bool fetch(u64 key, std::vector<u8>& data) noexcept;
+
+        /**
+         * @brief store cooked data for a key
+         *
+         * Failing to write the entry is not an error, the cache is a pure optimization.
+         *
+         * @param key the key to store the data under
+         * @param data the cooked data to store
+         */
+        static void store(u64 key, const std::vector<u8>& data) noexcept;
+
+        /**
+         * @brief remove all entries from the cache directory
+         */
+        static void clear() noexcept;
+
+        /**
+         * @brief Set the directory to store the cache entries in
+         *
+         * The default is `GLGE/DerivedDataCache` in the temporary directory of the system.
+         *
+         * @param directory the new directory. It is created on demand.
+         */
+        static void setDirectory(const std::filesystem::path& directory);
+
+        /**
+         * @brief Get the directory the cache entries are stored in
+         *
+         * @return `std::filesystem::path` the cache directory
+         */
+        static std::filesystem::path getDirectory();
+
+        /**
+         * @brief enable or disable the cache
+         *
+         * If the cache is disabled, `fetch` always misses and `store` does nothing.
+         *
+         * @param enabled `true` to enable the cache, `false` to disable it
+         */
+        static void setEnabled(bool enabled) noexcept;
+
+        /**
+         * @brief check if the cache is enabled
+         *
+         * @return `true` if the cache is enabled, `false` if not
+         */
+        static bool isEnabled() noexcept;
+
+        /**
+         * @brief get the amount of successful fetches since the program started
+         *
+         * @return `u64` the amount of cache hits
+         */
+        static u64 getHitCount() noexcept;
+
+        /**
+         * @brief get the amount of failed fetches since the program started
+         *
+         * @return `u64` the amount of cache misses
+         */
+        static u64 getMissCount() noexcept;
+
+    protected:
+
+        /**
+         * @brief get the path of the file for a specific entry
+         *
+         * @param key the key of the entry
+         * @return `std::filesystem::path` the path to the entry file
+         */
+        static std::filesystem::path entryPath(u64 key);
+
+    };
+
+}
+
+#endif
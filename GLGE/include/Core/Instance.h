@@ -42,6 +42,8 @@
 #include <type_traits>
 //for working with threads
 #include <thread>
+//guard the update statistics
+#include <mutex>
 
 //add ordered maps
 #include "utils/OrderedMap.h"
@@ -61,6 +63,32 @@ namespace GLGE {
      */
     class Instance;
 
+    /**
+     * @brief the timing statistics of the update of a single instance extension
+     */
+    struct ExtensionTiming {
+        /**
+         * @brief the name the extension is attached with
+         */
+        std::string_view name;
+        /**
+         * @brief the duration of the last `onUpdate` call in milliseconds
+         */
+        double last = 0.;
+        /**
+         * @brief the average duration of all `onUpdate` calls in milliseconds
+         */
+        double average = 0.;
+        /**
+         * @brief the longest duration of a single `onUpdate` call in milliseconds
+         */
+        double max = 0.;
+        /**
+         * @brief the amount of `onUpdate` calls
+         */
+        u64 calls = 0;
+    };
+
     /**
      * @brief an instance extension extends the functionality of the underlying instance. 
      * 
@@ -76,6 +104,11 @@ namespace GLGE {
      *          [EXTENSION 3]  [EXTENSION 4]
      * ```
      * The functions are passed down, where the parent is called before the children. 
+     * 
+     * Each tick of the update thread, the instance builds a graph from the extension tree and the dependencies declared 
+     * with `runAfter`. By default, the extensions update one after another in the order they where attached, only moved 
+     * where a dependency requires it. If parallel updates are enabled (see `Instance::setParallelUpdate`), extensions that 
+     * don't depend on each other update concurrently on the employer of the instance. 
      */
     class InstanceExtension {
     public:
@@ -181,6 +214,28 @@ namespace GLGE {
         inline InstanceExtension* getParent() const noexcept
         {return m_parent;}
 
+        /**
+         * @brief make the update of this extension wait for the update of a sibling extension
+         * 
+         * Siblings are the extensions attached to the same parent extension or directly to the instance. The update 
+         * waits for the sibling and all of its children. Extensions without a dependency between them may update 
+         * concurrently if parallel updates are enabled, children allways update after their parent. Unknown siblings and 
+         * cycles make `Instance::start` throw. 
+         * 
+         * @param sibling the name the sibling extension is attached with. The name must outlive the extension. 
+         * @return `InstanceExtension&` a reference to this extension to chain dependencies
+         */
+        inline InstanceExtension& runAfter(std::string_view sibling)
+        {m_runAfter.push_back(sibling); return *this;}
+
+        /**
+         * @brief get the names of all siblings this extension updates after
+         * 
+         * @return `const std::vector<std::string_view>&` a constant reference to the names of the siblings
+         */
+        inline const std::vector<std::string_view>& getDependencies() const noexcept
+        {return m_runAfter;}
+
     protected:
 
         /**
@@ -212,6 +267,11 @@ namespace GLGE {
          */
         virtual void unbind() noexcept final;
 
+        /**
+         * @brief call the update binding and record its timing
+         */
+        void timedUpdate();
+
         /**
          * @brief store a pointer to the instance the extension is attached to
          */
@@ -220,6 +280,18 @@ namespace GLGE {
          * @brief store a pointer to the parent extension
          */
         InstanceExtension* m_parent = nullptr;
+        /**
+         * @brief store the names of all siblings this extension updates after
+         */
+        std::vector<std::string_view> m_runAfter;
+        /**
+         * @brief store the timing of the update, only written by the thread that updates the extension
+         */
+        ExtensionTiming m_timing;
+        /**
+         * @brief store the summed up duration of all updates in milliseconds
+         */
+        double m_totalTime = 0.;
     };
 
     /**
@@ -413,6 +485,8 @@ namespace GLGE {
 
         /**
          * @brief start the instance and prepare to run the application
+         * 
+         * Throws if an extension should update after a sibling that does not exist or the update dependencies contain a cycle. 
          */
         void start();
 
@@ -542,6 +616,57 @@ namespace GLGE {
         inline RateLimit& updateLimiter() noexcept
         {return m_updateLimiter;}
 
+        /**
+         * @brief set if independent extensions may update concurrently
+         * 
+         * Disabled by default, as extensions that don't declare their dependencies may share state with their siblings. If 
+         * disabled, all extensions update on the update thread in the order they where attached, only moved where a 
+         * dependency declared with `InstanceExtension::runAfter` requires it. 
+         * 
+         * @param parallel `true` to update on the employer, `false` to update on the update thread only
+         */
+        inline void setParallelUpdate(bool parallel) noexcept
+        {m_parallelUpdate.store(parallel, std::memory_order_relaxed);}
+
+        /**
+         * @brief get if independent extensions may update concurrently
+         * 
+         * @return `true` if the extensions update on the employer, `false` if they update on the update thread only
+         */
+        inline bool isParallelUpdate() const noexcept
+        {return m_parallelUpdate.load(std::memory_order_relaxed);}
+
+        /**
+         * @brief get the timing statistics of the extension updates of the last tick
+         * 
+         * @return `std::vector<ExtensionTiming>` the timings of all extensions, parents come before their children
+         */
+        std::vector<ExtensionTiming> getUpdateTimings() const;
+
+        /**
+         * @brief get the critical path of the last tick
+         * 
+         * The critical path is the chain of dependent extensions whose summed up update time is the longest. It is the 
+         * lower bound for the duration of the extension updates, no matter how many workers are available. 
+         * 
+         * @return `std::vector<std::string_view>` the names of the extensions on the critical path in update order
+         */
+        std::vector<std::string_view> getCriticalPath() const;
+
+        /**
+         * @brief get the duration of the critical path of the last tick
+         * 
+         * @return `double` the summed up update time of all extensions on the critical path in milliseconds
+         */
+        double getCriticalPathTime() const;
+
+        /**
+         * @brief get a human readable report of the extension updates of the last tick
+         * 
+         * @return `std::string` the report, one extension per line followed by the critical path
+         */
+        std::string getUpdateReport() const;
+
         /**
          * @brief access all the assets of the instance
          * 
@@ -558,6 +683,16 @@ namespace GLGE {
         inline Tiny::Jobs::Employer& employer() noexcept
         {return m_employer;}
 
+        /**
+         * @brief get an awaitable that suspends a coroutine until the next tick of the update thread starts
+         * 
+         * The waiting coroutines are resumed on the employer at the start of the next tick, concurrently to the 
+         * extension updates. Coroutines that still wait when the instance is destroyed are never resumed. 
+         * 
+         * @return `Tiny::Jobs::CompletionAwaiter` the awaitable for the next tick
+         */
+        Tiny::Jobs::CompletionAwaiter nextFrame();
+
         /**
          * @brief register a new keyboard
          * 
@@ -814,6 +949,11 @@ namespace GLGE {
          */
         void update();
 
+        /**
+         * @brief update all extensions as a graph, independent extensions update concurrently
+         */
+        void updateExtensions();
+
         /**
          * @brief a function that is called during initialization
          */
@@ -877,6 +1017,42 @@ namespace GLGE {
          * @brief store the rate limiter for the main tick
          */
         RateLimit m_mainLimiter;
+        /**
+         * @brief store if independent extensions update concurrently
+         */
+        std::atomic_bool m_parallelUpdate{false};
+        /**
+         * @brief guard the update statistics, they are written by the update thread and read from anywhere
+         */
+        mutable std::mutex m_updateStatMtx;
+        /**
+         * @brief store the timings of the extension updates of the last tick
+         */
+        std::vector<ExtensionTiming> m_updateTimings;
+        /**
+         * @brief store the indices of the extensions on the critical path of the last tick into the update timings
+         */
+        std::vector<size_t> m_criticalPath;
+        /**
+         * @brief store the duration of the critical path of the last tick in milliseconds
+         */
+        double m_criticalPathTime = 0.;
+        /**
+         * @brief store the duration of all extension updates of the last tick in milliseconds
+         */
+        double m_lastUpdateTime = 0.;
+        /**
+         * @brief store the amount of levels the extension graph of the last tick was split into
+         */
+        size_t m_updateLevelCount = 0;
+        /**
+         * @brief guard the completion of the next tick
+         */
+        std::mutex m_frameMtx;
+        /**
+         * @brief store the completion that happens at the start of the next tick, it is shared with the waiting coroutines
+         */
+        std::shared_ptr<Tiny::Jobs::Completion> m_nextFrame = std::make_shared<Tiny::Jobs::Completion>();
 
         /**
          * @brief store all the assets used by this instance
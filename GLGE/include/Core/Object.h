@@ -20,12 +20,38 @@
 #define TINY_JOBS_NO_FIBERS
 #define TINY_JOBS_NO_LOCKFREE
 #include "dependencies/TinyECS.h"
+//add the allocator for the chunk storage
+#include "ChunkAllocator.h"
+//for sorting the memory report
+#include <algorithm>
+//add iterator tags for the hierarchy iterators
+#include <iterator>
 
 //use the library namespace
 namespace GLGE {
 
     //worlds are defined later
     class World;
+    //world assets are defined later
+    class WorldAsset;
+    //systems are defined later
+    namespace System {class TransformPropagator;}
+    //command buffers are defined later
+    class CommandBuffer;
+    //prefabs are defined later
+    class Prefab;
+    //spatial indices are defined later
+    class SpatialIndex;
+    //queries are defined later
+    template <typename... Cs>
+    class Query;
+
+    /**
+     * @brief the ECS registry that stores the objects of a world
+     * 
+     * This is the default TinyECS world, but the chunk storage can be taken from a `ChunkArena`.
+     */
+    using Registry = Tiny::ECS::World_t<1024, 32, Tiny::ECS::Entity, uint16_t, uint16_t, uint32_t, ChunkAllocator>;
 
     /**
      * @brief a base class for all components that can be saved / loaded
@@ -194,15 +220,96 @@ namespace GLGE {
     class World : public BaseClass {
     public:
 
+        /**
+         * @brief the chunk memory used by a single archtype
+         */
+        struct ArchtypeMemory {
+            /**
+             * @brief the ID of the archtype
+             */
+            Registry::archtype_t archtype = 0;
+            /**
+             * @brief the amount of components of the archtype
+             */
+            size_t componentCount = 0;
+            /**
+             * @brief the amount of objects of the archtype
+             */
+            size_t objectCount = 0;
+            /**
+             * @brief the size of all chunks of the archtype in bytes
+             */
+            size_t bytes = 0;
+        };
+
         /**
          * @brief Construct a new World
          * 
          * @param name the name of the world
+         * @param arena the arena to allocate the chunk storage from or `nullptr` to use the default heap. The arena must 
+         *              outlive the world.
          */
-        World(const std::string& name)
-         : BaseClass(), m_name(name) 
+        World(const std::string& name, ChunkArena* arena = nullptr)
+         : BaseClass(), m_name(name), m_reg(ChunkAllocator<uint8_t>(arena))
         {}
 
+        /**
+         * @brief get the arena the chunk storage is allocated from
+         * 
+         * @return `ChunkArena*` a pointer to the arena or `nullptr` if the default heap is used
+         */
+        inline ChunkArena* getChunkArena() const noexcept
+        {return m_reg.storageAllocator().getArena();}
+
+        /**
+         * @brief get the chunk memory of all archtypes that own chunks
+         * 
+         * @return `std::vector<ArchtypeMemory>` the memory of every archtype, sorted from the largest to the smallest
+         */
+        std::vector<ArchtypeMemory> getChunkMemory() const {
+            std::vector<ArchtypeMemory> report;
+            for (size_t i = 0; i < m_reg.archtypeCount(); ++i) {
+                Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+                size_t bytes = m_reg.archtypeMemory(arch);
+                if (bytes == 0) {continue;}
+                report.push_back(ArchtypeMemory{arch, m_reg.archtypeColumns(arch).size(), m_reg.archtypeEntities(arch).size(), bytes});
+            }
+            std::sort(report.begin(), report.end(), [](const ArchtypeMemory& a, const ArchtypeMemory& b) {return a.bytes > b.bytes;});
+            return report;
+        }
+
+        /**
+         * @brief get the total chunk memory of the world
+         * 
+         * @return `size_t` the size of all chunks in bytes
+         */
+        inline size_t getTotalChunkMemory() const noexcept
+        {return m_reg.chunkMemory();}
+
+        /**
+         * @brief get the amount of chunks that don't hold a single object
+         * 
+         * Removed objects leave empty chunks at the end of their archtype until the world is compacted. 
+         * 
+         * @return `size_t` the amount of empty chunks over all components
+         */
+        inline size_t getEmptyChunkCount() const noexcept
+        {return m_reg.emptyChunkCount();}
+
+        /**
+         * @brief release empty chunks in small steps, for example in idle frame time
+         * 
+         * Each call continues where the last one stopped. Objects are not moved, so all `Object` handles stay valid. 
+         * 
+         * @warning this must not be called while the world is iterated
+         * 
+         * @param budget the time the compaction may take, at least one component column is compacted per call
+         * @param keep the amount of empty chunks every archtype keeps for objects that are created later
+         * @return `true` if the whole world was compacted, `false` if work is left for the next call
+         */
+        inline bool compact(std::chrono::microseconds budget, size_t keep = 0)
+        {return m_reg.compact(budget, keep);}
+
         /**
          * @brief Set the name of the world
          * 
@@ -308,17 +415,141 @@ namespace GLGE {
             return ret;
         }
 
+        /**
+         * @brief make sure that a component type can be used for runtime-defined object creation
+         * 
+         * @tparam C the component type to register
+         * @return `Registry::column_t` the ID of the column storing the component
+         */
+        template <typename C>
+        inline Registry::column_t registerComponent()
+        {return m_reg.registerComponent<C>();}
+
+        /**
+         * @brief create a lot of objects with the same set of components at once
+         * 
+         * The set of components is only known at runtime. All objects are created directly in their final archtype and all 
+         * components are default constructed. The objects are not linked into the hierarchy yet, use `bulkSetParent` for that. 
+         * 
+         * @param names the names of the objects, one object is created per name
+         * @param columns the columns of the components of the objects (see `registerComponent`). Names and hierarchy nodes are added automatically. 
+         * @param objects a vector to append the new objects to (in the same order as the names)
+         */
+        void bulkCreate(const std::vector<std::string_view>& names, std::vector<Registry::column_t> columns, std::vector<Object>& objects) {
+            //every object has a name and a hierarchy node
+            columns.push_back(m_reg.registerComponent<Component::Name>());
+            columns.push_back(m_reg.registerComponent<Component::HierarchyNode>());
+
+            //create all entities in one go
+            std::vector<Tiny::ECS::Entity> ids;
+            m_reg.bulkCreate(names.size(), ids, std::move(columns));
+
+            //assign the names
+            std::lock_guard lock(m_mtx);
+            objects.reserve(objects.size() + ids.size());
+            for (size_t i = 0; i < ids.size(); ++i) {
+                u32 nameId = getNameIndex(std::string(names[i]));
+                m_reg.get<Component::Name>(ids[i])->name = nameId;
+                m_nameRegistry[nameId].push_back(ids[i]);
+                objects.push_back(Object(ids[i]));
+            }
+        }
+
+        /**
+         * @brief create a lot of objects with the same name and the same set of components at once
+         * 
+         * Works like the other `bulkCreate`, but the name is only resolved once for all objects. 
+         * 
+         * @param count the amount of objects to create
+         * @param name the name of all objects
+         * @param columns the columns of the components of the objects (see `registerComponent`). Names and hierarchy nodes are added automatically. 
+         * @param objects a vector to append the new objects to
+         */
+        void bulkCreate(size_t count, const std::string& name, std::vector<Registry::column_t> columns, std::vector<Object>& objects) {
+            //every object has a name and a hierarchy node
+            columns.push_back(m_reg.registerComponent<Component::Name>());
+            columns.push_back(m_reg.registerComponent<Component::HierarchyNode>());
+
+            //create all entities in one go
+            std::vector<Tiny::ECS::Entity> ids;
+            m_reg.bulkCreate(count, ids, std::move(columns));
+
+            //assign the name
+            std::lock_guard lock(m_mtx);
+            u32 nameId = getNameIndex(name);
+            auto& registry = m_nameRegistry[nameId];
+            registry.reserve(registry.size() + ids.size());
+            objects.reserve(objects.size() + ids.size());
+            for (const Tiny::ECS::Entity& ent : ids) {
+                m_reg.get<Component::Name>(ent)->name = nameId;
+                registry.push_back(ent);
+                objects.push_back(Object(ent));
+            }
+        }
+
+        /**
+         * @brief link a lot of new objects into the hierarchy at once
+         * 
+         * Children are appended to their parents in the order they are given. The sibling list of every parent is only walked 
+         * once instead of once per child. 
+         * 
+         * @warning the objects must not be part of the hierarchy yet (freshly created using `bulkCreate`)
+         * 
+         * @param links pairs of objects and their new parents (an invalid parent means the root)
+         */
+        void bulkSetParent(const std::vector<std::pair<Object, Object>>& links) {
+            ++m_hierarchyVersion;
+            //store the last child for all parents that where touched
+            std::unordered_map<u32, Tiny::ECS::Entity> lastChild;
+            lastChild.reserve(links.size());
+            for (const auto& [subject, parent] : links) {
+                Component::HierarchyNode* parentNode = parent.valid() ? m_reg.get<Component::HierarchyNode>(parent.m_ent) : &m_root;
+                Component::HierarchyNode* childNode = m_reg.get<Component::HierarchyNode>(subject.m_ent);
+
+                //find the current last child, only walk the sibling list the first time the parent is seen
+                auto it = lastChild.find(parent.m_ent.getBlob());
+                if (it == lastChild.end()) {
+                    Tiny::ECS::Entity last = parentNode->firstChild;
+                    if (!(last == Tiny::ECS::Entity::getInvalid())) {
+                        for (Tiny::ECS::Entity next = m_reg.get<Component::HierarchyNode>(last)->nextSibling; !(next == Tiny::ECS::Entity::getInvalid()); next = m_reg.get<Component::HierarchyNode>(last)->nextSibling)
+                        {last = next;}
+                    }
+                    it = lastChild.emplace(parent.m_ent.getBlob(), last).first;
+                }
+
+                //append the child
+                if (it->second == Tiny::ECS::Entity::getInvalid())
+                {parentNode->firstChild = subject.m_ent;}
+                else {
+                    m_reg.get<Component::HierarchyNode>(it->second)->nextSibling = subject.m_ent;
+                    childNode->prevSibling = it->second;
+                }
+                childNode->parent = parent.m_ent;
+                it->second = subject.m_ent;
+            }
+        }
+
         /**
          * @brief destroy an object
          * 
          * @param obj a reference to the object to destroy
          */
         void destroy(Object& obj) {
-            //check if the entity had a parent
+            //check if the entity had a parent, objects created in bulk are not part of the hierarchy
             Component::HierarchyNode* node = m_reg.get<Component::HierarchyNode>(obj.m_ent);
-            //remove the entity from the linked list
-            m_reg.get<Component::HierarchyNode>(node->prevSibling)->nextSibling = node->nextSibling;
-            m_reg.get<Component::HierarchyNode>(node->nextSibling)->prevSibling = node->prevSibling;
+            if (node) {
+                ++m_hierarchyVersion;
+                //remove the entity from the linked list
+                if (node->prevSibling != Tiny::ECS::Entity::getInvalid())
+                {m_reg.get<Component::HierarchyNode>(node->prevSibling)->nextSibling = node->nextSibling;}
+                else {
+                    //the entity was the first child, so the parent has to start at the next one
+                    Component::HierarchyNode* parent = (node->parent == Tiny::ECS::Entity::getInvalid()) ? &m_root : m_reg.get<Component::HierarchyNode>(node->parent);
+                    if (parent) {parent->firstChild = node->nextSibling;}
+                }
+                if (node->nextSibling != Tiny::ECS::Entity::getInvalid())
+                {m_reg.get<Component::HierarchyNode>(node->nextSibling)->prevSibling = node->prevSibling;}
+            }
             //destroy the entity
             m_reg.remove(obj.m_ent);
             //invalidate the object
@@ -334,6 +565,302 @@ namespace GLGE {
         void setParent(Object subject, Object parent) 
         {__setParent(subject, parent, true);}
 
+        /**
+         * @brief an iterator over the direct children of an object
+         * 
+         * The iterator only follows the sibling links and never allocates. 
+         */
+        class ChildIterator {
+        public:
+
+            //make the iterator usable with the standard library
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Object;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = Object;
+
+            /**
+             * @brief Construct a new Child Iterator that points behind the last child
+             */
+            ChildIterator() = default;
+
+            /**
+             * @brief Construct a new Child Iterator
+             * 
+             * @param reg the registry the objects live in
+             * @param ent the first child to visit
+             */
+            ChildIterator(Registry* reg, Tiny::ECS::Entity ent) noexcept
+             : m_reg(reg), m_ent(ent)
+            {}
+
+            /**
+             * @brief get the current child
+             * 
+             * @return `Object` the object the iterator points to
+             */
+            inline Object operator*() const noexcept
+            {return Object(m_ent);}
+
+            /**
+             * @brief step to the next sibling
+             * 
+             * @return `ChildIterator&` a reference to the iterator
+             */
+            inline ChildIterator& operator++() noexcept {
+                m_ent = m_reg->read<Component::HierarchyNode>(m_ent)->nextSibling;
+                return *this;
+            }
+
+            /**
+             * @brief step to the next sibling
+             * 
+             * @return `ChildIterator` the iterator before the step
+             */
+            inline ChildIterator operator++(int) noexcept
+            {ChildIterator old = *this; ++*this; return old;}
+
+            /**
+             * @brief check if two iterators point to the same child
+             * 
+             * @param other the iterator to compare with
+             * @return `true` if both point to the same child, `false` otherwise
+             */
+            inline bool operator==(const ChildIterator& other) const noexcept
+            {return m_ent == other.m_ent;}
+
+        protected:
+
+            /**
+             * @brief the registry the objects live in
+             */
+            Registry* m_reg = nullptr;
+            /**
+             * @brief the current child, invalid behind the last child
+             */
+            Tiny::ECS::Entity m_ent = Tiny::ECS::Entity::getInvalid();
+
+        };
+
+        /**
+         * @brief an iterator over all direct and indirect children of an object in depth first order
+         * 
+         * The iterator walks the hierarchy using the parent and sibling links, so it needs neither recursion nor a stack. 
+         */
+        class DescendantIterator {
+        public:
+
+            //make the iterator usable with the standard library
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Object;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = Object;
+
+            /**
+             * @brief Construct a new Descendant Iterator that points behind the last descendant
+             */
+            DescendantIterator() = default;
+
+            /**
+             * @brief Construct a new Descendant Iterator
+             * 
+             * @param reg the registry the objects live in
+             * @param ent the first child of the object to walk
+             * @param maxDepth the maximum depth to walk to, the direct children have a depth of 1
+             */
+            DescendantIterator(Registry* reg, Tiny::ECS::Entity ent, u64 maxDepth) noexcept
+             : m_reg(reg), m_ent((maxDepth > 0) ? ent : Tiny::ECS::Entity::getInvalid()), m_maxDepth(maxDepth)
+            {}
+
+            /**
+             * @brief get the current descendant
+             * 
+             * @return `Object` the object the iterator points to
+             */
+            inline Object operator*() const noexcept
+            {return Object(m_ent);}
+
+            /**
+             * @brief get the depth of the current descendant relative to the walked object
+             * 
+             * @return `u64` the depth, 1 for direct children
+             */
+            inline u64 depth() const noexcept
+            {return m_depth;}
+
+            /**
+             * @brief step to the next descendant
+             * 
+             * @return `DescendantIterator&` a reference to the iterator
+             */
+            DescendantIterator& operator++() noexcept {
+                const Component::HierarchyNode* node = m_reg->read<Component::HierarchyNode>(m_ent);
+                //first go down, if that is allowed
+                if ((m_depth < m_maxDepth) && (node->firstChild != Tiny::ECS::Entity::getInvalid())) {
+                    m_ent = node->firstChild;
+                    ++m_depth;
+                    return *this;
+                }
+                //else go to the next sibling of the closest ancestor that has one
+                while (node->nextSibling == Tiny::ECS::Entity::getInvalid()) {
+                    if (m_depth == 1) {
+                        m_ent = Tiny::ECS::Entity::getInvalid();
+                        return *this;
+                    }
+                    m_ent = node->parent;
+                    --m_depth;
+                    node = m_reg->read<Component::HierarchyNode>(m_ent);
+                }
+                m_ent = node->nextSibling;
+                return *this;
+            }
+
+            /**
+             * @brief step to the next descendant
+             * 
+             * @return `DescendantIterator` the iterator before the step
+             */
+            inline DescendantIterator operator++(int) noexcept
+            {DescendantIterator old = *this; ++*this; return old;}
+
+            /**
+             * @brief check if two iterators point to the same descendant
+             * 
+             * @param other the iterator to compare with
+             * @return `true` if both point to the same descendant, `false` otherwise
+             */
+            inline bool operator==(const DescendantIterator& other) const noexcept
+            {return m_ent == other.m_ent;}
+
+        protected:
+
+            /**
+             * @brief the registry the objects live in
+             */
+            Registry* m_reg = nullptr;
+            /**
+             * @brief the current descendant, invalid behind the last descendant
+             */
+            Tiny::ECS::Entity m_ent = Tiny::ECS::Entity::getInvalid();
+            /**
+             * @brief the depth of the current descendant
+             */
+            u64 m_depth = 1;
+            /**
+             * @brief the maximum depth to walk to
+             */
+            u64 m_maxDepth = 0;
+
+        };
+
+        /**
+         * @brief a pair of iterators that can be used in range based for loops
+         * 
+         * @tparam Iterator the type of the iterators
+         */
+        template <typename Iterator>
+        struct HierarchyRange {
+            /**
+             * @brief the first element of the range
+             */
+            Iterator first;
+            /**
+             * @brief the iterator behind the last element of the range
+             */
+            Iterator last;
+
+            /**
+             * @brief get the first element of the range
+             * 
+             * @return `Iterator` an iterator to the first element
+             */
+            inline Iterator begin() const noexcept
+            {return first;}
+
+            /**
+             * @brief get the end of the range
+             * 
+             * @return `Iterator` an iterator behind the last element
+             */
+            inline Iterator end() const noexcept
+            {return last;}
+        };
+
+        /**
+         * @brief iterate over the direct children of an object without allocating
+         * 
+         * @warning the range is invalidated by changes to the hierarchy
+         * 
+         * @param obj the object to get the children for or an invalid object for the top level objects
+         * @return `HierarchyRange<ChildIterator>` a range over all children in order
+         */
+        inline HierarchyRange<ChildIterator> children(Object obj) noexcept
+        {return {ChildIterator(&m_reg, __node(obj)->firstChild), ChildIterator()};}
+
+        /**
+         * @brief iterate over all direct and indirect children of an object in depth first order without allocating
+         * 
+         * Use `DescendantIterator::depth` to get the depth of an element. 
+         * 
+         * @warning the range is invalidated by changes to the hierarchy
+         * 
+         * @param obj the object to get the descendants for or an invalid object for all objects in the hierarchy
+         * @param maxDepth the maximum depth to walk to, the direct children have a depth of 1
+         * @return `HierarchyRange<DescendantIterator>` a range over all descendants
+         */
+        inline HierarchyRange<DescendantIterator> descendants(Object obj, u64 maxDepth = 1000) noexcept
+        {return {DescendantIterator(&m_reg, __node(obj)->firstChild, maxDepth), DescendantIterator()};}
+
+        /**
+         * @brief a single object in the flattened hierarchy
+         */
+        struct HierarchyEntry {
+            /**
+             * @brief the object
+             */
+            Object object;
+            /**
+             * @brief the index of the parent in the flattened hierarchy, `UINT32_MAX` for top level objects
+             */
+            u32 parent = UINT32_MAX;
+            /**
+             * @brief the depth of the object, 0 for top level objects
+             */
+            u32 depth = 0;
+        };
+
+        /**
+         * @brief get all objects of the hierarchy sorted by depth, then by parent
+         * 
+         * Parents always come before their children and the children of a parent are stored next to each other in order. 
+         * This turns passes over the whole tree into linear scans. The order is cached and only re-built after the 
+         * hierarchy changed (re-parenting, creation or destruction of objects). 
+         * 
+         * @warning this is not thread safe, the span is invalidated by the next change to the hierarchy
+         * 
+         * @return `std::span<const HierarchyEntry>` all objects that are part of the hierarchy
+         */
+        inline std::span<const HierarchyEntry> getHierarchyOrder() {
+            if (m_orderVersion != m_hierarchyVersion) {__rebuildHierarchyOrder();}
+            return m_hierarchyOrder;
+        }
+
+        /**
+         * @brief get the start of every depth level in the flattened hierarchy (see `getHierarchyOrder`)
+         * 
+         * The objects of level `i` are stored at the indices `[levels[i], levels[i+1])`. 
+         * 
+         * @warning this is not thread safe, the span is invalidated by the next change to the hierarchy
+         * 
+         * @return `std::span<const size_t>` the start index of each level followed by the amount of objects
+         */
+        inline std::span<const size_t> getHierarchyLevels() {
+            if (m_orderVersion != m_hierarchyVersion) {__rebuildHierarchyOrder();}
+            return m_hierarchyLevels;
+        }
+
         /**
          * @brief Get the direct children of the 
          * 
@@ -345,21 +872,8 @@ namespace GLGE {
             std::vector<Object> res;
             res.reserve(16);
 
-            //get the first child
-            Component::HierarchyNode* node = nullptr;
-            if (obj.valid())
-            {node = m_reg.get<Component::HierarchyNode>(obj.m_ent);}
-            else
-            {node = &m_root;}
-            Tiny::ECS::Entity ent = node->firstChild;
-            while (!(ent == Tiny::ECS::Entity::getInvalid())) {
-                //store the new node
-                res.push_back(Object(ent));
-                //step forward
-                node = m_reg.get<Component::HierarchyNode>(ent);
-                if (!node) {return res;}
-                ent = node->nextSibling;
-            }
+            for (Object child : children(obj))
+            {res.push_back(child);}
 
             //return the finalized list
             return res;
@@ -372,7 +886,7 @@ namespace GLGE {
          * @return `Object` the parent of an object
          */
         inline Object getParent(Object obj) 
-        {return Object(m_reg.get<Component::HierarchyNode>(obj.m_ent)->parent);}
+        {return Object(m_reg.read<Component::HierarchyNode>(obj.m_ent)->parent);}
 
         /**
          * @brief a function to invoke a function on all direct children
@@ -384,20 +898,8 @@ namespace GLGE {
         template <typename Func>
         requires (std::is_invocable_v<Func, Object>) 
         void forAllChildren(Object obj, Func&& fn) {
-            //get the start node
-            Component::HierarchyNode* hierarchy = nullptr;
-            if (obj.valid())
-            {hierarchy = m_reg.get<Component::HierarchyNode>(obj.m_ent);}
-            else
-            {hierarchy = &m_root;}
-            Tiny::ECS::Entity node = hierarchy->firstChild;
-            //iterate
-            while (!(node == Tiny::ECS::Entity::getInvalid())) {
-                //first, call the function
-                fn(Object(node));
-                //then, step
-                node = m_reg.get<Component::HierarchyNode>(node)->nextSibling;
-            }
+            for (Object child : children(obj))
+            {fn(child);}
         }
 
         /**
@@ -410,8 +912,10 @@ namespace GLGE {
          */
         template <typename Func>
         requires (std::is_invocable_v<Func, Object>)
-        void forAllDescendants(Object obj, Func&& fn, u64 maxDepth = 1000) 
-        {__forAllDescendants(obj, fn, maxDepth, 0);}
+        void forAllDescendants(Object obj, Func&& fn, u64 maxDepth = 1000) {
+            for (Object child : descendants(obj, maxDepth))
+            {fn(child);}
+        }
 
         /**
          * @brief print all the children of a specific object
@@ -421,13 +925,15 @@ namespace GLGE {
          */
         void printTree(Object obj, u64 maxDepth = 1000) {
             //buffer everything to use a single print call
-            std::stringstream stream;
-            //first, print the object's name
-            stream << getObjectName(obj) << "\n";
-            //then recurse and print the children
-            stream << __printChildren(obj, maxDepth+1, 1).str();
-            //finally, print it
-            std::cout << stream.str();
+            std::string text = getObjectName(obj) + "\n";
+            auto range = descendants(obj, maxDepth);
+            for (auto it = range.begin(); it != range.end(); ++it) {
+                text.append(it.depth() * 2, ' ').append(getObjectName(*it)).append("\n");
+                //mark cut off sub-trees
+                if ((it.depth() == maxDepth) && (m_reg.read<Component::HierarchyNode>(Tiny::ECS::Entity(*it))->firstChild != Tiny::ECS::Entity::getInvalid()))
+                {text.append((it.depth() + 1) * 2, ' ').append("...\n");}
+            }
+            std::cout << text;
         }
 
         /**
@@ -441,6 +947,19 @@ namespace GLGE {
         Component* get(const Object& obj) noexcept
         {return m_reg.get<Component>(obj.m_ent);}
 
+        /**
+         * @brief read a specific component from an object
+         * 
+         * Unlike `get` this does not mark the component as changed. 
+         * 
+         * @tparam Component the type of component to read
+         * @param obj the object to read the component from
+         * @return `const Component*` a pointer to the component or `nullptr` if the component does not exist
+         */
+        template <typename Component>
+        const Component* read(const Object& obj) noexcept
+        {return m_reg.read<Component>(obj.m_ent);}
+
         /**
          * @brief invoke a function on all entities that have at least the specified components
          * 
@@ -452,6 +971,19 @@ namespace GLGE {
         void each(Func&& fn)
         {m_reg.each_match<Cs...>(std::forward<Func>(fn));}
 
+        /**
+         * @brief invoke a function on all objects that have a sparse component
+         * 
+         * Only the objects that have the component are visited (see `Tiny::ECS::sparse_storage`).
+         * 
+         * @tparam C the sparse component
+         * @tparam Func the type of the function to invoke
+         * @param fn the function to invoke
+         */
+        template <typename C, typename Func>
+        void each_sparse(Func&& fn)
+        {m_reg.each_sparse<C>(std::forward<Func>(fn));}
+
         /**
          * @brief invoke a member function on all instances of a specific component
          * 
@@ -491,6 +1023,52 @@ namespace GLGE {
         void parallel_invoke(Func&& fn) 
         {m_reg.parallel_invoke(std::forward<Func>(fn), getInstance()->employer());}
 
+        /**
+         * @brief invoke a function on all entities that have at least the specified components, skipping chunks where none of them changed
+         * 
+         * @tparam Cs the components required
+         * @tparam Func the type of the function to invoke
+         * @param since the tick of the last run, see `currentTick`
+         * @param fn the function to invoke
+         */
+        template <typename... Cs, typename Func>
+        void each_changed(Registry::tick_t since, Func&& fn)
+        {m_reg.each_changed<Cs...>(since, std::forward<Func>(fn));}
+
+        /**
+         * @brief invoke a function on all entities that have at least the specified components, skipping chunks where none of them changed
+         * 
+         * This function runs in parallel
+         * 
+         * @tparam Cs the components required
+         * @tparam Func the type of the function to invoke
+         * @param since the tick of the last run, see `currentTick`
+         * @param fn the function to invoke
+         */
+        template <typename... Cs, typename Func>
+        void parallel_each_changed(Registry::tick_t since, Func&& fn)
+        {m_reg.parallel_each_changed<Cs...>(since, std::forward<Func>(fn), getInstance()->employer());}
+
+        /**
+         * @brief get the current change tick of the world
+         * 
+         * Systems that only process changes store this at the end of a run and pass it to `each_changed` in the next one.
+         * 
+         * @return `Registry::tick_t` the current change tick
+         */
+        inline Registry::tick_t currentTick() const noexcept
+        {return m_reg.currentTick();}
+
+        /**
+         * @brief start a new change tick
+         * 
+         * Writes after this call are newer than everything returned by `currentTick` before it.
+         * 
+         * @return `Registry::tick_t` the new change tick
+         */
+        inline Registry::tick_t advanceTick() noexcept
+        {return m_reg.advanceTick();}
+
         /**
          * @brief check if a specific name is known
          * 
@@ -507,7 +1085,7 @@ namespace GLGE {
          * @return `const std::string&` the name of the object
          */
         inline const std::string& getObjectName(Object obj) noexcept
-        {return (obj.valid()) ? m_nameIdMap.find(m_reg.get<Component::Name>(obj.m_ent)->name)->second : m_name;}
+        {return (obj.valid()) ? m_nameIdMap.find(m_reg.read<Component::Name>(obj.m_ent)->name)->second : m_name;}
 
         /**
          * @brief get the root node
@@ -529,6 +1107,18 @@ namespace GLGE {
         void add(Object obj, Args&&... args) 
         {m_reg.add<T, Args...>(obj.m_ent, std::forward<Args>(args)...);}
 
+        /**
+         * @brief remove a component from an object
+         * 
+         * @tparam T the type of the component to remove
+         * @param obj the object to remove the component from
+         */
+        template <typename T>
+        void remove(Object obj) {
+            //removing a component that does not exist is a no-op
+            if (m_reg.read<T>(obj.m_ent)) {m_reg.remove<T>(obj.m_ent);}
+        }
+
         /**
          * @brief Get the all objects that have a specific name
          * 
@@ -605,8 +1195,10 @@ namespace GLGE {
          * @param name the name the entity has
          */
         void __remove_name(Tiny::ECS::Entity entity, u32 name) {
-            //get the correct list
-            auto& vec = m_nameRegistry.at(name);
+            //get the correct list, objects created one by one are not registered
+            auto list = m_nameRegistry.find(name);
+            if (list == m_nameRegistry.end()) {return;}
+            auto& vec = list->second;
             //remove the correct name
             for (auto it = vec.begin(); it != vec.end(); ++it)
             {if (*it == entity) {vec.erase(it); break;}}
@@ -669,72 +1261,36 @@ namespace GLGE {
         }
 
         /**
-         * @brief the implementation function to print the children
+         * @brief get the hierarchy node of an object
          * 
-         * @param obj the object to get the children for
-         * @param maxDepth the maximum recursion depth
-         * @param depth the current depth, used for indenting
-         * @return `std::stringstream` the constructed stream
-         */
-        std::stringstream __printChildren(Object obj, u64 maxDepth, u64 depth = 0) {
-            //cache the indent
-            std::stringstream indent;
-            for (size_t i = 0; i < depth; ++i)
-            {indent << "  ";}
-            //the stream to return
-            std::stringstream stream;
-
-            //if the maximal depth is reached, stop
-            if (maxDepth == depth) {
-                stream << indent.str();
-                stream << "...\n";
-                return stream;
-            }
-
-            //get all children
-            std::vector<Object> children = getChildren(obj);
-            //iterate over all children and 1. print the name and 2. recurse
-            for (const auto& child : children) {
-                stream << indent.str();
-                stream << getObjectName(child) << "\n";
-                stream << __printChildren(child, maxDepth, depth+1).str();
-            }
-
-            //return the final stream
-            return stream;
-        }
+         * @param obj the object to get the node for or an invalid object for the root
+         * @return `const Component::HierarchyNode*` a pointer to the node
+         */
+        inline const Component::HierarchyNode* __node(Object obj) noexcept
+        {return obj.valid() ? m_reg.read<Component::HierarchyNode>(obj.m_ent) : &m_root;}
 
         /**
-         * @brief a helper function to invoke a function on all descendants
-         * 
-         * @tparam Func the function to invoke
-         * @param obj the object to pull the children from
-         * @param fn the function to invoke
-         * @param maxDepth the maximum recursion depth
-         * @param depth the current recursion depth
+         * @brief re-build the flattened hierarchy (see `getHierarchyOrder`)
          */
-        template <typename Func>
-        requires (std::is_invocable_v<Func, Object>)
-        void __forAllDescendants(Object obj, Func&& fn, u64 maxDepth, u64 depth) {
-            //if the depth is the max depth, stop
-            if (maxDepth == depth) {return;}
-
-            //get the start node
-            Component::HierarchyNode* hierarchy = nullptr;
-            if (obj.valid())
-            {hierarchy = m_reg.get<Component::HierarchyNode>(obj.m_ent);}
-            else
-            {hierarchy = &m_root;}
-            Tiny::ECS::Entity node = hierarchy->firstChild;
-            //iterate
-            while (!(node == Tiny::ECS::Entity::getInvalid())) {
-                //first, call the function
-                fn(Object(node));
-                //recurse
-                __forAllDescendants(Object(node), fn, maxDepth, depth+1);
-                //then, step
-                node = m_reg.get<Component::HierarchyNode>(node)->nextSibling;
+        void __rebuildHierarchyOrder() {
+            //the order itself is used as the queue of a breadth first walk, so the objects come out sorted by depth
+            m_hierarchyOrder.clear();
+            for (Object child : children(Object()))
+            {m_hierarchyOrder.push_back(HierarchyEntry{child, UINT32_MAX, 0});}
+            for (size_t i = 0; i < m_hierarchyOrder.size(); ++i) {
+                u32 depth = m_hierarchyOrder[i].depth + 1;
+                for (Object child : children(m_hierarchyOrder[i].object))
+                {m_hierarchyOrder.push_back(HierarchyEntry{child, u32(i), depth});}
             }
+
+            //store where each level starts
+            m_hierarchyLevels.clear();
+            for (size_t i = 0; i < m_hierarchyOrder.size(); ++i) {
+                if ((i == 0) || (m_hierarchyOrder[i].depth != m_hierarchyOrder[i - 1].depth))
+                {m_hierarchyLevels.push_back(i);}
+            }
+            m_hierarchyLevels.push_back(m_hierarchyOrder.size());
+            m_orderVersion = m_hierarchyVersion;
         }
 
         /**
@@ -745,6 +1301,7 @@ namespace GLGE {
          * @param exists `true` if the object exists allready, `false` if it is brand new
          */
         void __setParent(Object subject, Object parent, bool exists) {
+            ++m_hierarchyVersion;
             //get the nodes
             Component::HierarchyNode* parentNode = m_reg.get<Component::HierarchyNode>(parent.m_ent);
             Component::HierarchyNode* childNode = m_reg.get<Component::HierarchyNode>(subject.m_ent);
@@ -802,6 +1359,19 @@ namespace GLGE {
 
         //objects are friends
         friend class Object;
+        //world assets serialize the raw storage
+        friend class WorldAsset;
+        //transforms are propagated directly on the raw storage
+        friend class System::TransformPropagator;
+        //command buffers apply structural changes directly on the raw storage
+        friend class CommandBuffer;
+        //prefabs copy the raw storage
+        friend class Prefab;
+        //spatial indices read the world transforms directly from the raw storage
+        friend class SpatialIndex;
+        //queries iterate the raw storage
+        template <typename... Cs>
+        friend class Query;
         //grant special access to name components
         friend class Component::Name;
 
@@ -810,6 +1380,23 @@ namespace GLGE {
          */
         Component::HierarchyNode m_root;
 
+        /**
+         * @brief a counter that is increased by every change to the hierarchy
+         */
+        u64 m_hierarchyVersion = 0;
+        /**
+         * @brief the hierarchy version the flattened hierarchy was built for
+         */
+        u64 m_orderVersion = UINT64_MAX;
+        /**
+         * @brief all objects of the hierarchy sorted by depth, then by parent
+         */
+        std::vector<HierarchyEntry> m_hierarchyOrder;
+        /**
+         * @brief the start of every level in the flattened hierarchy, followed by the amount of objects
+         */
+        std::vector<size_t> m_hierarchyLevels;
+
         /**
          * @brief store the name of the world
          */
@@ -818,7 +1405,7 @@ namespace GLGE {
         /**
          * @brief store all the entities
          */
-        Tiny::ECS::World m_reg;
+        Registry m_reg;
 
         /**
          * @brief a mutex to make all name operations thread safe
@@ -843,6 +1430,102 @@ namespace GLGE {
 
     };
 
+    /**
+     * @brief a persistent query for all objects of a world that have at least a set of components
+     * 
+     * Unlike `World::each` and `World::parallel_each`, the query remembers which archtypes match its components and only 
+     * checks archtypes that where created since the last iteration. Store it for systems that run every frame. 
+     * 
+     * @warning the query must not outlive the world it was created for
+     * 
+     * @tparam Cs the components required
+     */
+    template <typename... Cs>
+    class Query {
+    public:
+
+        /**
+         * @brief Construct a new Query
+         * 
+         * @param world the world to query
+         */
+        Query(World& world)
+         : m_world(&world), m_query(world.m_reg)
+        {}
+
+        /**
+         * @brief invoke a function on all objects that match the query
+         * 
+         * @tparam Func the type of the function to invoke
+         * @param fn the function to invoke
+         */
+        template <typename Func>
+        inline void each(Func&& fn)
+        {m_query.each(std::forward<Func>(fn));}
+
+        /**
+         * @brief invoke a function on all objects that match the query
+         * 
+         * This function runs in parallel
+         * 
+         * @tparam Func the type of the function to invoke
+         * @param fn the function to invoke
+         */
+        template <typename Func>
+        inline void parallel_each(Func&& fn)
+        {m_query.parallel_each(std::forward<Func>(fn), m_world->getInstance()->employer());}
+
+        /**
+         * @brief only visit objects that have all of a set of sparse components
+         * 
+         * @tparam Ts the sparse components that are required (see `Tiny::ECS::sparse_storage`)
+         * @return `Query&` a reference to this query
+         */
+        template <typename... Ts>
+        inline Query& with()
+        {m_query.template with<Ts...>(); return *this;}
+
+        /**
+         * @brief skip objects that have any of a set of sparse components
+         * 
+         * @tparam Ts the sparse components that are excluded (see `Tiny::ECS::sparse_storage`)
+         * @return `Query&` a reference to this query
+         */
+        template <typename... Ts>
+        inline Query& without()
+        {m_query.template without<Ts...>(); return *this;}
+
+        /**
+         * @brief count the objects that match the query
+         * 
+         * Sparse filters are not taken into account. 
+         * 
+         * @return `size_t` the amount of matching objects
+         */
+        inline size_t count()
+        {return m_query.count();}
+
+        /**
+         * @brief get the amount of archtypes that match the query
+         * 
+         * @return `size_t` the amount of matching archtypes
+         */
+        inline size_t getArchtypeCount()
+        {return m_query.archtypes().size();}
+
+    protected:
+
+        /**
+         * @brief the world the query belongs to
+         */
+        World* m_world;
+        /**
+         * @brief the query on the raw storage
+         */
+        Registry::Query<Cs...> m_query;
+
+    };
+
 }
 
 #endif
\ No newline at end of file
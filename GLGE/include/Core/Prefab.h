@@ -0,0 +1,119 @@
+/**
+ * @file Prefab.h
+ * @author DM8AT
+ * @brief define prefabs to spawn copies of an object hierarchy in bulk
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//header guard
+#ifndef _GLGE_CORE_PREFAB_
+#define _GLGE_CORE_PREFAB_
+
+//add common stuff
+#include "Common.h"
+//add objects and worlds
+#include "Object.h"
+//add unique pointers
+#include <memory>
+
+/**
+ * @brief use the libraries namespace
+ */
+namespace GLGE {
+
+    /**
+     * @brief a snapshot of an object and all of its children that can be spawned many times at once
+     * 
+     * The components of all captured objects are copied into a private registry. Spawning creates the copies of every
+     * captured object in one go, copies the component data column by column and links the hierarchy in a single batch.
+     * Names are only resolved once per captured object, no matter how many copies are spawned.
+     * 
+     * All components of the captured objects must be copy assignable.
+     */
+    class Prefab {
+    public:
+
+        /**
+         * @brief Construct a new, empty Prefab
+         */
+        Prefab();
+
+        /**
+         * @brief Construct a new Prefab from an object and all of its children
+         * 
+         * @param world the world the object belongs to
+         * @param root the root object of the prefab
+         */
+        Prefab(World& world, Object root);
+
+        /**
+         * @brief replace the content of the prefab with an object and all of its children
+         * 
+         * Later changes to the objects don't change the prefab.
+         * 
+         * @param world the world the object belongs to
+         * @param root the root object of the prefab
+         */
+        void capture(World& world, Object root);
+
+        /**
+         * @brief spawn a lot of copies of the prefab
+         * 
+         * @warning this is a structural change, it must not be called while the world is iterated
+         * 
+         * @param world the world to spawn the copies in (does not need to be the world the prefab was captured from)
+         * @param count the amount of copies to spawn
+         * @param parent the object all copies are attached to or an invalid object to attach them to the root
+         * @return `std::vector<Object>` the root objects of all copies
+         */
+        std::vector<Object> instantiate(World& world, size_t count, Object parent = Object());
+
+        /**
+         * @brief get the amount of objects a single copy of the prefab consists of
+         * 
+         * @return `size_t` the amount of captured objects
+         */
+        inline size_t getObjectCount() const noexcept
+        {return m_nodes.size();}
+
+    protected:
+
+        /**
+         * @brief a single captured object
+         */
+        struct Node {
+            /**
+             * @brief the entity that holds the components in the private registry
+             */
+            Tiny::ECS::Entity entity = Tiny::ECS::Entity::getInvalid();
+            /**
+             * @brief the index of the parent node, the root has no parent
+             */
+            size_t parent = SIZE_MAX;
+            /**
+             * @brief the name of the object
+             */
+            std::string name;
+            /**
+             * @brief the columns of all components of the object, without names and hierarchy nodes
+             */
+            std::vector<Registry::column_t> columns;
+        };
+
+        /**
+         * @brief the registry that stores the components of all captured objects
+         */
+        std::unique_ptr<Registry> m_reg;
+        /**
+         * @brief all captured objects, parents allways come before their children
+         */
+        std::vector<Node> m_nodes;
+
+    };
+
+}
+
+#endif
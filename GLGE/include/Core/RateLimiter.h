@@ -95,7 +95,7 @@ namespace GLGE {
                 GLGE_PROFILER_SCOPE_NAMED("Computing smoothed delta time / smoothed FPS");
 
                 //store the sample
-                memcpy(m_smoothBuffer+1, m_smoothBuffer, sizeof(*m_smoothBuffer)*(SMOOTHING_ACCUM_COUNT-1));
+                memmove(m_smoothBuffer+1, m_smoothBuffer, sizeof(*m_smoothBuffer)*(SMOOTHING_ACCUM_COUNT-1));
                 m_smoothBuffer[0] = std::chrono::duration_cast<std::chrono::microseconds>(sleepDelta).count();
                 //store the new amount of accumulated items
                 ++m_smoothCount;
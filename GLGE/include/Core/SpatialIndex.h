@@ -0,0 +1,316 @@
+/**
+ * @file SpatialIndex.h
+ * @author DM8AT
+ * @brief define a spatial index to quickly find objects in a region of a world
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//header guard
+#ifndef _GLGE_CORE_SPATIAL_INDEX_
+#define _GLGE_CORE_SPATIAL_INDEX_
+
+//add common stuff
+#include "Common.h"
+//add axis aligned bounding boxes
+#include "AABB.h"
+//add transforms
+#include "Transform.h"
+//add the grid cells
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief use the libraries namespace
+ */
+namespace GLGE {
+
+    /**
+     * @brief store the bounds of an object relative to its own origin
+     * 
+     * Objects without bounds are indexed as a single point at their position. The bounds are rotated and scaled with the
+     * world transform of the object.
+     */
+    struct Bounds {
+        /**
+         * @brief Construct new Bounds
+         */
+        Bounds() = default;
+
+        /**
+         * @brief Construct new Bounds
+         * 
+         * @param _box the box relative to the origin of the object
+         */
+        Bounds(const AABB& _box)
+         : box(_box)
+        {}
+
+        /**
+         * @brief the box relative to the origin of the object
+         */
+        AABB box = AABB(vec3(0), vec3(0));
+    };
+
+    /**
+     * @brief a view frustum described by six planes that point inwards
+     */
+    struct Frustum {
+        /**
+         * @brief Construct a new Frustum
+         */
+        Frustum() = default;
+
+        /**
+         * @brief Construct a new Frustum from a view-projection matrix
+         * 
+         * @param viewProj the matrix that transforms world space to clip space
+         */
+        Frustum(const glm::mat4& viewProj);
+
+        /**
+         * @brief check if a box is at least partially inside the frustum
+         * 
+         * This is conservative, boxes close to the corners of the frustum may be reported as inside.
+         * 
+         * @param min the minimum corner of the box
+         * @param max the maximum corner of the box
+         * @return `true` if the box may be inside, `false` if it is certainly outside
+         */
+        bool intersects(const vec3& min, const vec3& max) const noexcept;
+
+        /**
+         * @brief the left, right, bottom, top, near and far planes as (normal, distance)
+         */
+        vec4 planes[6] = {};
+    };
+
+    /**
+     * @brief an index over the world transforms of a world that answers "which objects are near this" queries
+     * 
+     * The index is a loose, hashed uniform grid. Every object is stored in the cell that contains the center of its
+     * bounds, objects that are larger than a cell are kept in a separate list. Only the objects whose world transform or
+     * bounds chunk was written to since the last update (see `World::each_changed`) are re-inserted, so static objects
+     * cost nothing.
+     * 
+     * The index must be updated after the world transforms were (see `System::TransformPropagator`) and before it is
+     * queried. Objects returned by queries are valid until the next structural change of the world.
+     */
+    class SpatialIndex {
+    public:
+
+        /**
+         * @brief Construct a new Spatial Index
+         * 
+         * @param cellSize the edge length of a single grid cell. Should be about the size of a typical query.
+         */
+        SpatialIndex(float cellSize = 16.f);
+
+        /**
+         * @brief update all objects that moved, where created or where removed since the last update
+         * 
+         * @param world the world to index
+         */
+        void update(World& world);
+
+        /**
+         * @brief force a full re-build on the next update
+         */
+        inline void invalidate() noexcept
+        {m_world = nullptr;}
+
+        /**
+         * @brief find all objects whose bounds intersect a sphere
+         * 
+         * @param center the center of the sphere in world space
+         * @param radius the radius of the sphere
+         * @param out a vector to append the found objects to
+         */
+        void queryRadius(const vec3& center, float radius, std::vector<Object>& out) const;
+
+        /**
+         * @brief find all objects whose bounds intersect a sphere
+         * 
+         * @param center the center of the sphere in world space
+         * @param radius the radius of the sphere
+         * @return `std::vector<Object>` all found objects
+         */
+        inline std::vector<Object> queryRadius(const vec3& center, float radius) const
+        {std::vector<Object> out; queryRadius(center, radius, out); return out;}
+
+        /**
+         * @brief find all objects whose bounds intersect an axis aligned box
+         * 
+         * @param box the box in world space
+         * @param out a vector to append the found objects to
+         */
+        void queryAABB(const AABB& box, std::vector<Object>& out) const;
+
+        /**
+         * @brief find all objects whose bounds intersect an axis aligned box
+         * 
+         * @param box the box in world space
+         * @return `std::vector<Object>` all found objects
+         */
+        inline std::vector<Object> queryAABB(const AABB& box) const
+        {std::vector<Object> out; queryAABB(box, out); return out;}
+
+        /**
+         * @brief find all objects whose bounds may be inside a frustum
+         * 
+         * @param frustum the frustum in world space
+         * @param out a vector to append the found objects to
+         */
+        void queryFrustum(const Frustum& frustum, std::vector<Object>& out) const;
+
+        /**
+         * @brief find all objects whose bounds may be inside a frustum
+         * 
+         * @param frustum the frustum in world space
+         * @return `std::vector<Object>` all found objects
+         */
+        inline std::vector<Object> queryFrustum(const Frustum& frustum) const
+        {std::vector<Object> out; queryFrustum(frustum, out); return out;}
+
+        /**
+         * @brief get the amount of indexed objects
+         * 
+         * @return `size_t` the amount of objects with a world transform at the last update
+         */
+        inline size_t getObjectCount() const noexcept
+        {return m_records.size();}
+
+        /**
+         * @brief get the amount of objects that where re-inserted by the last update
+         * 
+         * @return `size_t` the amount of re-inserted objects
+         */
+        inline size_t getUpdatedCount() const noexcept
+        {return m_updated;}
+
+        /**
+         * @brief get the edge length of a single cell
+         * 
+         * @return `float` the size of a cell
+         */
+        inline float getCellSize() const noexcept
+        {return m_cellSize;}
+
+    protected:
+
+        /**
+         * @brief the state of a single indexed object
+         */
+        struct Record {
+            /**
+             * @brief the entity of the object
+             */
+            Tiny::ECS::Entity entity = Tiny::ECS::Entity::getInvalid();
+            /**
+             * @brief the key of the cell the object is stored in
+             */
+            u64 cell = 0;
+            /**
+             * @brief the index of the object inside of its cell
+             */
+            u32 slot = 0;
+            /**
+             * @brief the update the object was last seen in
+             */
+            u32 stamp = 0;
+            /**
+             * @brief the minimum corner of the bounds in world space
+             */
+            vec3 min = vec3(0);
+            /**
+             * @brief the maximum corner of the bounds in world space
+             */
+            vec3 max = vec3(0);
+        };
+
+        /**
+         * @brief compute the key of the cell that contains a position
+         * 
+         * @param pos the position in world space
+         * @return `u64` the key of the cell
+         */
+        u64 __cellKey(const vec3& pos) const noexcept;
+
+        /**
+         * @brief insert an object or move it to the cell that matches its new bounds
+         * 
+         * @param ent the entity of the object
+         * @param min the minimum corner of the bounds in world space
+         * @param max the maximum corner of the bounds in world space
+         */
+        void __insert(Tiny::ECS::Entity ent, const vec3& min, const vec3& max);
+
+        /**
+         * @brief remove an object from the index
+         * 
+         * @param it an iterator to the record of the object
+         */
+        void __erase(std::unordered_map<u32, Record>::iterator it);
+
+        /**
+         * @brief remove an object from the cell it is stored in, the record is kept
+         * 
+         * @param rec the record of the object
+         */
+        void __unlink(const Record& rec);
+
+        /**
+         * @brief visit all objects in the cells that may hold objects overlapping a box
+         * 
+         * @tparam Func the type of the function, called as `fn(const Record&)`
+         * @param min the minimum corner of the box
+         * @param max the maximum corner of the box
+         * @param fn the function to call for each candidate
+         */
+        template <typename Func>
+        void __visit(const vec3& min, const vec3& max, Func&& fn) const;
+
+        /**
+         * @brief the edge length of a single cell
+         */
+        float m_cellSize = 16.f;
+        /**
+         * @brief the world the index belongs to
+         */
+        World* m_world = nullptr;
+        /**
+         * @brief the tick of the last update, everything written later is out of date
+         */
+        Registry::tick_t m_lastTick = 0;
+        /**
+         * @brief the counter of updates, used to find removed objects
+         */
+        u32 m_stamp = 0;
+        /**
+         * @brief all objects, mapped from the blob of their entity to their record
+         */
+        std::unordered_map<u32, Record> m_records;
+        /**
+         * @brief the entity blobs of the objects of each cell
+         */
+        std::unordered_map<u64, std::vector<u32>> m_cells;
+        /**
+         * @brief the entity blobs of all objects that are larger than a cell
+         */
+        std::vector<u32> m_large;
+        /**
+         * @brief the entities of all archtypes at the last update, used to find removed objects
+         */
+        std::vector<std::vector<Tiny::ECS::Entity>> m_snapshot;
+        /**
+         * @brief the amount of re-inserted objects of the last update
+         */
+        size_t m_updated = 0;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,315 @@
+/**
+ * @file SystemScheduler.h
+ * @author DM8AT
+ * @brief define a scheduler that runs systems that don't access the same components concurrently
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//header guard
+#ifndef _GLGE_CORE_SYSTEM_SCHEDULER_
+#define _GLGE_CORE_SYSTEM_SCHEDULER_
+
+//add common stuff
+#include "Common.h"
+//add type hashes
+#include "TypeInfo.h"
+//add objects and worlds
+#include "Object.h"
+//add functions
+#include <functional>
+
+/**
+ * @brief use the libraries namespace
+ */
+namespace GLGE {
+
+    /**
+     * @brief describe which components a system reads and writes
+     * 
+     * Two systems conflict if one of them writes a component the other one reads or writes. Systems that don't
+     * conflict may run at the same time.
+     */
+    class SystemAccess {
+    public:
+
+        /**
+         * @brief Construct a new System Access
+         */
+        SystemAccess() = default;
+
+        /**
+         * @brief add components that the system reads
+         * 
+         * @tparam Cs the components that are read
+         * @return `SystemAccess&` a reference to this access description
+         */
+        template <typename... Cs>
+        SystemAccess& read() {
+            (m_reads.push_back(getTypeHash64<Cs>()), ...);
+            return *this;
+        }
+
+        /**
+         * @brief add components that the system writes
+         * 
+         * @tparam Cs the components that are written
+         * @return `SystemAccess&` a reference to this access description
+         */
+        template <typename... Cs>
+        SystemAccess& write() {
+            (m_writes.push_back(getTypeHash64<Cs>()), ...);
+            return *this;
+        }
+
+        /**
+         * @brief mark the system as exclusive
+         * 
+         * An exclusive system conflicts with every other system. This is required for systems that make structural
+         * changes (creating or destroying objects, adding or removing components).
+         * 
+         * @return `SystemAccess&` a reference to this access description
+         */
+        inline SystemAccess& exclusive() noexcept
+        {m_exclusive = true; return *this;}
+
+        /**
+         * @brief check if two systems can not run at the same time
+         * 
+         * @param other the access of the other system
+         * @return `true` if the systems conflict, `false` if they can run concurrently
+         */
+        bool conflicts(const SystemAccess& other) const noexcept;
+
+        /**
+         * @brief get the hashes of all read components
+         * 
+         * @return `const std::vector<u64>&` the hashes of the read components
+         */
+        inline const std::vector<u64>& getReads() const noexcept
+        {return m_reads;}
+
+        /**
+         * @brief get the hashes of all written components
+         * 
+         * @return `const std::vector<u64>&` the hashes of the written components
+         */
+        inline const std::vector<u64>& getWrites() const noexcept
+        {return m_writes;}
+
+        /**
+         * @brief check if the system is exclusive
+         * 
+         * @return `true` if the system conflicts with all other systems, `false` otherwise
+         */
+        inline bool isExclusive() const noexcept
+        {return m_exclusive;}
+
+    protected:
+
+        /**
+         * @brief the type hashes of all read components
+         */
+        std::vector<u64> m_reads;
+        /**
+         * @brief the type hashes of all written components
+         */
+        std::vector<u64> m_writes;
+        /**
+         * @brief `true` if the system conflicts with everything
+         */
+        bool m_exclusive = false;
+
+    };
+
+    /**
+     * @brief a registry of systems that runs them on the job system of the world's instance
+     * 
+     * Each run, the conflict graph of all enabled systems is built. A system depends on every system that was added
+     * before it and conflicts with it, so the result is the same as running all systems in the order they where
+     * added. The systems are grouped into levels by their dependencies and the systems of a single level run
+     * concurrently. Systems may still use `World::parallel_each` internally.
+     */
+    class SystemScheduler {
+    public:
+
+        /**
+         * @brief the type of function a system runs
+         */
+        using SystemFunc = std::function<void(World&)>;
+
+        /**
+         * @brief the timing statistics of a single system
+         */
+        struct Timing {
+            /**
+             * @brief the name of the system
+             */
+            std::string name;
+            /**
+             * @brief the duration of the last run in milliseconds
+             */
+            double last = 0.;
+            /**
+             * @brief the average duration of all runs in milliseconds
+             */
+            double average = 0.;
+            /**
+             * @brief the longest duration of a single run in milliseconds
+             */
+            double max = 0.;
+            /**
+             * @brief the amount of runs
+             */
+            u64 calls = 0;
+        };
+
+        /**
+         * @brief Construct a new System Scheduler
+         */
+        SystemScheduler() = default;
+
+        /**
+         * @brief add a new system
+         * 
+         * @param name the name of the system, used for the timing report
+         * @param access the components the system accesses
+         * @param func the function to run
+         * @return `u64` an identifier for the system
+         */
+        u64 add(const std::string& name, const SystemAccess& access, const SystemFunc& func);
+
+        /**
+         * @brief remove a system
+         * 
+         * @param id the identifier of the system to remove
+         */
+        void remove(u64 id);
+
+        /**
+         * @brief enable or disable a system
+         * 
+         * Disabled systems are not run and don't take part in the conflict graph.
+         * 
+         * @param id the identifier of the system
+         * @param enabled `true` to run the system, `false` to skip it
+         */
+        void setEnabled(u64 id, bool enabled);
+
+        /**
+         * @brief run all enabled systems once
+         * 
+         * If the world has no instance, all systems run in order on the calling thread. The first exception a system
+         * throws is re-thrown after the current level finished.
+         * 
+         * @param world the world to run the systems on
+         */
+        void run(World& world);
+
+        /**
+         * @brief get the timing statistics of all systems
+         * 
+         * @return `std::vector<Timing>` the timings in the order the systems where added
+         */
+        std::vector<Timing> getTimings() const;
+
+        /**
+         * @brief get a human readable report of all system timings
+         * 
+         * @return `std::string` the timing report, one system per line
+         */
+        std::string getTimingReport() const;
+
+        /**
+         * @brief reset the timing statistics of all systems
+         */
+        void resetTimings() noexcept;
+
+        /**
+         * @brief get the duration of the last run of all systems
+         * 
+         * @return `double` the duration of the last run in milliseconds
+         */
+        inline double getLastRunTime() const noexcept
+        {return m_lastRun;}
+
+        /**
+         * @brief get the amount of levels the last run was split into
+         * 
+         * @return `size_t` the amount of levels, each level waited for the previous one
+         */
+        inline size_t getLevelCount() const noexcept
+        {return m_levelCount;}
+
+    protected:
+
+        /**
+         * @brief store a single registered system
+         */
+        struct Entry {
+            /**
+             * @brief the identifier of the system
+             */
+            u64 id = 0;
+            /**
+             * @brief the accessed components
+             */
+            SystemAccess access;
+            /**
+             * @brief the function to run
+             */
+            SystemFunc func;
+            /**
+             * @brief `true` if the system runs, `false` if it is skipped
+             */
+            bool enabled = true;
+            /**
+             * @brief the timing statistics
+             */
+            Timing timing;
+            /**
+             * @brief the summed up duration of all runs in milliseconds
+             */
+            double total = 0.;
+        };
+
+        /**
+         * @brief find a system by its identifier
+         * 
+         * @param id the identifier of the system
+         * @return `Entry&` a reference to the system
+         */
+        Entry& __find(u64 id);
+
+        /**
+         * @brief run a single system and record its timing
+         * 
+         * @param entry the system to run
+         * @param world the world to run the system on
+         */
+        static void __runSystem(Entry& entry, World& world);
+
+        /**
+         * @brief all registered systems in the order they where added
+         */
+        std::vector<Entry> m_systems;
+        /**
+         * @brief the identifier of the next added system
+         */
+        u64 m_nextId = 0;
+        /**
+         * @brief the duration of the last run in milliseconds
+         */
+        double m_lastRun = 0.;
+        /**
+         * @brief the amount of levels of the last run
+         */
+        size_t m_levelCount = 0;
+
+    };
+
+}
+
+#endif
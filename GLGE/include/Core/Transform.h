@@ -194,10 +194,142 @@ namespace GLGE {
         /**
          * @brief a system that bakes all transforms to the world transforms
          * 
+         * All transforms are re-computed. Use a `TransformPropagator` to only update the ones that changed.
+         * 
          * @param world a reference to the world to operate on
          */
         void BakeTransforms(World& world);
 
+        /**
+         * @brief a system that keeps the world transforms of a world up to date
+         * 
+         * The hierarchy is flattened into depth levels that are processed in order, the objects of a single level are
+         * processed in parallel. Only objects whose transform chunk was written to since the last update (or whose parent
+         * changed) are re-computed, so static objects cost nothing. The flattened hierarchy is cached and only rebuilt
+         * after structural changes.
+         */
+        class TransformPropagator {
+        public:
+
+            /**
+             * @brief Construct a new Transform Propagator
+             */
+            TransformPropagator() = default;
+
+            /**
+             * @brief update all world transforms that are out of date
+             * 
+             * Objects with a `Transform` but without a `WorldTransform` get one.
+             * 
+             * @param world the world to update
+             */
+            void update(World& world);
+
+            /**
+             * @brief force a full re-computation on the next update
+             */
+            inline void invalidate() noexcept
+            {m_world = nullptr;}
+
+            /**
+             * @brief get the amount of world transforms that where re-computed by the last update
+             * 
+             * @return `size_t` the amount of re-computed transforms
+             */
+            inline size_t getUpdatedCount() const noexcept
+            {return m_updated;}
+
+        protected:
+
+            /**
+             * @brief a single object with a transform in the flattened hierarchy
+             */
+            struct Node {
+                /**
+                 * @brief the entity of the object
+                 */
+                Tiny::ECS::Entity entity = Tiny::ECS::Entity::getInvalid();
+                /**
+                 * @brief the index of the closest ancestor with a transform, `UINT32_MAX` if the object is a root
+                 */
+                u32 parent = UINT32_MAX;
+                /**
+                 * @brief the archtype the object is stored in
+                 */
+                Registry::archtype_t archtype = 0;
+                /**
+                 * @brief the chunk of the archtype the object is stored in
+                 */
+                u32 chunk = 0;
+                /**
+                 * @brief a pointer to the local transform (stable until the next structural change)
+                 */
+                const Transform* local = nullptr;
+                /**
+                 * @brief a pointer to the world transform (stable until the next structural change)
+                 */
+                WorldTransform* global = nullptr;
+            };
+
+            /**
+             * @brief add a world transform to all objects that have a transform but no world transform
+             * 
+             * @param world the world to operate on
+             */
+            void __addMissing(World& world);
+
+            /**
+             * @brief check if the hierarchy or the archtype layout changed since the last update
+             * 
+             * @param world the world to check
+             * @return `true` if the flattened hierarchy must be rebuilt, `false` otherwise
+             */
+            bool __isStale(World& world) const;
+
+            /**
+             * @brief rebuild the flattened hierarchy
+             * 
+             * @param world the world to flatten
+             */
+            void __rebuild(World& world);
+
+            /**
+             * @brief the world the cached data belongs to
+             */
+            World* m_world = nullptr;
+            /**
+             * @brief the tick of the last update, everything written later is out of date
+             */
+            Registry::tick_t m_lastTick = 0;
+            /**
+             * @brief all objects with a transform, sorted by depth. Inside a level they are in storage order.
+             */
+            std::vector<Node> m_nodes;
+            /**
+             * @brief the start index of each level in the nodes, followed by the amount of nodes
+             */
+            std::vector<size_t> m_levels;
+            /**
+             * @brief store for each node if it was re-computed in the current update
+             */
+            std::vector<u8> m_dirty;
+            /**
+             * @brief the amount of objects in each archtype at the last rebuild
+             */
+            std::vector<size_t> m_archSizes;
+            /**
+             * @brief the storage versions of the transform and world transform columns at the last rebuild
+             * 
+             * Compaction moves the columns without changing the archtypes, so the cached pointers are checked against them
+             */
+            u16 m_columnVersions[2] = {0, 0};
+            /**
+             * @brief the amount of re-computed transforms of the last update
+             */
+            size_t m_updated = 0;
+
+        };
+
     };
 
 }
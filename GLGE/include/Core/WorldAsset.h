@@ -51,11 +51,14 @@ namespace GLGE {
             /**
              * @brief add a specific component type to the type registry
              * 
+             * Components in sparse sets (see `Tiny::ECS::sparse_storage`) are not stored by world assets and can't be added. 
+             * 
              * @tparam T the type to add
              */
             template <typename T>
             requires is_serializable_component_v<T>
             void addType() {
+                static_assert(!Tiny::ECS::sparse_storage_v<T>, "World assets only store components in archtypes, sparse components would be lost on save");
                 //get the entry
                 TypeEntry& entry = m_typeEntries[getTypeHash64<T>()];
                 //write the functions
@@ -65,18 +68,97 @@ namespace GLGE {
                 });
                 //for the selected type, invoke the serialize function
                 entry.storeFn = static_cast<PFN_Serialize>([](Tiny::ECS::Entity entity, std::vector<u8>& buffer, World* world) {
-                    //get the entity
-                    T* el = world->get<T>(Object(entity));
+                    //get the entity (storing does not change it, so it is only read)
+                    T* el = const_cast<T*>(world->read<T>(Object(entity)));
                     //if it exists, store it
                     if (el) {static_cast<SerializableComponent*>(el)->store(buffer);}
                 });
                 //for the selected type, invoke the deserialize function
                 entry.loadFn  = static_cast<PFN_Deserialize>([](Tiny::ECS::Entity entity, const std::span<const u8>& buffer, World* world) {
-                    //add the type to the entity
-                    world->add<T>(Object(entity));
+                    //add the type to the entity if it does not have it yet
+                    if (!world->read<T>(Object(entity))) {world->add<T>(Object(entity));}
                     //then get it and load
                     static_cast<SerializableComponent*>(world->get<T>(Object(entity)))->load(buffer);
                 });
+                //deserialize into a component that already exists
+                entry.loadInPlaceFn = static_cast<PFN_DeserializeInPlace>([](Tiny::ECS::Entity entity, const std::span<const u8>& buffer, World* world) {
+                    static_cast<SerializableComponent*>(world->get<T>(Object(entity)))->load(buffer);
+                });
+                //make the column of the type known to a world
+                entry.columnFn = static_cast<PFN_RegisterColumn>([](World* world) {return world->registerComponent<T>();});
+                //remove the type from an entity
+                entry.removeFn = static_cast<PFN_Remove>([](Tiny::ECS::Entity entity, World* world) {world->remove<T>(Object(entity));});
+                //serialize a whole column element by element
+                entry.storeColumnFn = static_cast<PFN_SerializeColumn>([](World* world, std::span<const Tiny::ECS::Entity> entities, std::vector<u8>& buffer, std::vector<u32>& sizes) {
+                    sizes.reserve(entities.size());
+                    for (const Tiny::ECS::Entity& ent : entities) {
+                        size_t start = buffer.size();
+                        static_cast<SerializableComponent*>(const_cast<T*>(world->read<T>(Object(ent))))->store(buffer);
+                        sizes.push_back(u32(buffer.size() - start));
+                    }
+                });
+                //deserialize a whole column element by element
+                entry.loadColumnFn = static_cast<PFN_DeserializeColumn>([](World* world, std::span<const Object> objects, std::span<const u8> data, const std::vector<u32>& sizes) {
+                    size_t stride = (sizes.empty() && !objects.empty()) ? (data.size() / objects.size()) : 0;
+                    size_t offs = 0;
+                    for (size_t i = 0; i < objects.size(); ++i) {
+                        size_t size = sizes.empty() ? stride : sizes[i];
+                        if (offs + size > data.size())
+                        {throw Exception("Invalid column size", "GLGE::WorldAsset::ComponentRegistry::loadColumnFn");}
+                        static_cast<SerializableComponent*>(world->get<T>(objects[i]))->load(data.subspan(offs, size));
+                        offs += size;
+                    }
+                });
+            }
+
+            /**
+             * @brief add a trivially copyable component type to the type registry
+             * 
+             * The component is serialized as its raw bytes. In the columnar format the components of a whole archtype are
+             * copied with a single `memcpy`. Components in sparse sets can't be added. 
+             * 
+             * @tparam T the type to add
+             */
+            template <typename T>
+            requires (!is_serializable_component_v<T> && std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+            void addType() {
+                static_assert(!Tiny::ECS::sparse_storage_v<T>, "World assets only store components in archtypes, sparse components would be lost on save");
+                //get the entry
+                TypeEntry& entry = m_typeEntries[getTypeHash64<T>()];
+                //write the functions
+                entry.gatherFn = static_cast<PFN_GetAllOf>([](World* world, std::vector<Object>* gathered) {
+                    world->each<T>([gathered](const Tiny::ECS::Entity& ent, const T&) {gathered->push_back(Object(ent));});
+                });
+                entry.storeFn = static_cast<PFN_Serialize>([](Tiny::ECS::Entity entity, std::vector<u8>& buffer, World* world) {
+                    const T* el = world->read<T>(Object(entity));
+                    if (el) {buffer.insert(buffer.end(), reinterpret_cast<const u8*>(el), reinterpret_cast<const u8*>(el) + sizeof(T));}
+                });
+                entry.loadFn = static_cast<PFN_Deserialize>([](Tiny::ECS::Entity entity, const std::span<const u8>& buffer, World* world) {
+                    if (buffer.size() != sizeof(T))
+                    {throw Exception("Invalid size for a raw component", "GLGE::WorldAsset::ComponentRegistry::loadFn");}
+                    if (!world->read<T>(Object(entity))) {world->add<T>(Object(entity));}
+                    memcpy(world->get<T>(Object(entity)), buffer.data(), sizeof(T));
+                });
+                entry.loadInPlaceFn = static_cast<PFN_DeserializeInPlace>([](Tiny::ECS::Entity entity, const std::span<const u8>& buffer, World* world) {
+                    if (buffer.size() != sizeof(T))
+                    {throw Exception("Invalid size for a raw component", "GLGE::WorldAsset::ComponentRegistry::loadInPlaceFn");}
+                    memcpy(world->get<T>(Object(entity)), buffer.data(), sizeof(T));
+                });
+                entry.columnFn = static_cast<PFN_RegisterColumn>([](World* world) {return world->registerComponent<T>();});
+                entry.removeFn = static_cast<PFN_Remove>([](Tiny::ECS::Entity entity, World* world) {world->remove<T>(Object(entity));});
+                //the components of an archtype are contiguous, so the whole column is a single copy
+                entry.storeColumnFn = static_cast<PFN_SerializeColumn>([](World* world, std::span<const Tiny::ECS::Entity> entities, std::vector<u8>& buffer, std::vector<u32>&) {
+                    if (entities.empty()) {return;}
+                    const u8* first = reinterpret_cast<const u8*>(world->read<T>(Object(entities.front())));
+                    buffer.insert(buffer.end(), first, first + entities.size()*sizeof(T));
+                });
+                entry.loadColumnFn = static_cast<PFN_DeserializeColumn>([](World* world, std::span<const Object> objects, std::span<const u8> data, const std::vector<u32>&) {
+                    if (objects.empty()) {return;}
+                    if (data.size() != objects.size()*sizeof(T))
+                    {throw Exception("Invalid column size", "GLGE::WorldAsset::ComponentRegistry::loadColumnFn");}
+                    //the objects where created together, so their components are contiguous too
+                    memcpy(world->get<T>(objects.front()), data.data(), data.size());
+                });
             }
 
         protected:
@@ -97,6 +179,8 @@ namespace GLGE {
 
             /**
              * @brief define the type used for the type-erased load function
+             * 
+             * The component is added if the entity does not have it yet
              */
             typedef void (*PFN_Deserialize)(Tiny::ECS::Entity entity, const std::span<const u8>& buffer, World* world);
 
@@ -105,6 +189,35 @@ namespace GLGE {
              */
             typedef void (*PFN_Serialize)(Tiny::ECS::Entity entity, std::vector<u8>& buffer, World* world);
 
+            /**
+             * @brief define the type used for the type-erased load function for components that already exist
+             */
+            typedef void (*PFN_DeserializeInPlace)(Tiny::ECS::Entity entity, const std::span<const u8>& buffer, World* world);
+
+            /**
+             * @brief define the type used for the type-erased column registration function
+             */
+            typedef Registry::column_t (*PFN_RegisterColumn)(World* world);
+
+            /**
+             * @brief define the type used for the type-erased function that removes a component (if it exists)
+             */
+            typedef void (*PFN_Remove)(Tiny::ECS::Entity entity, World* world);
+
+            /**
+             * @brief define the type used for the type-erased function that stores the components of a whole archtype
+             * 
+             * The sizes are only filled if the elements are serialized individually
+             */
+            typedef void (*PFN_SerializeColumn)(World* world, std::span<const Tiny::ECS::Entity> entities, std::vector<u8>& buffer, std::vector<u32>& sizes);
+
+            /**
+             * @brief define the type used for the type-erased function that loads the components of objects created together
+             * 
+             * If the sizes are empty, all elements have the same size
+             */
+            typedef void (*PFN_DeserializeColumn)(World* world, std::span<const Object> objects, std::span<const u8> data, const std::vector<u32>& sizes);
+
             /**
              * @brief store all functions for a single type
              */
@@ -121,6 +234,26 @@ namespace GLGE {
                  * @brief store a function used to deserialize a single entity
                  */
                 PFN_Deserialize loadFn = nullptr;
+                /**
+                 * @brief store a function used to deserialize into an existing component
+                 */
+                PFN_DeserializeInPlace loadInPlaceFn = nullptr;
+                /**
+                 * @brief store a function used to register the column of the type in a world
+                 */
+                PFN_RegisterColumn columnFn = nullptr;
+                /**
+                 * @brief store a function used to remove the component from an entity
+                 */
+                PFN_Remove removeFn = nullptr;
+                /**
+                 * @brief store a function used to serialize the components of a whole archtype
+                 */
+                PFN_SerializeColumn storeColumnFn = nullptr;
+                /**
+                 * @brief store a function used to deserialize the components of objects created together
+                 */
+                PFN_DeserializeColumn loadColumnFn = nullptr;
             };
 
             /**
@@ -140,7 +273,14 @@ namespace GLGE {
             /**
              * @brief define that the GLGE 
              */
-            GLGE = 0
+            GLGE = 0,
+            /**
+             * @brief a format that stores the world archtype by archtype and column by column
+             * 
+             * Files in this format are memory mapped when imported. Components registered as trivially copyable are stored 
+             * and loaded as whole columns. 
+             */
+            COLUMNAR = 1
         };  
 
         /**
@@ -185,6 +325,62 @@ namespace GLGE {
          */
         virtual void export_as(const std::filesystem::path& file, u32 format) noexcept(false) override;
 
+        /**
+         * @brief store the asset in the columnar format
+         * 
+         * @warning do NOT assume that data is empty at the start. It should be APPENDED and not overridden. 
+         * 
+         * @param data a vector to append the raw binary data to
+         */
+        void storeColumnar(std::vector<u8>& data);
+
+        /**
+         * @brief load the asset from data in the columnar format
+         * 
+         * @param data the data to load from (for example a memory mapped file)
+         * @return `u64` the amount of loaded bytes
+         */
+        u64 loadColumnar(std::span<const u8> data);
+
+        /**
+         * @brief store the changes since the last snapshot
+         * 
+         * A snapshot is taken by every call to `store`, `storeColumnar` and `storeDelta`. The delta contains the destroyed 
+         * objects, the created objects and the changed components of all other objects. Changes are found using the change 
+         * ticks of the world, so only chunks that where written to since the last snapshot are visited. 
+         * 
+         * @warning do NOT assume that data is empty at the start. It should be APPENDED and not overridden. 
+         * 
+         * @param data a vector to append the raw binary data to
+         */
+        void storeDelta(std::vector<u8>& data);
+
+        /**
+         * @brief apply a delta created by `storeDelta` 
+         * 
+         * The delta must be based on the snapshot that was loaded or applied last. 
+         * 
+         * @param data the data of the delta
+         * @return `u64` the amount of read bytes
+         */
+        u64 applyDelta(std::span<const u8> data);
+
+        /**
+         * @brief get the ID of the last snapshot that was stored from this asset
+         * 
+         * @return `u64` the ID of the last snapshot, 0 if no snapshot was taken
+         */
+        inline u64 getSnapshotId() const noexcept
+        {return m_snapshotId;}
+
+        /**
+         * @brief get the ID of the snapshot the world was loaded from or the last delta that was applied
+         * 
+         * @return `u64` the ID of the loaded snapshot, 0 if unknown
+         */
+        inline u64 getAppliedSnapshotId() const noexcept
+        {return m_appliedSnapshot;}
+
         /**
          * @brief Get the Component Registry
          * 
@@ -221,6 +417,91 @@ namespace GLGE {
             std::vector<std::pair<u64, ComponentRegistry::PFN_Serialize>> compSerializers;
         };
 
+        /**
+         * @brief a serialized component found while scanning an object
+         */
+        struct ComponentSpan {
+            /**
+             * @brief the registry entry of the component type
+             */
+            const ComponentRegistry::TypeEntry* type;
+            /**
+             * @brief the offset of the serialized component in the data
+             */
+            u64 offset;
+            /**
+             * @brief the size of the serialized component
+             */
+            u32 size;
+        };
+
+        /**
+         * @brief the data of an object found while scanning a serialized world
+         */
+        struct ObjDeserializationData {
+            /**
+             * @brief the entity ID the object had when it was stored
+             */
+            u32 id;
+            /**
+             * @brief the parent entity ID the object had when it was stored
+             */
+            u32 parent;
+            /**
+             * @brief the name of the object (a view into the serialized data)
+             */
+            std::string_view name;
+            /**
+             * @brief all components of the object with a known type, sorted by type hash
+             */
+            std::vector<std::pair<u64, ComponentSpan>> components;
+        };
+
+        /**
+         * @brief take a new snapshot of the world state used to compute deltas
+         * 
+         * @return `u64` the ID of the new snapshot
+         */
+        u64 __markSnapshot();
+
+        /**
+         * @brief serialize a single object
+         * 
+         * @param data the vector to append the object to
+         * @param entity the entity of the object
+         * @param components the type hashes and serialization functions of the components to store
+         */
+        void __storeObject(std::vector<u8>& data, Tiny::ECS::Entity entity, const std::vector<std::pair<u64, ComponentRegistry::PFN_Serialize>>& components);
+
+        /**
+         * @brief parse a list of serialized objects without touching the world
+         * 
+         * @param data the data to parse from
+         * @param offs a REFERENCE to the offset of the first object, it is moved behind the last object
+         * @param count the amount of objects to parse
+         * @param scanned a vector to fill with the parsed objects
+         */
+        void __parseObjects(std::span<const u8> data, u64& offs, u64 count, std::vector<ObjDeserializationData>& scanned);
+
+        /**
+         * @brief create parsed objects (grouped by their components) and load their components
+         * 
+         * The new objects are registered as the local counterparts of their stored entity IDs, but not linked into the hierarchy. 
+         * 
+         * @param data the data the objects where parsed from
+         * @param scanned the parsed objects
+         * @param created a vector to fill with the created objects (in the same order)
+         */
+        void __createObjects(std::span<const u8> data, const std::vector<ObjDeserializationData>& scanned, std::vector<Object>& created);
+
+        /**
+         * @brief resolve a stored entity ID to a local object
+         * 
+         * @param id the stored entity ID
+         * @return `Object` the local object, the root if the ID is unknown or invalid
+         */
+        Object __resolveStored(u32 id) const noexcept;
+
         /**
          * @brief store the componenet registry of the world
          */
@@ -231,6 +512,28 @@ namespace GLGE {
          */
         World m_world;
 
+        /**
+         * @brief the ID of the last snapshot taken from the world
+         */
+        u64 m_snapshotId = 0;
+        /**
+         * @brief the change tick the last snapshot was taken at
+         */
+        Registry::tick_t m_snapshotTick = 0;
+        /**
+         * @brief the archtype of every object at the last snapshot, keyed by the entity ID
+         */
+        std::unordered_map<u32, Registry::archtype_t> m_snapshotObjects;
+
+        /**
+         * @brief the ID of the snapshot the world was loaded from or the last applied delta
+         */
+        u64 m_appliedSnapshot = 0;
+        /**
+         * @brief maps the entity IDs of the stored world to the local entities
+         */
+        std::unordered_map<u32, Tiny::ECS::Entity> m_storedEntities;
+
     };
 
 }
@@ -32,6 +32,12 @@
 #include <mutex>
 //for thread stuff
 #include <thread>
+//for views on internal storage
+#include <span>
+#include <memory>
+//for time-sliced compaction
+#include <chrono>
+#include <algorithm>
 
 //GLGE namespace wrapper (added because this is part of GLGE)
 namespace GLGE {
@@ -592,6 +598,29 @@ static constexpr bool wants_write_v = std::is_lvalue_reference_v<Param> && !std:
 
 }
 
+/**
+ * @brief select the storage of a component type
+ * 
+ * By default, components are stored in the chunks of the archtype of their entity. Specialize this to `std::true_type` to 
+ * store a component in a sparse set outside of the archtypes instead. Adding or removing a sparse component does not move 
+ * the entity between archtypes, which makes them a good fit for tags that are toggled often (like `Selected` or `OnFire`). 
+ * 
+ * Sparse components can not be part of `create` and are not matched by archtype iteration. Use `Query::with` / `Query::without` 
+ * or `each_sparse` to iterate them. Writes to them are not tracked by the change ticks. 
+ * 
+ * @tparam T the component type
+ */
+template <typename T>
+struct sparse_storage : std::false_type {};
+
+/**
+ * @brief check if a component type is stored in a sparse set
+ * 
+ * @tparam T the component type
+ */
+template <typename T>
+inline constexpr bool sparse_storage_v = sparse_storage<std::remove_cvref_t<T>>::value;
+
 /**
  * @brief a wrapper class for std exceptions
  */
@@ -814,6 +843,25 @@ public:
      */
     World_t() = default;
 
+    /**
+     * @brief Construct a new World that allocates the chunk storage of all columns with a specific allocator
+     * 
+     * The allocator is rebound to the chunk type of every column. All other internal storage uses default constructed allocators. 
+     * 
+     * @param allocator the allocator for the chunk storage
+     */
+    explicit World_t(const Allocator<uint8_t>& allocator)
+     : m_storageAllocator(allocator)
+    {}
+
+    /**
+     * @brief get the allocator used for the chunk storage
+     * 
+     * @return `const Allocator<uint8_t>&` a constant reference to the storage allocator
+     */
+    inline const Allocator<uint8_t>& storageAllocator() const noexcept
+    {return m_storageAllocator;}
+
     /**
      * @brief create a new entity
      * 
@@ -825,6 +873,7 @@ public:
     template <typename... Components, typename... Args>
     requires (util::contains_type_v<Args, Components...> && ... )
     EntityT create(Args&&... args) {
+        static_assert(!(sparse_storage_v<Components> || ...), "Sparse components are not part of archtypes, add them using `add`");
         //compute the archtype
         i_arch_t archt = archtypeId<Components...>();
         //check if the archtype exists
@@ -871,6 +920,8 @@ public:
         //store the new archtype and new local ID
         m_entities[ent.getIndex()].archtypeId = archt;
         m_entities[ent.getIndex()].localId = m_arches[archt].template createView<Components...>().template allocateEntity<Args...>(ent, std::forward<Args>(args)...);
+        //the new entity changed its chunk
+        __touchStructural(archt, m_entities[ent.getIndex()].localId, m_entities[ent.getIndex()].localId + 1);
 
         //return the final entity entry
         return ent;
@@ -888,6 +939,7 @@ public:
     template <typename... Components, typename... Args>
     requires (util::contains_type_v<Args, Components...> && ... )
     void bulkCreate(size_t count, std::vector<EntityT>& entities, Args&&... args) {
+        static_assert(!(sparse_storage_v<Components> || ...), "Sparse components are not part of archtypes, add them using `add`");
         //compute the archtype
         i_arch_t archt = archtypeId<Components...>();
         //check if the archtype exists
@@ -948,6 +1000,370 @@ public:
             m_entities[entities[i].getIndex()].archtypeId = archt;
             m_entities[entities[i].getIndex()].localId = locals[i];
         }
+        //the new entities are appended, so they changed the chunks at the end
+        if (count > 0) {__touchStructural(archt, m_arches[archt].m_localToGlobal.size() - count, m_arches[archt].m_localToGlobal.size());}
+    }
+
+    /**
+     * @brief the type used to identify component columns at runtime
+     */
+    using column_t = ColumnIntegral;
+
+    /**
+     * @brief make sure that the column for a component type exists
+     * 
+     * @tparam Component the component type to register
+     * @return `column_t` the ID of the column that stores the component
+     */
+    template <typename Component>
+    column_t registerComponent() {
+        static_assert(!sparse_storage_v<Component>, "Sparse components are not stored in columns");
+        //get the column ID
+        i_col_t tid = typeId<Component>();
+        //check if the column exists
+        if (m_columns.size() <= tid) {
+            //sanity check in debug if the column id count is saturated
+            #ifdef TINY_ECS_DEBUG
+            if (m_columns.size() >= MAX_COLUMN_COUNT) {
+                throw Exception(std::string("Ran out of column IDs: Can only create ") + std::to_string(MAX_COLUMN_COUNT) + " columns, but was tasked to create more");
+            }
+            #endif
+
+            m_columns.resize(tid + 1);
+        }
+        if (m_columns[tid].m_world == nullptr) {
+            m_columns[tid] = ColumnView<Component>::createColumn(this);
+        }
+        return tid;
+    }
+
+    /**
+     * @brief make sure that a column exists that another world allready registered
+     * 
+     * Column IDs are the same for all worlds, so this allows to register a column without knowing its type. 
+     * 
+     * @param other the world that has the column
+     * @param column the ID of the column
+     * @return `column_t` the ID of the column
+     */
+    column_t registerColumn(const World_t& other, column_t column) {
+        if ((column >= other.m_columns.size()) || (other.m_columns[column].m_world == nullptr))
+        {throw Exception("Can not register a column that the other world does not have");}
+        if (m_columns.size() <= column) {m_columns.resize(column + 1);}
+        if (m_columns[column].m_world == nullptr) {
+            m_columns[column] = (*other.m_columns[column].m_factory)(this);
+        }
+        return column;
+    }
+
+    /**
+     * @brief copy the components of an entity into a lot of other entities
+     * 
+     * Every component that the source entity and the targets both have is copied. The copies are made column by column. 
+     * Sparse components of the source are added to the targets. The source may belong to another world. 
+     * 
+     * @warning all targets must belong to the same archtype and all copied components must be copy assignable
+     * 
+     * @param source the world the source entity belongs to
+     * @param from the entity to copy the components from
+     * @param targets the entities to copy the components to
+     */
+    void copyComponents(World_t& source, EntityT from, std::span<const EntityT> targets) {
+        if (targets.empty()) {return;}
+        const auto* srcColumns = source.entityColumns(from);
+        const auto* dstColumns = entityColumns(targets[0]);
+        if (!srcColumns || !dstColumns) {return;}
+        const EntityMeta& src = source.m_entities[from.getIndex()];
+        i_arch_t dstArch = m_entities[targets[0].getIndex()].archtypeId;
+
+        std::vector<i_base_t> locals;
+        locals.reserve(targets.size());
+        for (EntityT target : targets) {
+            const EntityMeta& entry = m_entities[target.getIndex()];
+            if ((entry.version != target.getVersion()) || (entry.archtypeId != dstArch))
+            {throw Exception("All targets of a component copy must exist and share the same archtype");}
+            locals.push_back(entry.localId);
+        }
+
+        //both lists are sorted, so the shared columns are found in one pass
+        auto srcIt = srcColumns->begin();
+        for (i_col_t col : *dstColumns) {
+            while ((srcIt != srcColumns->end()) && (*srcIt < col)) {++srcIt;}
+            if ((srcIt == srcColumns->end()) || (*srcIt != col)) {continue;}
+            ColumnBase& column = m_columns[col];
+            if (!column.m_copier)
+            {throw Exception("Can not copy a component that is not copy assignable");}
+            (*column.m_copier)(&source.m_columns[col], src.archtypeId, src.localId, dstArch, locals.data(), locals.size(), &column);
+            column.touchRange(dstArch, *std::min_element(locals.begin(), locals.end()), *std::max_element(locals.begin(), locals.end()) + 1, m_tick);
+        }
+
+        for (auto& set : source.m_sparse) {
+            if (set && set->contains(from)) {set->copyTo(from, *this, targets);}
+        }
+    }
+
+    /**
+     * @brief the type used to identify archtypes at runtime
+     */
+    using archtype_t = ArchtypeIntegral;
+
+    /**
+     * @brief get the amount of archtype IDs that are in use
+     * 
+     * @return `size_t` the amount of archtype IDs, some of them may not hold any entities
+     */
+    inline size_t archtypeCount() const noexcept
+    {return m_archtypeResolution.size();}
+
+    /**
+     * @brief get the columns of all components of an archtype
+     * 
+     * @param archtype the ID of the archtype
+     * @return `const std::vector<column_t, Allocator<column_t>>&` the sorted column IDs of the archtype
+     */
+    inline const std::vector<column_t, Allocator<column_t>>& archtypeColumns(archtype_t archtype) const
+    {return m_archtypeResolution[archtype];}
+
+    /**
+     * @brief get the columns of all components an entity has
+     * 
+     * @param entity the entity to quarry
+     * @return `const std::vector<column_t, Allocator<column_t>>*` the sorted column IDs or `nullptr` if the entity does not exist
+     */
+    inline const std::vector<column_t, Allocator<column_t>>* entityColumns(EntityT entity) const noexcept {
+        if (entity.getIndex() >= m_entities.size()) {return nullptr;}
+        const EntityMeta& entry = m_entities[entity.getIndex()];
+        if (entity.getVersion() != entry.version) {return nullptr;}
+        return &m_archtypeResolution[entry.archtypeId];
+    }
+
+    /**
+     * @brief get all entities of an archtype
+     * 
+     * The entities are ordered by their archtype local index. The components of a column are stored contiguously in the 
+     * same order, so the component of the first entity points to the start of an array holding the components of all entities. 
+     * 
+     * @param archtype the ID of the archtype
+     * @return `std::span<const EntityT>` all entities of the archtype
+     */
+    inline std::span<const EntityT> archtypeEntities(archtype_t archtype) const noexcept {
+        if ((archtype >= m_arches.size()) || (m_arches[archtype].m_world == nullptr)) {return {};}
+        return std::span<const EntityT>(m_arches[archtype].m_localToGlobal.data(), m_arches[archtype].m_localToGlobal.size());
+    }
+
+    /**
+     * @brief the type used for change ticks
+     */
+    using tick_t = uint32_t;
+
+    /**
+     * @brief get the current change tick
+     * 
+     * All writes are stamped with the current tick. A chunk changed since a tick `t` if its tick is greater than `t`. 
+     * 
+     * @return `tick_t` the current tick (starts at 1)
+     */
+    inline tick_t currentTick() const noexcept
+    {return m_tick;}
+
+    /**
+     * @brief start a new change tick
+     * 
+     * @warning this must not be called while other threads access the world
+     * 
+     * @return `tick_t` the new current tick
+     */
+    inline tick_t advanceTick() noexcept
+    {return ++m_tick;}
+
+    /**
+     * @brief get the tick a chunk of a column of an archtype was last changed at
+     * 
+     * @param column the ID of the column
+     * @param archtype the ID of the archtype
+     * @param chunk the archtype local index of the chunk (the archtype local index of an entity divided by `chunkSize()`)
+     * @return `tick_t` the tick of the last change, 0 if the chunk was never changed
+     */
+    inline tick_t chunkTick(column_t column, archtype_t archtype, size_t chunk) const noexcept
+    {return (column < m_columns.size()) ? m_columns[column].chunkTick(archtype, chunk) : 0;}
+
+    /**
+     * @brief get the storage version of a column
+     * 
+     * The version changes every time the storage of the column is moved (when it grows or is compacted), so pointers to 
+     * components of the column are only valid while the version stays the same. 
+     * 
+     * @param column the ID of the column
+     * @return `uint16_t` the version of the column, 0 if the column does not exist
+     */
+    inline uint16_t columnVersion(column_t column) const noexcept
+    {return (column < m_columns.size()) ? m_columns[column].getVersion() : 0;}
+
+    /**
+     * @brief get the amount of elements in a chunk
+     * 
+     * @return `size_t` the chunk size
+     */
+    inline static constexpr size_t chunkSize() noexcept
+    {return ChunkSize;}
+
+    /**
+     * @brief get the amount of chunk memory an archtype owns over all of its columns
+     * 
+     * Chunks are only allocated as a whole, so this includes the free slots at the end of the last chunk. 
+     * 
+     * @param archtype the ID of the archtype
+     * @return `size_t` the size of all chunks of the archtype in bytes
+     */
+    size_t archtypeMemory(archtype_t archtype) const noexcept {
+        if (archtype >= m_archtypeResolution.size()) {return 0;}
+        size_t bytes = 0;
+        for (i_col_t col : m_archtypeResolution[archtype]) {
+            const ColumnBase& column = m_columns[col];
+            if (archtype < column.m_knownTypes.size())
+            {bytes += size_t(column.m_knownTypes[archtype].size) * column.m_chunkBytes;}
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief get the total amount of chunk memory over all columns
+     * 
+     * @return `size_t` the size of all allocated chunks in bytes
+     */
+    size_t chunkMemory() const noexcept {
+        size_t bytes = 0;
+        for (const ColumnBase& column : m_columns) {bytes += size_t(column.m_totalChunks) * column.m_chunkBytes;}
+        return bytes;
+    }
+
+    /**
+     * @brief count the chunks that don't hold a single element over all columns
+     * 
+     * Removing entities never leaves holes inside an archtype (the last entity is moved into the freed slot), but the 
+     * chunks at the end of the archtype stay allocated. These are released by `compact`. 
+     * 
+     * @return `size_t` the amount of empty chunks
+     */
+    size_t emptyChunkCount() const noexcept {
+        size_t count = 0;
+        for (const ColumnBase& column : m_columns) {count += column.emptyChunks();}
+        return count;
+    }
+
+    /**
+     * @brief release the empty chunks of all archtypes, a few columns at a time
+     * 
+     * Every call continues with the column the last call stopped at and compacts whole columns until the time budget is 
+     * used up. At least one column is compacted per call. Entities keep their archtype and archtype local index, so all 
+     * entity handles stay valid. 
+     * 
+     * @warning this is a structural change, it must not be called while the world is iterated
+     * 
+     * @tparam Rep the representation of the duration
+     * @tparam Period the period of the duration
+     * @param budget the time the compaction may take
+     * @param keep the amount of empty chunks every archtype keeps for entities that are created later
+     * @return `true` if a full pass over all columns finished with this call, `false` if columns are left
+     */
+    template <typename Rep, typename Period>
+    bool compact(std::chrono::duration<Rep, Period> budget, size_t keep = 0) {
+        auto start = std::chrono::steady_clock::now();
+        while (m_compactCursor < m_columns.size()) {
+            m_columns[m_compactCursor++].compact(static_cast<i_chunk_t>(keep));
+            if ((std::chrono::steady_clock::now() - start) >= budget) {break;}
+        }
+        if (m_compactCursor < m_columns.size()) {return false;}
+
+        //the entity lists of the archtypes only grow, so give back what mass removals left over
+        for (ArchtypeBase& arch : m_arches) {
+            if (arch.m_localToGlobal.capacity() > 2 * arch.m_localToGlobal.size())
+            {arch.m_localToGlobal.shrink_to_fit();}
+        }
+        m_compactCursor = 0;
+        return true;
+    }
+
+    /**
+     * @brief a function to create a lot of entities at once from a component list that is only known at runtime
+     * 
+     * All components are default constructed directly in the final archtype. 
+     * 
+     * @warning all columns must be registered (see `registerComponent`)
+     * 
+     * @param count the amount of entities to create
+     * @param entities a std::vector to append the entity names to
+     * @param columns the IDs of the columns of all components the entities have
+     */
+    void bulkCreate(size_t count, std::vector<EntityT>& entities, std::vector<column_t> columns) {
+        //sanity check the columns
+        for (i_col_t col : columns) {
+            if ((col >= m_columns.size()) || (m_columns[col].m_world == nullptr))
+            {throw Exception("Can not bulk create entities with a component that was never registered");}
+        }
+        //remove duplicates, the archtype is a set of columns
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+
+        //compute the archtype
+        std::vector<i_col_t, Allocator<i_col_t>> tids(columns.begin(), columns.end());
+        i_arch_t archt = archtypeId(tids);
+        //check if the archtype exists
+        if (archt >= m_arches.size()) {
+            //sanity check the amount to not surpass the maximum amount
+            #ifdef TINY_ECS_DEBUG
+            if (m_arches.size() >= MAX_ARCHTYPE_COUNT) {
+                throw Exception(std::string("Ran out of archtype IDs: Can only create ") + std::to_string(MAX_ARCHTYPE_COUNT) + " archtypes, but was tasked to create more");
+            }
+            #endif
+
+            //if it is safe, add to it
+            m_arches.resize(archt + 1);
+        }
+        ArchtypeBase& arch = m_arches[archt];
+        if (arch.m_world == nullptr) 
+        {arch = ArchtypeBase(archt, tids.begin(), tids.end(), this);}
+
+        //fill in the entity IDs and the local mapping
+        entities.reserve(entities.size() + count);
+        arch.m_localToGlobal.reserve(arch.m_localToGlobal.size() + count);
+        for (size_t i = 0; i < count; ++i) {
+            //store the new entity ID
+            EntityT ent(0, 0);
+
+            //check if an ID can be re-used
+            if (m_freeList.empty()) {
+                //sanity check in debug mode
+                #ifdef TINY_ECS_DEBUG
+                if (m_entities.size() >= MAX_ENTITY_COUNT) {
+                    throw Exception(std::string("Ran out of type IDs: Can only create ") + std::to_string(MAX_ENTITY_COUNT) + " entities, but was tasked to create more");
+                }
+                #endif
+
+                //add to the end
+                ent.setIndex(m_entities.size());
+                m_entities.push_back(EntityMeta{});
+            } else {
+                //read the last entry and pop it
+                i_base_t id = m_freeList.back();
+                m_freeList.pop_back();
+                ent.setIndex(id);
+                //read the allready updated version (version update upon destruction)
+                ent.setVersion(m_entities[ent.getIndex()].version);
+            }
+
+            //map the entity to the next local slot
+            m_entities[ent.getIndex()].archtypeId = archt;
+            m_entities[ent.getIndex()].localId = arch.m_localToGlobal.size();
+            arch.m_localToGlobal.push_back(ent);
+            entities.push_back(ent);
+        }
+
+        //create all components column by column
+        for (i_col_t col : columns)
+        {m_columns[col].multiAddDefault(archt, count);}
+        //the new entities changed the chunks at the end
+        if (count > 0) {__touchStructural(archt, arch.m_localToGlobal.size() - count, arch.m_localToGlobal.size());}
     }
 
     /**
@@ -965,10 +1381,17 @@ public:
         if (entity.getVersion() != entry.version)
         {return;}
 
+        //drop the sparse components while the handle is still valid
+        for (auto& set : m_sparse) {
+            if (set) {set->erase(entity);}
+        }
         //invalidate all other handles
         ++entry.version;
         //remove from archtypes
         m_arches[entry.archtypeId].removeElement(entry.localId);
+        //the last entity was moved into the slot
+        if (entry.localId < m_arches[entry.archtypeId].m_localToGlobal.size())
+        {__touchStructural(entry.archtypeId, entry.localId, entry.localId + 1);}
     }
 
     /**
@@ -990,6 +1413,12 @@ public:
         if (entity.getVersion() != entry.version)
         {return;}
 
+        //sparse components don't change the archtype
+        if constexpr (sparse_storage_v<Component>) {
+            __sparseSet<Component>().emplace(entity, std::forward<Args>(args)...);
+            return;
+        }
+
         //get the component type IDs
         std::vector<i_col_t, Allocator<i_col_t>> tids = m_archtypeResolution[entry.archtypeId];
         i_col_t newCol = typeId<Component>();
@@ -1052,6 +1481,10 @@ public:
 
         //add to the new column
         m_columns[newCol].template createView<Component>().addElement(archt, std::forward<Args>(args)...);
+
+        //both the old slot (now holding the old last entity) and the new slot changed
+        if (oldLocal < oldArch.m_localToGlobal.size()) {__touchStructural(oldArch.m_id, oldLocal, oldLocal + 1);}
+        __touchStructural(archt, newLocal, newLocal + 1);
     }
 
     /**
@@ -1071,6 +1504,13 @@ public:
         if (entity.getVersion() != entry.version)
         {return;}
 
+        //sparse components don't change the archtype
+        if constexpr (sparse_storage_v<Component>) {
+            if (typeId<Component>() < m_sparse.size() && m_sparse[typeId<Component>()])
+            {m_sparse[typeId<Component>()]->erase(entity);}
+            return;
+        }
+
         //get the component id
         i_col_t tid = typeId<Component>();
         //get the component type IDs
@@ -1116,10 +1556,102 @@ public:
         //migrate over the old columns
         for (size_t i = 0; i < arch.m_columns.size(); ++i)
         {m_columns[arch.m_columns[i]].move(oldArch.m_id, oldLocal, archt);}
+        //the removed column is not migrated, but it must be swap-erased like the others
+        m_columns[tid].removeElement(oldArch.m_id, oldLocal);
 
         //register new archtype
         entry.archtypeId = archt;
         entry.localId = newLocal;
+
+        //both the old slot (now holding the old last entity) and the new slot changed
+        if (oldLocal < oldArch.m_localToGlobal.size()) {__touchStructural(oldArch.m_id, oldLocal, oldLocal + 1);}
+        __touchStructural(archt, newLocal, newLocal + 1);
+    }
+
+    /**
+     * @brief move a lot of entities to the archtype with exactly the given set of components
+     * 
+     * Every entity is moved only once, no matter how many components it gains or loses. Components that exist in both 
+     * archtypes are moved, components that are not part of the new archtype are destroyed and new components are default 
+     * constructed. Entities that do not exist anymore are skipped. 
+     * 
+     * @warning all columns must be registered (see `registerComponent`)
+     * 
+     * @param entities the entities to move
+     * @param columns the IDs of the columns of all components the entities have afterwards
+     */
+    void bulkMigrate(const std::vector<EntityT>& entities, std::vector<column_t> columns) {
+        //sanity check the columns
+        for (i_col_t col : columns) {
+            if ((col >= m_columns.size()) || (m_columns[col].m_world == nullptr))
+            {throw Exception("Can not migrate entities to a component that was never registered");}
+        }
+        //remove duplicates, the archtype is a set of columns
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+
+        //compute the archtype
+        std::vector<i_col_t, Allocator<i_col_t>> tids(columns.begin(), columns.end());
+        i_arch_t archt = archtypeId(tids);
+        //check if the archtype exists
+        if (archt >= m_arches.size()) {
+            //sanity check the amount to not surpass the maximum amount
+            #ifdef TINY_ECS_DEBUG
+            if (m_arches.size() >= MAX_ARCHTYPE_COUNT) {
+                throw Exception(std::string("Ran out of archtype IDs: Can only create ") + std::to_string(MAX_ARCHTYPE_COUNT) + " archtypes, but was tasked to create more");
+            }
+            #endif
+
+            //if it is safe, add to it
+            m_arches.resize(archt + 1);
+        }
+        ArchtypeBase& arch = m_arches[archt];
+        if (arch.m_world == nullptr) 
+        {arch = ArchtypeBase(archt, tids.begin(), tids.end(), this);}
+
+        i_base_t first = arch.m_localToGlobal.size();
+        arch.m_localToGlobal.reserve(first + entities.size());
+        for (EntityT entity : entities) {
+            //reject invalid and stale entities as well as entities that are allready in place
+            if (entity.getIndex() >= m_entities.size())
+            {continue;}
+            EntityMeta& entry = m_entities[entity.getIndex()];
+            if ((entity.getVersion() != entry.version) || (entry.archtypeId == archt))
+            {continue;}
+
+            //create the new entity in the archtype
+            i_base_t newLocal = arch.m_localToGlobal.size();
+            arch.m_localToGlobal.push_back(entity);
+
+            //move the kept components and destroy the dropped ones
+            ArchtypeBase& oldArch = m_arches[entry.archtypeId];
+            i_base_t oldLocal = entry.localId;
+            for (i_col_t col : oldArch.m_columns) {
+                if (std::find(columns.begin(), columns.end(), col) != columns.end())
+                {m_columns[col].move(oldArch.m_id, oldLocal, archt);}
+                else
+                {m_columns[col].removeElement(oldArch.m_id, oldLocal);}
+            }
+            //default construct the gained components
+            for (i_col_t col : columns) {
+                if (std::find(oldArch.m_columns.begin(), oldArch.m_columns.end(), col) == oldArch.m_columns.end())
+                {m_columns[col].multiAddDefault(archt, 1);}
+            }
+
+            //swap-erase from the old archtype
+            EntityT oldBack = oldArch.m_localToGlobal.back();
+            oldArch.m_localToGlobal[oldLocal] = oldBack;
+            oldArch.m_localToGlobal.pop_back();
+            m_entities[oldBack.getIndex()].localId = oldLocal;
+            //the old slot now holds the old last entity
+            if (oldLocal < oldArch.m_localToGlobal.size()) {__touchStructural(oldArch.m_id, oldLocal, oldLocal + 1);}
+
+            //register new archtype
+            entry.archtypeId = archt;
+            entry.localId = newLocal;
+        }
+        //all moved entities where appended
+        __touchStructural(archt, first, arch.m_localToGlobal.size());
     }
 
     /**
@@ -1136,33 +1668,90 @@ public:
         {return nullptr;}
 
         //reject a stale reference
-        if (entity.getVersion() != m_entities[entity.getIndex()].version)
+        const EntityMeta& meta = m_entities[entity.getIndex()];
+        if (entity.getVersion() != meta.version)
         {return nullptr;}
 
+        //sparse components are looked up in their set
+        if constexpr (sparse_storage_v<Component>) {
+            SparseSet<Component>* set = __findSparseSet<Component>();
+            return set ? set->get(entity) : nullptr;
+        }
+
         //read the component
-        return m_arches[m_entities[entity.getIndex()].archtypeId].template get<Component>(m_entities[entity.getIndex()].localId);
+        Component* comp = m_arches[meta.archtypeId].template get<Component>(meta.localId);
+        //the component may be written through the pointer
+        if (comp) {m_columns[typeId<Component>()].touch(meta.archtypeId, meta.localId, m_tick);}
+        return comp;
     }
 
     /**
-     * @brief a function that runs for all entities that exactly match the specified components
+     * @brief a function to read a specific element from an entity without marking it as changed
      * 
-     * @tparam Components the exact component mask the entities must match
-     * @tparam Func the function to call for all of them
-     * @param fn the function to call for all of them
+     * @tparam Component the type of the component to read
+     * @param entity the entity to read the component from
+     * @return `const Component*` a pointer to the component or `nullptr` if it was not found
      */
-    template <typename... Components, typename Func>
-    void each(Func&& fn) {
-        //get the archtype ID
-        i_arch_t archt = archtypeId<Components...>();
+    template <typename Component>
+    const Component* read(EntityT entity) {
+        //reject invalid entity IDs
+        if (entity.getIndex() >= m_entities.size())
+        {return nullptr;}
 
-        //if the archtype is unknown, stop (no entities to iterate)
-        if (archt >= m_arches.size()) {return;}
-        ArchtypeBase& arch = m_arches[archt];
-        if (arch.m_world == nullptr) {return;}
+        //reject a stale reference
+        const EntityMeta& meta = m_entities[entity.getIndex()];
+        if (entity.getVersion() != meta.version)
+        {return nullptr;}
 
-        //get the amount of elements to iterate over and early out on 0
-        const size_t count = arch.m_localToGlobal.size();
-        if (count == 0) {return;}
+        //sparse components are looked up in their set
+        if constexpr (sparse_storage_v<Component>) {
+            SparseSet<Component>* set = __findSparseSet<Component>();
+            return set ? set->get(entity) : nullptr;
+        }
+
+        //read the component
+        return m_arches[meta.archtypeId].template get<Component>(meta.localId);
+    }
+
+    /**
+     * @brief mark a component of an entity as changed in the current tick
+     * 
+     * Writes through `get` and mutable iteration are tracked automatically. This is only needed for writes through pointers 
+     * that where obtained in an earlier tick. 
+     * 
+     * @tparam Component the type of the component that changed
+     * @param entity the entity that owns the component
+     */
+    template <typename Component>
+    void markChanged(EntityT entity) noexcept {
+        //sparse components are not tracked
+        if constexpr (sparse_storage_v<Component>) {return;}
+        if (entity.getIndex() >= m_entities.size()) {return;}
+        const EntityMeta& meta = m_entities[entity.getIndex()];
+        if ((entity.getVersion() != meta.version) || (typeId<Component>() >= m_columns.size())) {return;}
+        m_columns[typeId<Component>()].touch(meta.archtypeId, meta.localId, m_tick);
+    }
+
+    /**
+     * @brief a function that runs for all entities that exactly match the specified components
+     * 
+     * @tparam Components the exact component mask the entities must match
+     * @tparam Func the function to call for all of them
+     * @param fn the function to call for all of them
+     */
+    template <typename... Components, typename Func>
+    void each(Func&& fn) {
+        //get the archtype ID
+        i_arch_t archt = archtypeId<Components...>();
+
+        //if the archtype is unknown, stop (no entities to iterate)
+        if (archt >= m_arches.size()) {return;}
+        ArchtypeBase& arch = m_arches[archt];
+        if (arch.m_world == nullptr) {return;}
+
+        //get the amount of elements to iterate over and early out on 0
+        const size_t count = arch.m_localToGlobal.size();
+        if (count == 0) {return;}
 
         //get pointers to all first elements
         std::tuple<Components*...> columns = {reinterpret_cast<Components*>(m_columns[typeId<Components>()].get(arch.m_id, 0))...};
@@ -1172,6 +1761,8 @@ public:
         std::sort(tids.begin(), tids.end());
         bool writers[sizeof...(Components)] = {(util::wants_write_v<Components, typename util::type_at<util::index_of<Components, util::type_list<Components...>>::value, typename util::function_traits<Func>::param_types>::type>)...};
         typename ColumnLock::LockKey keys[sizeof...(Components)] = {m_columns[tids[util::index_of<Components, util::type_list<Components...>>::value].column].m_lock.lock(archt, writers[tids[util::index_of<Components, util::type_list<Components...>>::value].local]) ...};
+        //all written components change
+        __touchWriters<Components...>(archt, writers);
 
         //iterate over the entities
         for (size_t local = 0; local < count; ++local) {
@@ -1220,6 +1811,7 @@ public:
         for (i_arch_t archt : archtypes) {
             //obtain a lock on the archtype
             typename ColumnLock::LockKey key = m_columns[tid].m_lock.lock(archt, util::wants_write_v<Component, typename util::function_traits<Func>::param_types>);
+            if (util::wants_write_v<Component, typename util::function_traits<Func>::param_types>) {base.touchAll(archt, m_tick);}
 
             i_base_t size = m_arches[archt].m_localToGlobal.size();
             Component* start = reinterpret_cast<Component*>(base.get(archt, 0));
@@ -1242,57 +1834,96 @@ public:
      */
     template <typename ...Components, typename Func>
     void each_match(Func&& fn) {
-        //lock all the requested components locks
         std::array<ColumnId, sizeof...(Components)> tids = {(ColumnId{typeId<Components>(), util::index_of<Components, util::type_list<Components...>>::value}) ...};
         std::sort(tids.begin(), tids.end());
-        bool writers[sizeof...(Components)] = {(util::wants_write_v<Components, typename util::type_at<util::index_of<Components, util::type_list<Components...>>::value, typename util::function_traits<std::remove_cvref_t<Func>>::param_types>::type>)...};
+        //pre-fetch all archtypes that use this column
+        __eachIn<Components...>(__matchArchtypes(tids), std::forward<Func>(fn));
+    }
 
-        //store all column bases
-        ColumnBase* columns[sizeof...(Components)] = { nullptr };
-        //check if the columns exists
-        for (size_t i = 0; i < sizeof...(Components); ++i) {
-            if (tids[i].column >= m_columns.size()) {return;}
-            columns[i] = &m_columns[tids[i].column];
-            if (columns[i]->m_world == nullptr) {return;}
+    /**
+     * @brief a function to run on all entities that have a sparse component
+     * 
+     * Only the entities in the sparse set are visited, so this is cheap even if the component is rare. 
+     * 
+     * @warning the function must not add or remove the component
+     * 
+     * @tparam Component the sparse component
+     * @tparam Func the function to call, either with the entity and the component or just the component
+     * @param fn the function to call
+     */
+    template <typename Component, typename Func>
+    void each_sparse(Func&& fn) {
+        static_assert(sparse_storage_v<Component>, "Only sparse components can be iterated using `each_sparse`");
+        SparseSet<Component>* set = __findSparseSet<Component>();
+        if (!set) {return;}
+
+        const auto& entities = set->entities();
+        auto& data = set->data();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if constexpr (std::invocable<Func, EntityT, Component&>)
+            {fn(entities[i], data[i]);}
+            else
+            {fn(data[i]);}
         }
+    }
 
-        //pre-fetch all archtypes that use this column
-        std::vector<i_arch_t> archtypes;
-        archtypes.reserve(m_archtypeResolution.size());
-        for (size_t i = 0; i < m_archtypeResolution.size(); ++i) {
-            //check if this satisfies the combination
-            size_t found = 0;
-            for (size_t j = 0; j < m_archtypeResolution[i].size(); ++j) {
-                //check if this matches ANY type
-                for (size_t k = 0; k < sizeof...(Components); ++k) {
-                    if (m_archtypeResolution[i][j] == tids[k].column) {
-                        ++found;
-                        break;
-                    }
-                }
-            }
+    /**
+     * @brief count the entities that have a sparse component
+     * 
+     * @tparam Component the sparse component
+     * @return `size_t` the amount of entities with the component
+     */
+    template <typename Component>
+    size_t sparseCount() noexcept {
+        static_assert(sparse_storage_v<Component>, "Only sparse components are stored in sparse sets");
+        SparseSet<Component>* set = __findSparseSet<Component>();
+        return set ? set->entities().size() : 0;
+    }
 
-            //if all were found, add to the combination count
-            if (found == sizeof...(Components)) {
-                archtypes.push_back(i);
-            }
-        }
+    /**
+     * @brief a function to run on all entities that have AT LEAST the specified components, but only in chunks where one of them changed
+     * 
+     * A chunk is visited if any of the requested components was written to in it after `since` (see `chunkTick`). Every 
+     * entity of a visited chunk is passed to the function, so an entity may be visited even if only a neighbour changed. 
+     * Written components only mark the visited chunks. 
+     * 
+     * @tparam Components the components that are AT LEAST required
+     * @tparam Func the function to call
+     * @param since the tick to compare against, usually the `currentTick` of the last run of the system
+     * @param fn the function to call
+     */
+    template <typename ...Components, typename Func>
+    void each_changed(tick_t since, Func&& fn) {
+        static_assert(!(sparse_storage_v<Components> || ...), "Sparse components are not tracked by change ticks");
+        //lock all the requested components locks
+        std::array<ColumnId, sizeof...(Components)> tids = {(ColumnId{typeId<Components>(), util::index_of<Components, util::type_list<Components...>>::value}) ...};
+        std::sort(tids.begin(), tids.end());
+        bool writers[sizeof...(Components)] = {(util::wants_write_v<Components, typename util::type_at<util::index_of<Components, util::type_list<Components...>>::value, typename util::function_traits<std::remove_cvref_t<Func>>::param_types>::type>)...};
 
-        //now, play back all archtypes and iterate over them
-        for (i_arch_t archt : archtypes) {
+        //play back all archtypes that have the components
+        for (i_arch_t archt : __matchArchtypes(tids)) {
+            i_base_t size = m_arches[archt].m_localToGlobal.size();
+            if (size == 0) {continue;}
 
             //lock the columns
             typename ColumnLock::LockKey keys[sizeof...(Components)] = {m_columns[tids[util::index_of<Components, util::type_list<Components...>>::value].column].m_lock.lock(archt, writers[tids[util::index_of<Components, util::type_list<Components...>>::value].local]) ...};
 
-            //quarry size and starting positions
-            i_base_t size = m_arches[archt].m_localToGlobal.size();
-            std::tuple<Components*...> columns = {reinterpret_cast<Components*>(m_columns[typeId<Components>()].get(archt, 0))...};
-            //play back for all entries
-            for (size_t i = 0; i < size; ++i) {
-                //invoke the function
-                invokeEach<Func, Components...>(fn, m_arches[archt], i, columns);
-                //step the pointer
-                (++std::get<Components*>(columns), ...);
+            //chunks are stored back to back, so the pointers of a chunk are offsets from the first element
+            std::tuple<Components*...> first = {reinterpret_cast<Components*>(m_columns[typeId<Components>()].get(archt, 0))...};
+            for (size_t chunk = 0; (chunk * ChunkSize) < size; ++chunk) {
+                //skip untouched chunks
+                if (!__chunkChanged<Components...>(archt, chunk, since)) {continue;}
+                __touchWritersChunk<Components...>(archt, chunk, writers);
+
+                size_t startIdx = chunk * ChunkSize;
+                size_t endIdx = std::min<size_t>(size, startIdx + ChunkSize);
+                std::tuple<Components*...> columns = {(std::get<Components*>(first) + startIdx)...};
+                for (size_t i = startIdx; i < endIdx; ++i) {
+                    //invoke the function
+                    invokeEach<Func, Components...>(fn, m_arches[archt], i, columns);
+                    //step the pointer
+                    (++std::get<Components*>(columns), ...);
+                }
             }
         }
     }
@@ -1333,6 +1964,8 @@ public:
         for (i_arch_t archt : archtypes) {
             //obtain a lock on the archtype
             typename ColumnLock::LockKey key = m_columns[tid].m_lock.lock(archt, util::wants_write_v<Component, util::type_list<Args...>>);
+            //member functions may always write to the component
+            base.touchAll(archt, m_tick);
 
             i_base_t size = m_arches[archt].m_localToGlobal.size();
             Component* start = reinterpret_cast<Component*>(base.get(archt, 0));
@@ -1388,7 +2021,6 @@ public:
         size_t freeChunks = (m_columns[tids[0].column].getArchtypeMeta(archt).freeCount / ChunkSize);
         size_t taskCount = ((count + (ChunkSize - 1)) / ChunkSize);
         if (taskCount > freeChunks) {taskCount -= ((freeChunks > 0) ? 0 : (freeChunks - 1));}
-        std::atomic_size_t leftJobs{taskCount};
         auto workerTask = [&](size_t chunkId, std::tuple<Components*...> localColumns) {
             //compute start and end index
             size_t startIdx = chunkId * ChunkSize;
@@ -1403,20 +2035,17 @@ public:
                 //advance the pointers
                 ((++std::get<Components*>(localColumns)), ...);
             }
-            //ask done
-            leftJobs.fetch_sub(1, std::memory_order_acq_rel);
         };
         //create the tasks
         Jobs::BulkTask tasks(taskCount, workerTask, columns);
 
         //get all the locks
         typename ColumnLock::LockKey keys[sizeof...(Components)] = {m_columns[tids[util::index_of<Components, util::type_list<Components...>>::value].column].m_lock.lock(archt, writers[tids[util::index_of<Components, util::type_list<Components...>>::value].local]) ...};
+        //all written components change
+        __touchWriters<Components...>(archt, writers);
 
-        //run the jobs
-        employer.add_bulk(tasks);
-        //wait for the job to be done
-        while (leftJobs.load(std::memory_order_acquire) > 0)
-        {std::this_thread::sleep_for(std::chrono::nanoseconds(1));}
+        //run the jobs and wait for them to be done
+        employer.run_bulk(tasks);
     }
 
     /**
@@ -1459,7 +2088,6 @@ public:
             size_t freeChunks = (m_columns[tid].getArchtypeMeta(archt).freeCount / ChunkSize);
             size_t taskCount = ((count + (ChunkSize - 1)) / ChunkSize);
             if (taskCount > freeChunks) {taskCount -= ((freeChunks > 0) ? 0 : (freeChunks - 1));}
-            std::atomic_size_t leftJobs{taskCount};
             auto workerTask = [&](size_t chunkId, Component* localColumn) {
                 //compute start and end index
                 size_t startIdx = chunkId * ChunkSize;
@@ -1474,20 +2102,16 @@ public:
                     //advance the pointers
                     ++localColumn;;
                 }
-                //ask done
-                leftJobs.fetch_sub(1, std::memory_order_acq_rel);
             };
             //create the tasks
             Jobs::BulkTask tasks(taskCount, workerTask, reinterpret_cast<Component*>(base.get(archt, 0)));
 
             //obtain a lock on the archtype
             typename ColumnLock::LockKey key = m_columns[tid].m_lock.lock(archt, util::wants_write_v<Component, typename util::function_traits<Func>::param_types>);
+            if (util::wants_write_v<Component, typename util::function_traits<Func>::param_types>) {base.touchAll(archt, m_tick);}
 
-            //run the jobs
-            employer.add_bulk(tasks);
-            //wait for the job to be done
-            while (leftJobs.load(std::memory_order_acquire) > 0)
-            {std::this_thread::sleep_for(std::chrono::nanoseconds(1));}
+            //run the jobs and wait for them to be done
+            employer.run_bulk(tasks);
         }
     }
 
@@ -1502,55 +2126,62 @@ public:
      */
     template <typename ...Components, typename Func, size_t FiberCount>
     void parallel_each_match(Func&& fn, Jobs::Employer_t<FiberCount>& employer) {
-        //lock all the requested components locks
         std::array<ColumnId, sizeof...(Components)> tids = {(ColumnId{typeId<Components>(), util::index_of<Components, util::type_list<Components...>>::value}) ...};
         std::sort(tids.begin(), tids.end());
-        bool writers[sizeof...(Components)] = {(util::wants_write_v<Components, typename util::type_at<util::index_of<Components, util::type_list<Components...>>::value, typename util::function_traits<Func>::param_types>::type>)...};
-
-        //store all column bases
-        ColumnBase* columns[sizeof...(Components)] = { nullptr };
-        //check if the columns exists
-        for (size_t i = 0; i < sizeof...(Components); ++i) {
-            if (tids[i].column >= m_columns.size()) {return;}
-            columns[i] = &m_columns[tids[i].column];
-            if (columns[i]->m_world == nullptr) {return;}
-        }
-
         //pre-fetch all archtypes that use this column
-        std::vector<i_arch_t> archtypes;
-        archtypes.reserve(m_archtypeResolution.size());
-        for (size_t i = 0; i < m_archtypeResolution.size(); ++i) {
-            //check if this satisfies the combination
-            size_t found = 0;
-            for (size_t j = 0; j < m_archtypeResolution[i].size(); ++j) {
-                //check if this matches ANY type
-                for (size_t k = 0; k < sizeof...(Components); ++k) {
-                    if (m_archtypeResolution[i][j] == tids[k].column) {
-                        ++found;
-                        break;
-                    }
-                }
-            }
+        __parallelEachIn<Components...>(__matchArchtypes(tids), std::forward<Func>(fn), employer);
+    }
 
-            //if all were found, add to the combination count
-            if (found == sizeof...(Components)) {
-                archtypes.push_back(i);
-            }
-        }
+    //queries are defined at the end, they use the internal types
+    template <typename... Components>
+    class Query;
 
-        //now, play back all archtypes and iterate over them
-        for (i_arch_t archt : archtypes) {
+    /**
+     * @brief create a persistent query for all entities that have AT LEAST a set of components
+     * 
+     * @tparam Components the components that are AT LEAST required
+     * @return `Query<Components...>` the new query
+     */
+    template <typename... Components>
+    inline Query<Components...> query()
+    {return Query<Components...>(*this);}
 
-            //compute the amount of tasks required (complicated because underflow prevention is required)
+    /**
+     * @brief a function to run on all entities that have AT LEAST the specified components, but only in chunks where one of them changed
+     * 
+     * This is the parallel version of `each_changed`, each changed chunk is a single task. 
+     * 
+     * @tparam Components the components that are AT LEAST required
+     * @tparam Func the function to call
+     * @tparam The amount of fibers the employer has per thread
+     * @param since the tick to compare against, usually the `currentTick` of the last run of the system
+     * @param fn the function to call
+     * @param employer the employer to utilize for threading
+     */
+    template <typename ...Components, typename Func, size_t FiberCount>
+    void parallel_each_changed(tick_t since, Func&& fn, Jobs::Employer_t<FiberCount>& employer) {
+        static_assert(!(sparse_storage_v<Components> || ...), "Sparse components are not tracked by change ticks");
+        //lock all the requested components locks
+        std::array<ColumnId, sizeof...(Components)> tids = {(ColumnId{typeId<Components>(), util::index_of<Components, util::type_list<Components...>>::value}) ...};
+        std::sort(tids.begin(), tids.end());
+        bool writers[sizeof...(Components)] = {(util::wants_write_v<Components, typename util::type_at<util::index_of<Components, util::type_list<Components...>>::value, typename util::function_traits<std::remove_cvref_t<Func>>::param_types>::type>)...};
+
+        //play back all archtypes that have the components
+        std::vector<size_t> chunks;
+        for (i_arch_t archt : __matchArchtypes(tids)) {
             i_base_t count = m_arches[archt].m_localToGlobal.size();
-            size_t freeChunks = (m_columns[tids[0].column].getArchtypeMeta(archt).freeCount / ChunkSize);
-            size_t taskCount = ((count + (ChunkSize - 1)) / ChunkSize);
-            if (taskCount > freeChunks) {taskCount -= ((freeChunks > 0) ? 0 : (freeChunks - 1));}
-            std::atomic_size_t leftJobs{taskCount};
-            auto workerTask = [&](size_t chunkId, std::tuple<Components*...> localColumns) {
+
+            //collect the changed chunks first, untouched chunks don't get a task
+            chunks.clear();
+            for (size_t chunk = 0; (chunk * ChunkSize) < count; ++chunk) {
+                if (__chunkChanged<Components...>(archt, chunk, since)) {chunks.push_back(chunk);}
+            }
+            if (chunks.empty()) {continue;}
+
+            auto workerTask = [&](size_t taskId, std::tuple<Components*...> localColumns) {
                 //compute start and end index
-                size_t startIdx = chunkId * ChunkSize;
-                size_t endIdx = ((chunkId + 1) * ChunkSize);
+                size_t startIdx = chunks[taskId] * ChunkSize;
+                size_t endIdx = ((chunks[taskId] + 1) * ChunkSize);
                 if (endIdx > count) {endIdx = count;}
                 //set all the starting positions in the tuple
                 ((std::get<Components*>(localColumns) += startIdx), ...);
@@ -1561,23 +2192,20 @@ public:
                     //advance the pointers
                     ((++std::get<Components*>(localColumns)), ...);
                 }
-                //ask done
-                leftJobs.fetch_sub(1, std::memory_order_acq_rel);
             };
 
             //lock the columns
             typename ColumnLock::LockKey keys[sizeof...(Components)] = {m_columns[tids[util::index_of<Components, util::type_list<Components...>>::value].column].m_lock.lock(archt, writers[tids[util::index_of<Components, util::type_list<Components...>>::value].local]) ...};
+            //only the visited chunks change
+            for (size_t chunk : chunks) {__touchWritersChunk<Components...>(archt, chunk, writers);}
 
-            //quarry size and starting positions
+            //quarry the starting positions
             std::tuple<Components*...> columns = {reinterpret_cast<Components*>(m_columns[typeId<Components>()].get(archt, 0))...};
             //create the tasks
-            Jobs::BulkTask tasks(taskCount, workerTask, columns);
+            Jobs::BulkTask tasks(chunks.size(), workerTask, columns);
 
-            //run the jobs
-            employer.add_bulk(tasks);
-            //wait for the job to be done
-            while (leftJobs.load(std::memory_order_acquire) > 0)
-            {std::this_thread::sleep_for(std::chrono::nanoseconds(1));}
+            //run the jobs and wait for them to be done
+            employer.run_bulk(tasks);
         }
     }
 
@@ -1622,7 +2250,6 @@ public:
             size_t freeChunks = (m_columns[tid].getArchtypeMeta(archt).freeCount / ChunkSize);
             size_t taskCount = ((count + (ChunkSize - 1)) / ChunkSize);
             if (taskCount > freeChunks) {taskCount -= ((freeChunks > 0) ? 0 : (freeChunks - 1));}
-            std::atomic_size_t leftJobs{taskCount};
             auto workerTask = [&](size_t chunkId, Component* localColumn) {
                 //compute start and end index
                 size_t startIdx = chunkId * ChunkSize;
@@ -1641,20 +2268,17 @@ public:
                     //step the pointer
                     ++localColumn;
                 }
-                //ask done
-                leftJobs.fetch_sub(1, std::memory_order_acq_rel);
             };
             //create the tasks
             Jobs::BulkTask tasks(taskCount, workerTask, reinterpret_cast<Component*>(base.get(archt, 0)));
 
             //obtain a lock on the archtype
             typename ColumnLock::LockKey key = m_columns[tid].m_lock.lock(archt, util::wants_write_v<Component, util::type_list<Args...>>);
+            //member functions may always write to the component
+            base.touchAll(archt, m_tick);
 
-            //run the jobs
-            employer.add_bulk(tasks);
-            //wait for the job to be done
-            while (leftJobs.load(std::memory_order_acquire) > 0)
-            {std::this_thread::sleep_for(std::chrono::nanoseconds(1));}
+            //run the jobs and wait for them to be done
+            employer.run_bulk(tasks);
         }
     }
 
@@ -2073,13 +2697,19 @@ protected:
             m_knownTypes = std::move(other.m_knownTypes);
             m_storage = other.m_storage;
             m_totalChunks = other.m_totalChunks;
+            m_chunkBytes = other.m_chunkBytes;
             m_allocator = std::move(other.m_allocator);
             m_destructor = other.m_destructor;
             m_removeElement = other.m_removeElement;
             m_getter = other.m_getter;
             m_mover = other.m_mover;
+            m_multiAdder = other.m_multiAdder;
+            m_compactor = other.m_compactor;
+            m_copier = other.m_copier;
+            m_factory = other.m_factory;
             m_world = other.m_world;
             m_version = other.m_version;
+            m_chunkTicks = std::move(other.m_chunkTicks);
 
             //invalidate the other
             other.m_storage = nullptr;
@@ -2105,13 +2735,19 @@ protected:
                 m_knownTypes   = std::move(other.m_knownTypes);
                 m_storage      = other.m_storage;
                 m_totalChunks  = other.m_totalChunks;
+                m_chunkBytes   = other.m_chunkBytes;
                 m_allocator    = std::move(other.m_allocator);
                 m_destructor   = other.m_destructor;
                 m_removeElement= other.m_removeElement;
                 m_getter       = other.m_getter;
                 m_mover        = other.m_mover;
+                m_multiAdder   = other.m_multiAdder;
+                m_compactor    = other.m_compactor;
+                m_copier       = other.m_copier;
+                m_factory      = other.m_factory;
                 m_world        = other.m_world;
                 m_version      = other.m_version;
+                m_chunkTicks   = std::move(other.m_chunkTicks);
 
                 //invalidate other
                 other.m_storage = nullptr;
@@ -2175,6 +2811,98 @@ protected:
         inline void move(i_arch_t old, i_base_t oldLocal, i_arch_t target) noexcept(true)
         {m_mover(old, oldLocal, target, this);}
 
+        /**
+         * @brief a function to add a lot of default constructed elements to an archtype in a type-erased way
+         * 
+         * @param archtype the archtype to add the elements to
+         * @param count the amount of elements to add
+         */
+        inline void multiAddDefault(i_arch_t archtype, i_base_t count)
+        {m_multiAdder(archtype, count, this);}
+
+        /**
+         * @brief release the empty chunks at the end of all archtypes in a type-erased way
+         * 
+         * The used slots of an archtype are always packed at its front, so only whole free chunks are released. Archtype 
+         * local indices don't change. 
+         * 
+         * @param keep the amount of empty chunks every archtype keeps
+         * @return `i_chunk_t` the amount of released chunks
+         */
+        inline i_chunk_t compact(i_chunk_t keep)
+        {return m_compactor ? m_compactor(keep, this) : 0;}
+
+        /**
+         * @brief count the chunks of the column that don't hold a single element
+         * 
+         * @return `size_t` the amount of empty chunks over all archtypes
+         */
+        size_t emptyChunks() const noexcept {
+            size_t count = 0;
+            for (const ArchtypeMeta& meta : m_knownTypes) {count += meta.freeCount >> CHUNK_CORRECTION_SHIFT;}
+            return count;
+        }
+
+        /**
+         * @brief stamp the chunks of a range of archtype local elements with a tick, growing the tick storage if needed
+         * 
+         * @warning this is not thread safe, it is only used for structural changes
+         * 
+         * @param archtype the archtype the elements belong to
+         * @param first the first archtype local index
+         * @param end the archtype local index behind the last element
+         * @param tick the tick to stamp
+         */
+        void touchRange(i_arch_t archtype, i_base_t first, i_base_t end, tick_t tick) {
+            if (first >= end) {return;}
+            if (m_chunkTicks.size() <= archtype) {m_chunkTicks.resize(archtype + 1);}
+            auto& ticks = m_chunkTicks[archtype];
+            size_t last = (end - 1) >> CHUNK_CORRECTION_SHIFT;
+            if (ticks.size() <= last) {ticks.resize(last + 1, 0);}
+            for (size_t chunk = (first >> CHUNK_CORRECTION_SHIFT); chunk <= last; ++chunk)
+            {ticks[chunk] = tick;}
+        }
+
+        /**
+         * @brief stamp the chunk of an existing element with a tick
+         * 
+         * This is safe to call from multiple threads. 
+         * 
+         * @param archtype the archtype the element belongs to
+         * @param local the archtype local index of the element
+         * @param tick the tick to stamp
+         */
+        inline void touch(i_arch_t archtype, i_base_t local, tick_t tick) noexcept {
+            if (archtype >= m_chunkTicks.size()) {return;}
+            auto& ticks = m_chunkTicks[archtype];
+            size_t chunk = local >> CHUNK_CORRECTION_SHIFT;
+            if (chunk < ticks.size()) {std::atomic_ref<tick_t>(ticks[chunk]).store(tick, std::memory_order_relaxed);}
+        }
+
+        /**
+         * @brief stamp all chunks of an archtype with a tick
+         * 
+         * @param archtype the archtype to stamp
+         * @param tick the tick to stamp
+         */
+        inline void touchAll(i_arch_t archtype, tick_t tick) noexcept {
+            if (archtype >= m_chunkTicks.size()) {return;}
+            for (tick_t& t : m_chunkTicks[archtype])
+            {std::atomic_ref<tick_t>(t).store(tick, std::memory_order_relaxed);}
+        }
+
+        /**
+         * @brief get the tick a chunk was last changed at
+         * 
+         * @param archtype the archtype the chunk belongs to
+         * @param chunk the archtype local index of the chunk
+         * @return `tick_t` the tick of the last change, 0 if the chunk was never changed
+         */
+        inline tick_t chunkTick(i_arch_t archtype, size_t chunk) const noexcept {
+            if ((archtype >= m_chunkTicks.size()) || (chunk >= m_chunkTicks[archtype].size())) {return 0;}
+            return std::atomic_ref<const tick_t>(m_chunkTicks[archtype][chunk]).load(std::memory_order_relaxed);
+        }
+
     protected:
         
         //views are friends
@@ -2190,10 +2918,11 @@ protected:
          * @param removeElement the function to use for remove an element
          * @param getter the function to get a specific element
          * @param mover the function to move a specific element from one archtype to another
+         * @param multiAdder the function to add a lot of default constructed elements to an archtype
          * @param world a pointer to the world that owns the column
          */
-        ColumnBase(void (*destructor)(ColumnBase*), void (*removeElement)(i_arch_t, i_base_t, ColumnBase*), void* (*getter)(i_arch_t, i_base_t, ColumnBase*), void (*mover)(i_arch_t, i_base_t, i_arch_t, ColumnBase*), World_t* world)
-         : m_destructor(destructor), m_removeElement(removeElement), m_getter(getter), m_mover(mover), m_world(world)
+        ColumnBase(void (*destructor)(ColumnBase*), void (*removeElement)(i_arch_t, i_base_t, ColumnBase*), void* (*getter)(i_arch_t, i_base_t, ColumnBase*), void (*mover)(i_arch_t, i_base_t, i_arch_t, ColumnBase*), void (*multiAdder)(i_arch_t, i_base_t, ColumnBase*), World_t* world)
+         : m_destructor(destructor), m_removeElement(removeElement), m_getter(getter), m_mover(mover), m_multiAdder(multiAdder), m_world(world)
         {}
     
         /**
@@ -2214,6 +2943,10 @@ protected:
          * @brief the total amount of chunks in the column
          */
         i_chunk_t m_totalChunks = 0;
+        /**
+         * @brief the size of a single chunk of the column in bytes
+         */
+        size_t m_chunkBytes = 0;
         /**
          * @brief store the function to call for destruction
          */
@@ -2232,6 +2965,24 @@ protected:
          * @brief a function to move an element between archtype storages
          */
         void (*m_mover)(i_arch_t, i_base_t, i_arch_t, ColumnBase*) = nullptr;
+        /**
+         * @brief a function to add a lot of default constructed elements to an archtype
+         */
+        void (*m_multiAdder)(i_arch_t, i_base_t, ColumnBase*) = nullptr;
+        /**
+         * @brief a function to release the empty chunks of all archtypes
+         */
+        i_chunk_t (*m_compactor)(i_chunk_t, ColumnBase*) = nullptr;
+        /**
+         * @brief a function to copy a single element of another column into a lot of elements of this column
+         * 
+         * `nullptr` if the component is not copy assignable
+         */
+        void (*m_copier)(ColumnBase*, i_arch_t, i_base_t, i_arch_t, const i_base_t*, size_t, ColumnBase*) = nullptr;
+        /**
+         * @brief a function to create an empty column of the same type for another world
+         */
+        ColumnBase (*m_factory)(World_t*) = nullptr;
 
         /**
          * @brief store the world that owns the column
@@ -2247,6 +2998,11 @@ protected:
          */
         ColumnLock m_lock;
 
+        /**
+         * @brief store the tick of the last change of every chunk, indexed by archtype ID and archtype local chunk index
+         */
+        std::vector<std::vector<tick_t, Allocator<tick_t>>, Allocator<std::vector<tick_t, Allocator<tick_t>>>> m_chunkTicks;
+
     };
 
     /**
@@ -2266,7 +3022,7 @@ protected:
          */
         inline static ColumnBase createColumn(World_t* world) {
             //create a new column base in place
-            return ColumnBase([](ColumnBase* column){
+            ColumnBase base([](ColumnBase* column){
                 //clean up all the elements
                 Chunk<T>* chunks = reinterpret_cast<Chunk<T>*>(column->m_storage);
                 for (size_t i = 0; i < column->m_totalChunks; ++i) {
@@ -2298,11 +3054,11 @@ protected:
                 if (archtypeLocalId >= fullSize)
                 {return;}
                 
-                //swap-remove the element
+                //swap-remove the element, the last used slot directly precedes the free ones
+                i_base_t last = fullSize - 1;
                 Chunk<T>& chunk = reinterpret_cast<Chunk<T>*>(column->m_storage)[meta.offset + chunkIdx];
-                Chunk<T>& end = reinterpret_cast<Chunk<T>*>(column->m_storage)[meta.offset + meta.size - (((meta.freeCount + (ChunkSize - 1))/ChunkSize))];
-                i_chunk_t lastLocal = (ChunkSize - (meta.freeCount & CHUNK_INDEX_MASK))-1;
-                chunk.elements[localIdx] = end.elements[lastLocal];
+                Chunk<T>& end = reinterpret_cast<Chunk<T>*>(column->m_storage)[meta.offset + (last >> CHUNK_CORRECTION_SHIFT)];
+                chunk.elements[localIdx] = std::move(end.elements[last & CHUNK_INDEX_MASK]);
                 //increase the amount of free elements
                 ++meta.freeCount;
                 //don't destroy the element - that would cause double free later
@@ -2333,7 +3089,26 @@ protected:
                 view.addElement(target, std::move(temp));
                 //remove the old element
                 column->removeElement(old, oldLocal);
+            }, [](i_arch_t archtype, i_base_t count, ColumnBase* column) {
+                //default construct all elements
+                column->template createView<T>().multiAddElement(count, archtype);
             }, world);
+            //the chunks are allocated with the storage allocator of the world
+            base.m_allocator = Allocator<StorageByte>(world->m_storageAllocator);
+            base.m_chunkBytes = sizeof(Chunk<T>);
+            base.m_compactor = [](i_chunk_t keep, ColumnBase* column) -> i_chunk_t {
+                return column->template createView<T>().releaseEmptyChunks(keep);
+            };
+            if constexpr (std::is_copy_assignable_v<T>) {
+                base.m_copier = [](ColumnBase* source, i_arch_t srcArch, i_base_t srcLocal, i_arch_t dstArch, const i_base_t* locals, size_t count, ColumnBase* column) {
+                    //copy the source first, the source may be part of the same column
+                    T value = *source->template createView<T>().accessElement(srcArch, srcLocal);
+                    ColumnView<T> view = column->template createView<T>();
+                    for (size_t i = 0; i < count; ++i) {*view.accessElement(dstArch, locals[i]) = value;}
+                };
+            }
+            base.m_factory = &ColumnView<T>::createColumn;
+            return base;
         }
 
         /**
@@ -2384,7 +3159,7 @@ protected:
                         //everything below the insertion point
                         if (insertion != 0)
                         {memcpy(newBuff, oldBuff, insertion*sizeof(Chunk<T>));}
-                        if (insertion != m_column->m_totalChunks-1)
+                        if (insertion != m_column->m_totalChunks)
                         {memcpy(newBuff + insertion + 1, oldBuff + insertion, (m_column->m_totalChunks-insertion)*sizeof(Chunk<T>));}
 
                         //chunk creation is required
@@ -2411,9 +3186,9 @@ protected:
 
                 //increase the version (the storage changed)
                 ++m_column->m_version;
-                //update the trailing offsets
+                //update the trailing offsets (an archtype may start exactly at the insertion point)
                 for (ArchtypeMeta& entry :  m_column->m_knownTypes) {
-                    if (entry.offset > insertion)
+                    if ((&entry != &meta) && (entry.offset >= insertion))
                     {++entry.offset;}
                 }
 
@@ -2426,10 +3201,10 @@ protected:
                 //increase the amount of free elements (remember: 1 was used up)
                 meta.freeCount += (ChunkSize-1);
             } else {
-                //compute the free chunk index
-                i_chunk_t shift = (meta.freeCount & CHUNK_INDEX_MASK)>>CHUNK_CORRECTION_SHIFT;
-                i_chunk_t cIdx = (meta.offset + meta.size - shift) - 1;
-                i_chunk_t lIdx = (ChunkSize - (meta.freeCount & CHUNK_INDEX_MASK) & CHUNK_INDEX_MASK);
+                //free slots are packed at the end, so the first free slot directly follows the used ones
+                i_base_t used = (meta.size * ChunkSize) - meta.freeCount;
+                i_chunk_t cIdx = meta.offset + (used >> CHUNK_CORRECTION_SHIFT);
+                i_chunk_t lIdx = used & CHUNK_INDEX_MASK;
 
                 //store the element using copy assignment
                 Chunk<T>& c = *(reinterpret_cast<Chunk<T>*>(m_column->m_storage) + cIdx);
@@ -2445,7 +3220,7 @@ protected:
          * @tparam Args arguments to use for construction of ALL elements
          * @param count the amount of elements to create
          * @param archtId the ID of the archtype to create for
-         * @param args the arguments to use for construction of ALL elements
+         * @param args the arguments to use for construction of ALL elements (copied for every element, never moved from)
          */
         template <typename... Args>
         void multiAddElement(i_base_t count, i_arch_t archtId, Args&&... args) {
@@ -2458,22 +3233,17 @@ protected:
             //get the archtype entry
             ArchtypeMeta& meta = m_column->m_knownTypes[archtId];
 
-            //compute the amount of entries to create using the free list
+            //fill the free slots of the archtype first (they are packed at the end)
             i_base_t freeInsert = std::min<i_base_t>(meta.freeCount, count);
             for (i_base_t i = 0; i < freeInsert; ++i) {
-                //compute the free chunk index
-                i_chunk_t cIdx = (meta.offset + meta.size - (meta.freeCount>>CHUNK_CORRECTION_SHIFT)) - 1;
-                i_chunk_t lIdx = ChunkSize - (meta.freeCount & CHUNK_INDEX_MASK);
-
-                //store the element using forward creation
-                Chunk<T>& c = *(reinterpret_cast<Chunk<T>*>(m_column->m_storage) + cIdx);
-                c.elements[lIdx] = T(std::forward<Args>(args)...);
+                //the first free slot directly follows the used ones
+                i_base_t used = (meta.size * ChunkSize) - meta.freeCount;
+                Chunk<T>& c = *(reinterpret_cast<Chunk<T>*>(m_column->m_storage) + meta.offset + (used >> CHUNK_CORRECTION_SHIFT));
+                c.elements[used & CHUNK_INDEX_MASK] = T(args...);
                 //used up 1 element
                 --meta.freeCount;
-
-                //created 1 element
-                --count;
             }
+            count -= freeInsert;
 
             //if all elements where created, stop
             if (count == 0) {return;}
@@ -2500,12 +3270,12 @@ protected:
                     //all data can be copied in 2 memcpy calls
                     //everything below the insertion point
                     if (insertion != 0)
-                    {memcpy(newBuff, oldBuff, (insertion-1)*sizeof(Chunk<T>));}
-                    if (insertion != m_column->m_totalChunks-reqChunks)
+                    {memcpy(newBuff, oldBuff, insertion*sizeof(Chunk<T>));}
+                    if (insertion != m_column->m_totalChunks)
                     {memcpy(newBuff + insertion + reqChunks, oldBuff + insertion, (m_column->m_totalChunks-insertion)*sizeof(Chunk<T>));}
 
                     //chunk creation is required
-                    for (size_t i = 0; i < count; ++i)
+                    for (size_t i = 0; i < reqChunks; ++i)
                     {new (newBuff + insertion + i) Chunk<T>();}
                 } else {
                     //full pod-movement is required
@@ -2517,42 +3287,103 @@ protected:
                         {new (newBuff + i) Chunk<T>(std::move(oldBuff[i - reqChunks*size_t(i >= insertion)]));}
                     }
                 }
+                //free the old buffer
+                for (size_t i = 0; i < m_column->m_totalChunks; ++i)
+                {oldBuff[i].~Chunk<T>();}
+                alloc.deallocate(oldBuff, m_column->m_totalChunks);
             } else {
                 //chunk creation is required
                 for (size_t i = 0; i < reqChunks; ++i)
                 {new (newBuff + i) Chunk<T>();}
             }
-            //free the old buffer
-            for (size_t i = 0; i < m_column->m_totalChunks; ++i)
-            {oldBuff[i].~Chunk<T>();}
-            alloc.deallocate(oldBuff, m_column->m_totalChunks);
             m_column->m_storage = reinterpret_cast<uint8_t*>(newBuff);
 
             //increase the version (the storage changed)
             ++m_column->m_version;
-            //update the trailing offsets
+            //update the trailing offsets (an archtype may start exactly at the insertion point)
             for (ArchtypeMeta& entry :  m_column->m_knownTypes) {
-                if (entry.offset > insertion)
+                if ((&entry != &meta) && (entry.offset >= insertion))
                 {entry.offset += reqChunks;}
             }
 
-            //create the element in the first slot of the chunk
-            i_chunk_t local = 0;
-            for (size_t i = 0; i < count; ++i) {
-                newBuff[insertion].elements[local] = T(std::forward<Args>(args)...);
-                //step forward
-                ++local;
-                if (local >= ChunkSize) {
-                    local = 0;
-                    ++insertion;
-                }
-            }
+            //create the elements, all free slots where used up so the new chunks are filled from the start
+            for (size_t i = 0; i < count; ++i)
+            {newBuff[insertion + (i >> CHUNK_CORRECTION_SHIFT)].elements[i & CHUNK_INDEX_MASK] = T(args...);}
 
             //increase the chunk size of this archtype and the total chunk count
             meta.size += reqChunks;
             m_column->m_totalChunks += reqChunks;
-            //increase the amount of free elements
-            meta.freeCount += (ChunkSize - (local+1));
+            //the rest of the last chunk is free
+            meta.freeCount += (reqChunks * ChunkSize) - count;
+        }
+
+        /**
+         * @brief release the empty chunks at the end of all archtypes
+         * 
+         * The remaining chunks are moved into a new, smaller buffer in one go. 
+         * 
+         * @param keep the amount of empty chunks every archtype keeps
+         * @return `i_chunk_t` the amount of released chunks
+         */
+        i_chunk_t releaseEmptyChunks(i_chunk_t keep) {
+            //count the chunks to release first, most of the time there are none
+            i_chunk_t released = 0;
+            for (const ArchtypeMeta& meta : m_column->m_knownTypes) {
+                i_chunk_t empty = meta.freeCount >> CHUNK_CORRECTION_SHIFT;
+                if (empty > keep) {released += empty - keep;}
+            }
+            if (released == 0) {return 0;}
+
+            //the archtypes are stored back to back, so walk them in storage order
+            std::vector<ArchtypeMeta*> order;
+            for (ArchtypeMeta& meta : m_column->m_knownTypes) {
+                if (meta.size > 0) {order.push_back(&meta);}
+            }
+            std::sort(order.begin(), order.end(), [](const ArchtypeMeta* a, const ArchtypeMeta* b) {return a->offset < b->offset;});
+
+            //rebind the allocator
+            using Alloc = typename std::allocator_traits<Allocator<StorageByte>>::template rebind_alloc<Chunk<T>>;
+            Alloc alloc = m_column->m_allocator;
+            i_chunk_t total = m_column->m_totalChunks - released;
+            Chunk<T>* oldBuff = reinterpret_cast<Chunk<T>*>(m_column->m_storage);
+            Chunk<T>* newBuff = (total > 0) ? alloc.allocate(total) : nullptr;
+
+            i_chunk_t next = 0;
+            for (ArchtypeMeta* meta : order) {
+                i_chunk_t empty = meta->freeCount >> CHUNK_CORRECTION_SHIFT;
+                i_chunk_t drop = (empty > keep) ? (empty - keep) : 0;
+                i_chunk_t kept = meta->size - drop;
+                //only the chunks at the front are kept, they hold all used slots
+                if constexpr (std::is_trivially_copyable_v<T>) {
+                    if (kept > 0) {memcpy(newBuff + next, oldBuff + meta->offset, kept*sizeof(Chunk<T>));}
+                } else {
+                    for (i_chunk_t i = 0; i < kept; ++i)
+                    {new (newBuff + next + i) Chunk<T>(std::move(oldBuff[meta->offset + i]));}
+                }
+                meta->offset = next;
+                meta->size = kept;
+                meta->freeCount -= drop * ChunkSize;
+                next += kept;
+            }
+
+            //free the old buffer
+            for (size_t i = 0; i < m_column->m_totalChunks; ++i)
+            {oldBuff[i].~Chunk<T>();}
+            alloc.deallocate(oldBuff, m_column->m_totalChunks);
+            m_column->m_storage = reinterpret_cast<uint8_t*>(newBuff);
+            m_column->m_totalChunks = total;
+            //increase the version (the storage changed)
+            ++m_column->m_version;
+
+            //the change ticks of released chunks are dropped as well
+            for (size_t archt = 0; archt < m_column->m_chunkTicks.size(); ++archt) {
+                i_chunk_t size = (archt < m_column->m_knownTypes.size()) ? m_column->m_knownTypes[archt].size : 0;
+                if (m_column->m_chunkTicks[archt].size() > size) {
+                    m_column->m_chunkTicks[archt].resize(size);
+                    m_column->m_chunkTicks[archt].shrink_to_fit();
+                }
+            }
+            return released;
         }
 
         /**
@@ -2639,7 +3470,7 @@ protected:
             //remove from all columns
             for (i_base_t entry = 0; entry < m_columns.size(); ++entry) {
                 //quarry the column and remove the element
-                m_world->m_columns[entry].removeElement(m_id, localId);
+                m_world->m_columns[m_columns[entry]].removeElement(m_id, localId);
             }
             //swap with the back entry and then pop
             EntityT updated = m_localToGlobal.back();
@@ -2919,19 +3750,257 @@ protected:
     };
 
     /**
-     * @brief a helper functor to hash a vector
+     * @brief the type-independent part of a sparse set that stores a single component type outside of the archtypes
+     * 
+     * The entities are stored densely. A paged sparse array maps entity indices to their position in the dense array, so 
+     * lookups, insertions and removals are O(1) and never move other components. 
      */
-    struct VectorHash {
+    class SparseSetBase {
+    public:
+
         /**
-         * @brief the functor caller
+         * @brief Destroy the Sparse Set Base
+         */
+        virtual ~SparseSetBase() = default;
+
+        /**
+         * @brief check if an entity has the component
          * 
-         * @tparam T the type of the vector elements
-         * @param v the full vector
-         * @return `std::size_t` the computed hash
+         * @param entity the entity to check
+         * @return `true` if the entity has the component, `false` otherwise
          */
-        template <typename T>
-        std::size_t operator()(const std::vector<T>& v) const {
-            //combine element-wise hashes of all elements
+        inline bool contains(EntityT entity) const noexcept
+        {return __find(entity) != NONE;}
+
+        /**
+         * @brief remove the component of an entity, does nothing if the entity does not have it
+         * 
+         * @param entity the entity to remove the component from
+         */
+        virtual void erase(EntityT entity) = 0;
+
+        /**
+         * @brief add the component of an entity to a lot of entities of a world
+         * 
+         * @param from the entity to copy the component from
+         * @param world the world the targets belong to
+         * @param targets the entities to add the component to
+         */
+        virtual void copyTo(EntityT from, World_t& world, std::span<const EntityT> targets) = 0;
+
+        /**
+         * @brief get all entities that have the component
+         * 
+         * @return `const std::vector<EntityT, Allocator<EntityT>>&` the entities in storage order
+         */
+        inline const std::vector<EntityT, Allocator<EntityT>>& entities() const noexcept
+        {return m_dense;}
+
+    protected:
+
+        /**
+         * @brief the amount of entity indices per page of the sparse array
+         */
+        static constexpr size_t PAGE_SIZE = 4096;
+        /**
+         * @brief the value used for entities that are not in the set
+         */
+        static constexpr uint32_t NONE = UINT32_MAX;
+
+        /**
+         * @brief get the dense position of an entity
+         * 
+         * @param entity the entity to search
+         * @return `uint32_t` the position in the dense array or `NONE` if the entity is not in the set
+         */
+        inline uint32_t __find(EntityT entity) const noexcept {
+            size_t page = entity.getIndex() / PAGE_SIZE;
+            if ((page >= m_pages.size()) || !m_pages[page]) {return NONE;}
+            uint32_t pos = m_pages[page][entity.getIndex() % PAGE_SIZE];
+            //the version must match as well, the index may belong to a destroyed entity
+            return ((pos != NONE) && (m_dense[pos] == entity)) ? pos : NONE;
+        }
+
+        /**
+         * @brief get the slot of the sparse array for an entity, allocating its page if needed
+         * 
+         * @param entity the entity to get the slot for
+         * @return `uint32_t&` a reference to the dense position of the entity
+         */
+        uint32_t& __slot(EntityT entity) {
+            size_t page = entity.getIndex() / PAGE_SIZE;
+            if (page >= m_pages.size()) {m_pages.resize(page + 1);}
+            if (!m_pages[page]) {
+                m_pages[page] = std::make_unique<uint32_t[]>(PAGE_SIZE);
+                std::fill_n(m_pages[page].get(), PAGE_SIZE, NONE);
+            }
+            return m_pages[page][entity.getIndex() % PAGE_SIZE];
+        }
+
+        /**
+         * @brief remove the entity at a dense position by swapping the last entity into its place
+         * 
+         * @param pos the dense position to remove
+         */
+        void __swapErase(uint32_t pos) {
+            EntityT removed = m_dense[pos];
+            EntityT last = m_dense.back();
+            m_dense[pos] = last;
+            __slot(last) = pos;
+            m_dense.pop_back();
+            __slot(removed) = NONE;
+        }
+
+        /**
+         * @brief the entities of the set
+         */
+        std::vector<EntityT, Allocator<EntityT>> m_dense;
+        /**
+         * @brief the pages of the sparse array, pages without entities are not allocated
+         */
+        std::vector<std::unique_ptr<uint32_t[]>> m_pages;
+    };
+
+    /**
+     * @brief a sparse set that stores the components of a single type
+     * 
+     * @tparam T the component type
+     */
+    template <typename T>
+    class SparseSet : public SparseSetBase {
+    public:
+
+        /**
+         * @brief add the component to an entity or overwrite the existing one
+         * 
+         * @tparam Args the argument types used for construction
+         * @param entity the entity to add the component to
+         * @param args the arguments used for construction
+         */
+        template <typename... Args>
+        void emplace(EntityT entity, Args&&... args) {
+            uint32_t pos = this->__find(entity);
+            if (pos != SparseSetBase::NONE) {
+                m_data[pos] = T(std::forward<Args>(args)...);
+                return;
+            }
+            this->__slot(entity) = static_cast<uint32_t>(this->m_dense.size());
+            this->m_dense.push_back(entity);
+            m_data.emplace_back(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief get the component of an entity
+         * 
+         * @param entity the entity to get the component of
+         * @return `T*` a pointer to the component or `nullptr` if the entity does not have it
+         */
+        inline T* get(EntityT entity) noexcept {
+            uint32_t pos = this->__find(entity);
+            return (pos != SparseSetBase::NONE) ? &m_data[pos] : nullptr;
+        }
+
+        /**
+         * @brief remove the component of an entity, does nothing if the entity does not have it
+         * 
+         * @param entity the entity to remove the component from
+         */
+        virtual void erase(EntityT entity) override {
+            uint32_t pos = this->__find(entity);
+            if (pos == SparseSetBase::NONE) {return;}
+            //keep the data in the same order as the entities
+            m_data[pos] = std::move(m_data.back());
+            m_data.pop_back();
+            this->__swapErase(pos);
+        }
+
+        /**
+         * @brief add the component of an entity to a lot of entities of a world
+         * 
+         * @param from the entity to copy the component from
+         * @param world the world the targets belong to
+         * @param targets the entities to add the component to
+         */
+        virtual void copyTo(EntityT from, World_t& world, std::span<const EntityT> targets) override {
+            if constexpr (std::is_copy_constructible_v<T>) {
+                T* value = get(from);
+                if (!value) {return;}
+                //the target set may be this set, so copy the value before the storage grows
+                T copy = *value;
+                SparseSet<T>& set = world.template __sparseSet<T>();
+                for (EntityT target : targets) {set.emplace(target, copy);}
+            } else {
+                throw Exception("Can not copy a sparse component that is not copy constructible");
+            }
+        }
+
+        /**
+         * @brief get all components in the same order as the entities
+         * 
+         * @return `std::vector<T, Allocator<T>>&` the components
+         */
+        inline std::vector<T, Allocator<T>>& data() noexcept
+        {return m_data;}
+
+    protected:
+
+        /**
+         * @brief the components, in the same order as the entities
+         */
+        std::vector<T, Allocator<T>> m_data;
+    };
+
+    /**
+     * @brief get the sparse set of a component type
+     * 
+     * @tparam T the component type
+     * @return `SparseSet<T>*` a pointer to the set or `nullptr` if no entity ever had the component
+     */
+    template <typename T>
+    inline SparseSet<T>* __findSparseSet() noexcept {
+        i_col_t tid = typeId<T>();
+        return (tid < m_sparse.size()) ? static_cast<SparseSet<T>*>(m_sparse[tid].get()) : nullptr;
+    }
+
+    /**
+     * @brief get the sparse set of a component type, creating it if it does not exist
+     * 
+     * @tparam T the component type
+     * @return `SparseSet<T>&` a reference to the set
+     */
+    template <typename T>
+    SparseSet<T>& __sparseSet() {
+        i_col_t tid = typeId<T>();
+        if (m_sparse.size() <= tid) {m_sparse.resize(tid + 1);}
+        if (!m_sparse[tid]) {m_sparse[tid] = std::make_unique<SparseSet<T>>();}
+        return *static_cast<SparseSet<T>*>(m_sparse[tid].get());
+    }
+
+    /**
+     * @brief check if an entity has a sparse component
+     * 
+     * @param column the type ID of the sparse component
+     * @param entity the entity to check
+     * @return `true` if the entity has the component, `false` otherwise
+     */
+    inline bool __hasSparse(i_col_t column, EntityT entity) const noexcept
+    {return (column < m_sparse.size()) && m_sparse[column] && m_sparse[column]->contains(entity);}
+
+    /**
+     * @brief a helper functor to hash a vector
+     */
+    struct VectorHash {
+        /**
+         * @brief the functor caller
+         * 
+         * @tparam T the type of the vector elements
+         * @tparam A the allocator of the vector
+         * @param v the full vector
+         * @return `std::size_t` the computed hash
+         */
+        template <typename T, typename A>
+        std::size_t operator()(const std::vector<T, A>& v) const {
+            //combine element-wise hashes of all elements
             std::size_t h = 0;
             for (const auto& elem : v) {
                 h ^= std::hash<T>{}(elem) + 0x9e3779b9 + (h << 6) + (h >> 2);
@@ -2972,7 +4041,7 @@ protected:
      * @param tids the type IDs of the columns for the archtype
      * @return `i_arch_t` the archtype ID 
      */
-    i_arch_t archtypeId(std::vector<i_col_t>& tids) {
+    i_arch_t archtypeId(std::vector<i_col_t, Allocator<i_col_t>>& tids) {
         //compute the sorted type ID list
         std::sort(tids.begin(), tids.end());
 
@@ -2998,7 +4067,7 @@ protected:
     template <typename... Ts>
     i_arch_t archtypeId() noexcept {
         //compute the sorted type ID list
-        std::vector<i_col_t> tids = {typeId<Ts>()...};
+        std::vector<i_col_t, Allocator<i_col_t>> tids = {typeId<Ts>()...};
         std::sort(tids.begin(), tids.end());
 
         //check if the type is known
@@ -3040,6 +4109,228 @@ protected:
         }
     }
 
+    /**
+     * @brief stamp a range of elements of an archtype as changed in all columns of the archtype
+     * 
+     * @param archtype the archtype the elements belong to
+     * @param first the first archtype local index
+     * @param end the archtype local index behind the last element
+     */
+    void __touchStructural(i_arch_t archtype, i_base_t first, i_base_t end) {
+        for (i_col_t col : m_arches[archtype].m_columns)
+        {m_columns[col].touchRange(archtype, first, end, m_tick);}
+    }
+
+    /**
+     * @brief stamp all columns that an iteration writes to as changed
+     * 
+     * @tparam Components the components of the iteration
+     * @param archtype the archtype that is iterated
+     * @param writers the write flags, indexed like the components
+     */
+    template <typename... Components>
+    inline void __touchWriters(i_arch_t archtype, const bool* writers) noexcept {
+        ((writers[util::index_of<Components, util::type_list<Components...>>::value] ? m_columns[typeId<Components>()].touchAll(archtype, m_tick) : void()), ...);
+    }
+
+    /**
+     * @brief stamp a single chunk of all columns of a query that are written to
+     * 
+     * @tparam Components the components of the query
+     * @param archtype the archtype that is iterated
+     * @param chunk the archtype local index of the chunk
+     * @param writers for each component if it is written to (in the order of the components)
+     */
+    template <typename... Components>
+    inline void __touchWritersChunk(i_arch_t archtype, size_t chunk, const bool* writers) noexcept {
+        ((writers[util::index_of<Components, util::type_list<Components...>>::value] ? m_columns[typeId<Components>()].touch(archtype, chunk * ChunkSize, m_tick) : void()), ...);
+    }
+
+    /**
+     * @brief check if any of the columns of a query changed in a chunk after a specific tick
+     * 
+     * @tparam Components the components of the query
+     * @param archtype the archtype that is iterated
+     * @param chunk the archtype local index of the chunk
+     * @param since the tick to compare against
+     * @return `true` if any of the components was written to after the tick, `false` otherwise
+     */
+    template <typename... Components>
+    inline bool __chunkChanged(i_arch_t archtype, size_t chunk, tick_t since) const noexcept 
+    {return ((m_columns[typeId<Components>()].chunkTick(archtype, chunk) > since) || ...);}
+
+    /**
+     * @brief a filter that accepts every entity
+     */
+    struct AcceptAll {
+        /**
+         * @brief accept an entity
+         * 
+         * @return `true` always
+         */
+        constexpr bool operator()(EntityT) const noexcept
+        {return true;}
+    };
+
+    /**
+     * @brief run a function on all entities of a list of archtypes
+     * 
+     * @tparam Components the components passed to the function, all archtypes must store them
+     * @tparam Func the function to call
+     * @tparam Filter a predicate that selects the entities to pass to the function
+     * @param archtypes the archtypes to iterate
+     * @param fn the function to call
+     * @param filter a predicate that selects the entities to pass to the function
+     */
+    template <typename ...Components, typename Func, typename Filter = AcceptAll>
+    void __eachIn(const std::vector<i_arch_t>& archtypes, Func&& fn, const Filter& filter = Filter{}) {
+        static_assert(!(sparse_storage_v<Components> || ...), "Sparse components are not part of archtypes, use a query filter or `each_sparse`");
+        std::array<ColumnId, sizeof...(Components)> tids = {(ColumnId{typeId<Components>(), util::index_of<Components, util::type_list<Components...>>::value}) ...};
+        std::sort(tids.begin(), tids.end());
+        bool writers[sizeof...(Components)] = {(util::wants_write_v<Components, typename util::type_at<util::index_of<Components, util::type_list<Components...>>::value, typename util::function_traits<std::remove_cvref_t<Func>>::param_types>::type>)...};
+
+        //play back all archtypes and iterate over them
+        for (i_arch_t archt : archtypes) {
+
+            //lock the columns
+            typename ColumnLock::LockKey keys[sizeof...(Components)] = {m_columns[tids[util::index_of<Components, util::type_list<Components...>>::value].column].m_lock.lock(archt, writers[tids[util::index_of<Components, util::type_list<Components...>>::value].local]) ...};
+            //all written components change
+            __touchWriters<Components...>(archt, writers);
+
+            //quarry size and starting positions
+            i_base_t size = m_arches[archt].m_localToGlobal.size();
+            std::tuple<Components*...> columns = {reinterpret_cast<Components*>(m_columns[typeId<Components>()].get(archt, 0))...};
+            //play back for all entries
+            for (size_t i = 0; i < size; ++i) {
+                //invoke the function
+                if (filter(m_arches[archt].m_localToGlobal[i])) {invokeEach<Func, Components...>(fn, m_arches[archt], i, columns);}
+                //step the pointer
+                (++std::get<Components*>(columns), ...);
+            }
+        }
+    }
+
+    /**
+     * @brief run a function on all entities of a list of archtypes in parallel
+     * 
+     * @tparam Components the components passed to the function, all archtypes must store them
+     * @tparam Func the function to call
+     * @tparam FiberCount the amount of fibers the employer has per thread
+     * @tparam Filter a predicate that selects the entities to pass to the function
+     * @param archtypes the archtypes to iterate
+     * @param fn the function to call
+     * @param employer the employer to utilize for threading
+     * @param filter a predicate that selects the entities to pass to the function, it is called from multiple threads
+     */
+    template <typename ...Components, typename Func, size_t FiberCount, typename Filter = AcceptAll>
+    void __parallelEachIn(const std::vector<i_arch_t>& archtypes, Func&& fn, Jobs::Employer_t<FiberCount>& employer, const Filter& filter = Filter{}) {
+        static_assert(!(sparse_storage_v<Components> || ...), "Sparse components are not part of archtypes, use a query filter or `each_sparse`");
+        std::array<ColumnId, sizeof...(Components)> tids = {(ColumnId{typeId<Components>(), util::index_of<Components, util::type_list<Components...>>::value}) ...};
+        std::sort(tids.begin(), tids.end());
+        bool writers[sizeof...(Components)] = {(util::wants_write_v<Components, typename util::type_at<util::index_of<Components, util::type_list<Components...>>::value, typename util::function_traits<std::remove_cvref_t<Func>>::param_types>::type>)...};
+
+        //play back all archtypes and iterate over them
+        for (i_arch_t archt : archtypes) {
+
+            //compute the amount of tasks required (complicated because underflow prevention is required)
+            i_base_t count = m_arches[archt].m_localToGlobal.size();
+            size_t freeChunks = (m_columns[tids[0].column].getArchtypeMeta(archt).freeCount / ChunkSize);
+            size_t taskCount = ((count + (ChunkSize - 1)) / ChunkSize);
+            if (taskCount > freeChunks) {taskCount -= ((freeChunks > 0) ? 0 : (freeChunks - 1));}
+            auto workerTask = [&](size_t chunkId, std::tuple<Components*...> localColumns) {
+                //compute start and end index
+                size_t startIdx = chunkId * ChunkSize;
+                size_t endIdx = ((chunkId + 1) * ChunkSize);
+                if (endIdx > count) {endIdx = count;}
+                //set all the starting positions in the tuple
+                ((std::get<Components*>(localColumns) += startIdx), ...);
+                //iterate over the chunk
+                for (size_t i = startIdx; i < endIdx; ++i) {
+                    //invoke the function
+                    if (filter(m_arches[archt].m_localToGlobal[i])) {invokeEach<Func, Components...>(fn, m_arches[archt], i, localColumns);}
+                    //advance the pointers
+                    ((++std::get<Components*>(localColumns)), ...);
+                }
+            };
+
+            //lock the columns
+            typename ColumnLock::LockKey keys[sizeof...(Components)] = {m_columns[tids[util::index_of<Components, util::type_list<Components...>>::value].column].m_lock.lock(archt, writers[tids[util::index_of<Components, util::type_list<Components...>>::value].local]) ...};
+            //all written components change
+            __touchWriters<Components...>(archt, writers);
+
+            //quarry size and starting positions
+            std::tuple<Components*...> columns = {reinterpret_cast<Components*>(m_columns[typeId<Components>()].get(archt, 0))...};
+            //create the tasks
+            Jobs::BulkTask tasks(taskCount, workerTask, columns);
+
+            //run the jobs and wait for them to be done
+            employer.run_bulk(tasks);
+        }
+    }
+
+
+    /**
+     * @brief collect all archtypes that store AT LEAST a set of columns
+     * 
+     * @tparam N the amount of columns
+     * @param tids the columns that are required
+     * @return `std::vector<i_arch_t>` the IDs of all matching archtypes, empty if one of the columns does not exist
+     */
+    template <size_t N>
+    std::vector<i_arch_t> __matchArchtypes(const std::array<ColumnId, N>& tids) const {
+        std::vector<i_arch_t> archtypes;
+        //check if the columns exists
+        for (size_t i = 0; i < N; ++i) {
+            if ((tids[i].column >= m_columns.size()) || (m_columns[tids[i].column].m_world == nullptr)) {return archtypes;}
+        }
+
+        archtypes.reserve(m_archtypeResolution.size());
+        __matchArchtypes(tids, 0, archtypes);
+        return archtypes;
+    }
+
+    /**
+     * @brief collect all archtypes starting at a specific archtype ID that store AT LEAST a set of columns
+     * 
+     * Archtype IDs are handed out incrementally and never change, so only the new archtypes must be checked to update 
+     * a list of matching archtypes. 
+     * 
+     * @tparam N the amount of columns
+     * @param tids the columns that are required
+     * @param first the first archtype ID to check
+     * @param archtypes the vector to append the IDs of all matching archtypes to
+     */
+    template <size_t N>
+    void __matchArchtypes(const std::array<ColumnId, N>& tids, size_t first, std::vector<i_arch_t>& archtypes) const {
+        for (size_t i = first; i < m_archtypeResolution.size(); ++i) {
+            //check if this satisfies the combination
+            size_t found = 0;
+            for (size_t j = 0; j < m_archtypeResolution[i].size(); ++j) {
+                for (size_t k = 0; k < N; ++k) {
+                    if (m_archtypeResolution[i][j] == tids[k].column) {
+                        ++found;
+                        break;
+                    }
+                }
+            }
+            //if all were found, add to the combination count
+            if (found == N) {archtypes.push_back(i);}
+        }
+    }
+
+    /**
+     * @brief store the current change tick
+     */
+    tick_t m_tick = 1;
+    /**
+     * @brief the allocator that new columns use for their chunk storage
+     */
+    Allocator<uint8_t> m_storageAllocator;
+    /**
+     * @brief the column the next call to `compact` starts at
+     */
+    size_t m_compactCursor = 0;
+
     /**
      * @brief store all the columns
      * 
@@ -3060,6 +4351,10 @@ protected:
      * @brief store the entity IDs of free elements
      */
     std::vector<size_t> m_freeList;
+    /**
+     * @brief store the sparse sets of all sparse components, indexed by the type ID of the component
+     */
+    std::vector<std::unique_ptr<SparseSetBase>> m_sparse;
 
     /**
      * @brief a mapping that resolves archtype IDs into `std::vector<i_col_t>` - a list of type IDs for all subtypes
@@ -3076,6 +4371,179 @@ protected:
         Allocator<std::pair<const std::vector<i_col_t, Allocator<i_col_t>>, i_arch_t>>
     > m_archtypeMap;
 
+public:
+
+    /**
+     * @brief a persistent query for all entities that have AT LEAST a set of components
+     * 
+     * The query caches the archtypes that match its components. Archtype IDs are never re-used, so when new archtypes 
+     * appear only those are checked and the cached list grows incrementally. Iterating does not re-evaluate the 
+     * signature against the archtypes that where allready known. 
+     * 
+     * @warning the query refers to the world it was created for and must not outlive it
+     * 
+     * @tparam Components the components that are AT LEAST required
+     */
+    template <typename... Components>
+    class Query {
+    public:
+
+        /**
+         * @brief Construct a new Query
+         * 
+         * @param world the world to query
+         */
+        Query(World_t& world)
+         : m_world(&world),
+           m_tids{(ColumnId{typeId<Components>(), util::index_of<Components, util::type_list<Components...>>::value}) ...}
+        {std::sort(m_tids.begin(), m_tids.end());}
+
+        /**
+         * @brief get all archtypes that match the query
+         * 
+         * @return `const std::vector<archtype_t>&` the IDs of all matching archtypes
+         */
+        inline const std::vector<archtype_t>& archtypes() {
+            __update();
+            return m_archtypes;
+        }
+
+        /**
+         * @brief count the entities that match the query
+         * 
+         * @return `size_t` the amount of matching entities
+         */
+        size_t count() {
+            __update();
+            size_t total = 0;
+            for (i_arch_t archt : m_archtypes) {total += m_world->m_arches[archt].m_localToGlobal.size();}
+            return total;
+        }
+
+        /**
+         * @brief run a function on all entities that match the query
+         * 
+         * @tparam Func the function to call
+         * @param fn the function to call
+         */
+        template <typename Func>
+        void each(Func&& fn) {
+            __update();
+            if (m_with.empty() && m_without.empty())
+            {m_world->template __eachIn<Components...>(m_archtypes, std::forward<Func>(fn));}
+            else
+            {m_world->template __eachIn<Components...>(m_archtypes, std::forward<Func>(fn), SparseFilter{this});}
+        }
+
+        /**
+         * @brief run a function on all entities that match the query in parallel
+         * 
+         * @tparam Func the function to call
+         * @tparam FiberCount the amount of fibers the employer has per thread
+         * @param fn the function to call
+         * @param employer the employer to utilize for threading
+         */
+        template <typename Func, size_t FiberCount>
+        void parallel_each(Func&& fn, Jobs::Employer_t<FiberCount>& employer) {
+            __update();
+            if (m_with.empty() && m_without.empty())
+            {m_world->template __parallelEachIn<Components...>(m_archtypes, std::forward<Func>(fn), employer);}
+            else
+            {m_world->template __parallelEachIn<Components...>(m_archtypes, std::forward<Func>(fn), employer, SparseFilter{this});}
+        }
+
+        /**
+         * @brief only visit entities that have all of a set of sparse components
+         * 
+         * The sparse components are not passed to the iteration function, use `get` to access them. 
+         * 
+         * @tparam Ts the sparse components that are required
+         * @return `Query&` a reference to this query
+         */
+        template <typename... Ts>
+        Query& with() {
+            static_assert((sparse_storage_v<Ts> && ...), "Only sparse components can be used as a query filter");
+            (m_with.push_back(typeId<Ts>()), ...);
+            return *this;
+        }
+
+        /**
+         * @brief skip entities that have any of a set of sparse components
+         * 
+         * @tparam Ts the sparse components that are excluded
+         * @return `Query&` a reference to this query
+         */
+        template <typename... Ts>
+        Query& without() {
+            static_assert((sparse_storage_v<Ts> && ...), "Only sparse components can be used as a query filter");
+            (m_without.push_back(typeId<Ts>()), ...);
+            return *this;
+        }
+
+    protected:
+
+        /**
+         * @brief a filter that checks the sparse components of an entity
+         */
+        struct SparseFilter {
+            /**
+             * @brief the query that owns the filter
+             */
+            const Query* query;
+
+            /**
+             * @brief check if an entity passes the sparse filters of the query
+             * 
+             * @param entity the entity to check
+             * @return `true` if the entity has all required and none of the excluded sparse components, `false` otherwise
+             */
+            bool operator()(EntityT entity) const noexcept {
+                for (i_col_t col : query->m_with) {
+                    if (!query->m_world->__hasSparse(col, entity)) {return false;}
+                }
+                for (i_col_t col : query->m_without) {
+                    if (query->m_world->__hasSparse(col, entity)) {return false;}
+                }
+                return true;
+            }
+        };
+
+        /**
+         * @brief add all matching archtypes that where created since the last update
+         */
+        inline void __update() {
+            //nothing to do if no archtype was created since the last update
+            if (m_known == m_world->m_archtypeResolution.size()) {return;}
+            m_world->__matchArchtypes(m_tids, m_known, m_archtypes);
+            m_known = m_world->m_archtypeResolution.size();
+        }
+
+        /**
+         * @brief the world the query belongs to
+         */
+        World_t* m_world;
+        /**
+         * @brief the sorted columns the query requires
+         */
+        std::array<ColumnId, sizeof...(Components)> m_tids;
+        /**
+         * @brief the amount of archtype IDs that where checked allready
+         */
+        size_t m_known = 0;
+        /**
+         * @brief the IDs of all matching archtypes
+         */
+        std::vector<i_arch_t> m_archtypes;
+        /**
+         * @brief the type IDs of all sparse components an entity must have
+         */
+        std::vector<i_col_t> m_with;
+        /**
+         * @brief the type IDs of all sparse components an entity must not have
+         */
+        std::vector<i_col_t> m_without;
+    };
+
 };
 
 /**
@@ -68,6 +68,16 @@
 #include <condition_variable>
 //for a queue
 #include <queue>
+//for the work stealing deques
+#include <deque>
+//for passing exceptions out of parallel loops
+#include <exception>
+//for shared ownership of continuations
+#include <memory>
+//for stackless tasks
+#include <coroutine>
+//for std::exchange
+#include <utility>
 //for math
 #include <cmath>
 //for memory operations
@@ -75,6 +85,13 @@
 //standard defines
 #include <cstddef>
 
+//includes for CPU pause hints while spinning
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_M_ARM64) || defined(_M_ARM)
+#include <intrin.h>
+#endif
+
 //includes for thread pinning on different Oses
 #if defined(__linux__)
 #include <pthread.h>
@@ -223,8 +240,62 @@ consteval uint64_t type_hash() {
     return hash_string(raw_type_name<T>());
 }
 
+/**
+ * @brief tell the CPU that the calling thread is spinning
+ * 
+ * Lowers the power draw of the spin and leaves more resources to the other hardware thread of the core. 
+ * 
+ * @ingroup Utilities
+ */
+inline void spin_pause() noexcept(true) {
+    #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+    #elif defined(_M_ARM64) || defined(_M_ARM)
+    __yield();
+    #elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+    #else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    #endif
+}
+
 }
 
+/**
+ * @brief describe how threads wait for work or for other tasks to finish
+ * 
+ * A waiting thread first spins with a CPU pause hint, then gives its time slice away and finally parks until it is 
+ * notified. Spinning answers fastest but burns a core, parking is free but costs a wake up. 
+ * 
+ * @ingroup Employer
+ */
+struct WaitPolicy {
+    /**
+     * @brief the amount of checks with a CPU pause hint before yielding
+     */
+    uint32_t spins = 128;
+    /**
+     * @brief the amount of checks that yield the time slice before parking
+     */
+    uint32_t yields = 8;
+
+    /**
+     * @brief a policy for the lowest latency, waiting threads keep the core for a long time
+     * 
+     * @return `WaitPolicy` the policy
+     */
+    inline static constexpr WaitPolicy latency() noexcept(true)
+    {return WaitPolicy{.spins = 8192, .yields = 256};}
+
+    /**
+     * @brief a policy for the lowest CPU usage, waiting threads park right away
+     * 
+     * @return `WaitPolicy` the policy
+     */
+    inline static constexpr WaitPolicy power() noexcept(true)
+    {return WaitPolicy{.spins = 0, .yields = 0};}
+};
+
 /**
  * @brief a custom exception class to make exception capturing possible
  * 
@@ -353,7 +424,7 @@ public:
         if constexpr (sizeof(T) > SMALL_BUFFER_SIZE)
         {return *reinterpret_cast<T*>(m_data.large_ptr);}
         else
-        {return *reinterpret_cast<T*>(m_data.small_buff);}
+        {return *reinterpret_cast<T*>(m_data.small_buff.buff);}
     }
 
     /**
@@ -376,7 +447,7 @@ public:
         if constexpr (sizeof(T) > SMALL_BUFFER_SIZE)
         {return *reinterpret_cast<const T*>(m_data.large_ptr);}
         else
-        {return *reinterpret_cast<const T*>(m_data.small_buff);}
+        {return *reinterpret_cast<const T*>(m_data.small_buff.buff);}
     }
 
     /**
@@ -432,15 +503,13 @@ public:
                 if (value.m_move) {value.m_move(this, &value);}
             }
         } else {
+            //clean up the old value, it may be of a different type
+            if (m_destroy) {m_destroy(this);}
             //initialize the value storage
-            if constexpr (sizeof(T) > SMALL_BUFFER_SIZE) {
-                delete reinterpret_cast<T*>(m_data.large_ptr);
-                m_data.large_ptr =  reinterpret_cast<void*>(new T(value));
-            } 
-            else {
-                reinterpret_cast<T*>(m_data.small_buff.buff)->~T();
-                new (m_data.small_buff.buff) T(std::forward<T>(value));
-            }
+            if constexpr (sizeof(T) > SMALL_BUFFER_SIZE) 
+            {m_data.large_ptr =  reinterpret_cast<void*>(new std::decay_t<T>(std::forward<T>(value)));} 
+            else 
+            {new (m_data.small_buff.buff) std::decay_t<T>(std::forward<T>(value));}
 
             //setup the lambdas
             __createLambdas<T>(*this);
@@ -471,15 +540,13 @@ public:
                 if (value.m_copy) {value.m_copy(this, &value);}
             }
         } else {
+            //clean up the old value, it may be of a different type
+            if (m_destroy) {m_destroy(this);}
             //initialize the value storage
-            if constexpr (sizeof(T) > SMALL_BUFFER_SIZE) {
-                delete reinterpret_cast<T*>(m_data.large_ptr);
-                m_data.large_ptr =  reinterpret_cast<void*>(new T(value));
-            } 
-            else {
-                reinterpret_cast<T*>(m_data.small_buff)->~T();
-                new (m_data.small_buff) T(value);
-            }
+            if constexpr (sizeof(T) > SMALL_BUFFER_SIZE) 
+            {m_data.large_ptr =  reinterpret_cast<void*>(new T(value));} 
+            else 
+            {new (m_data.small_buff.buff) T(value);}
 
             //setup the lambdas
             __createLambdas<T>(*this);
@@ -871,6 +938,95 @@ protected:
 
 };
 
+/**
+ * @brief a list of functions that are called once something completes
+ * 
+ * Waiters may be added from any thread at any time. Waiters that are added after completion are not stored, the caller 
+ * has to handle them instead. 
+ * 
+ * @ingroup Utilities
+ */
+class Completion {
+public:
+
+    /**
+     * @brief an entry of the list, usually the base of a larger structure
+     */
+    struct Waiter {
+        /**
+         * @brief the next waiter in the list
+         */
+        Waiter* next = nullptr;
+        /**
+         * @brief the function that is called on completion, it takes over the ownership of the waiter
+         */
+        void (*fire)(Waiter*) = nullptr;
+    };
+
+    /**
+     * @brief add a waiter to the list
+     * 
+     * @param waiter the waiter to add
+     * @return `true` if the waiter was added, `false` if the completion allready happened and the waiter was not added
+     */
+    bool push(Waiter* waiter) noexcept(true) {
+        Waiter* head = m_head.load(std::memory_order_acquire);
+        do {
+            if (head == __done()) {return false;}
+            waiter->next = head;
+        } while (!m_head.compare_exchange_weak(head, waiter, std::memory_order_acq_rel, std::memory_order_acquire));
+        return true;
+    }
+
+    /**
+     * @brief mark the completion and call all waiters
+     * 
+     * Only the first call does something. 
+     */
+    void complete() {
+        Waiter* head = m_head.exchange(__done(), std::memory_order_acq_rel);
+        if (head == __done()) {return;}
+        while (head) {
+            //the waiter may be freed by its function
+            Waiter* next = head->next;
+            head->fire(head);
+            head = next;
+        }
+    }
+
+    /**
+     * @brief check if the completion happened
+     * 
+     * @return `true` if it completed, `false` otherwise
+     */
+    inline bool completed() const noexcept(true)
+    {return m_head.load(std::memory_order_acquire) == __done();}
+
+    /**
+     * @brief reset to the not completed state
+     * 
+     * @warning must only be called when nothing is waiting
+     */
+    inline void reset() noexcept(true)
+    {m_head.store(nullptr, std::memory_order_release);}
+
+protected:
+
+    /**
+     * @brief get the marker that is stored once the completion happened
+     * 
+     * @return `Waiter*` the marker, it is never a valid waiter
+     */
+    inline static Waiter* __done() noexcept(true)
+    {return reinterpret_cast<Waiter*>(uintptr_t(1));}
+
+    /**
+     * @brief the most recently added waiter or the completion marker
+     */
+    std::atomic<Waiter*> m_head{nullptr};
+
+};
+
 /**
  * @brief a class that builds and owns a DAG-tree
  * 
@@ -935,7 +1091,10 @@ public:
          : task(other.task),
            unmet(other.unmet.load(std::memory_order_relaxed)),
            childCount(other.childCount),
-           owner(other.owner)
+           owner(other.owner),
+           pending(other.pending),
+           onDone(other.onDone),
+           userData(other.userData)
         {
             //copy array
             for (ChildIntegral_t i = 0; i < other.childCount; ++i) {
@@ -947,6 +1106,9 @@ public:
             other.unmet.store(0, std::memory_order_relaxed);
             other.childCount = 0;
             other.owner = nullptr;
+            other.pending = nullptr;
+            other.onDone = nullptr;
+            other.userData = nullptr;
         }
 
         //no copy stuff nor move assignment
@@ -974,6 +1136,22 @@ public:
          * @brief store a pointer to the owning job
          */
         Job* owner = nullptr;
+        /**
+         * @brief an optional counter that is decremented once the worker does not touch the node anymore
+         * 
+         * Lets the creator of short lived nodes know when the node and its task may be freed. 
+         */
+        std::atomic_size_t* pending = nullptr;
+        /**
+         * @brief an optional function that is called with `userData` once the task ran
+         * 
+         * The worker does not touch the node after the call, so the function may free it. 
+         */
+        void (*onDone)(void*) = nullptr;
+        /**
+         * @brief the data to pass to `onDone`
+         */
+        void* userData = nullptr;
     };
 
     /**
@@ -1067,6 +1245,8 @@ public:
         if (taskCount == 0) {
             m_leftTotalTasks.store(0, std::memory_order_relaxed);
             m_state.store(State::READY, std::memory_order_release);
+            //nothing will ever run, so the job is done right away
+            m_completion.complete();
             return;
         }
 
@@ -1219,8 +1399,11 @@ public:
         //job finally done
         m_leftTotalTasks.fetch_sub(1, std::memory_order_acq_rel);
         //check for finished
-        if (m_leftTotalTasks.load(std::memory_order_acquire) == 0)
-        {m_state.store(State::FINISHED, std::memory_order_release);}
+        if (m_leftTotalTasks.load(std::memory_order_acquire) == 0) {
+            m_state.store(State::FINISHED, std::memory_order_release);
+            //release everything that waits for the job
+            m_completion.complete();
+        }
     }
 
     /**
@@ -1251,9 +1434,21 @@ public:
     bool reset() noexcept(true) {
         //switch it to the unordered state to allow rebuilding
         State expected = State::FINISHED;
-        return m_state.compare_exchange_strong(expected, State::UNORDERED);
+        if (!m_state.compare_exchange_strong(expected, State::UNORDERED)) {return false;}
+        m_completion.reset();
+        return true;
     }
 
+    /**
+     * @brief access the completion of the job
+     * 
+     * It completes once all tasks of the job ran. Use `Employer_t::when_done` to continue from a job. 
+     * 
+     * @return `Completion&` a reference to the completion of the job
+     */
+    inline Completion& completion() noexcept(true)
+    {return m_completion;}
+
 protected:
 
     /**
@@ -1397,6 +1592,10 @@ protected:
      * @brief store if tasks are left to be given out
      */
     std::atomic_bool m_tasksLeft{false};
+    /**
+     * @brief completes once all tasks of the job ran
+     */
+    Completion m_completion;
 
 };
 
@@ -1577,192 +1776,1364 @@ protected:
 
 };
 
+//the employer is needed as a friend class of shared tasks
+template <size_t FIBER_COUNT>
+requires (FIBER_COUNT > 0)
+class Employer_t;
+
+namespace util {
+//coroutines store their result in a shared task
+struct PromiseBase;
+}
+
 /**
- * @brief a structure responsible for scheduling and running jobs in a multi-threaded way
+ * @brief a handle to a task on an employer that other tasks can continue from
  * 
- * @note This class can be neither copied nor moved. 
+ * Shared tasks are created by `Employer_t::async`, `then`, `when_all`, `when_any` and `when_done`. The task and its 
+ * result stay alive as long as a handle or a continuation refers to them. A continuation is queued by the thread that 
+ * completes its last input, so no thread waits for it. 
  * 
- * @tparam FIBER_COUNT the amount of fibers the employer offers per thread. It must be at least 1. To disabler fibers, use the define or option in the compiler. 
+ * If a task throws, the exception is stored. Continuations of a failed task don't run, they fail with the same 
+ * exception. 
  * 
- * @ingroup Scheduler
+ * @note This class can be moved and copied. 
+ * 
+ * @ingroup Tasks
  */
-template <size_t FIBER_COUNT = 8>
-requires (FIBER_COUNT > 0)
-class Employer_t {
+class SharedTask {
 public:
 
     /**
-     * @brief Construct a new Employer
-     * 
-     * @param threads the amount of threads to creat (0 = auto)
-     * @param autostart `true` to start on creation, `false` otherwise
-     * @param pinStart the offset of cores to pin to
+     * @brief Construct a new, empty Shared Task
      */
-    Employer_t(uint32_t threads = 0, bool autostart = true, uint32_t pinStart = 0) {
-        //if threads is 0, set to 1 (minimum)
-        threads = (threads == 0) ? (std::thread::hardware_concurrency()-1) : threads;
-        if (threads == 0) 
-        {threads = 1;}
-
-        //store the worker count
-        m_workerCount = threads;
-
-        //prepare the workers
-        m_worker = new Worker[m_workerCount]();
-
-        //if starting requested, start
-        if (autostart)
-        {start(pinStart);}
-    }
+    SharedTask() = default;
 
     /**
-     * @brief Destroy the Employer
+     * @brief check if the handle refers to a task
+     * 
+     * @return `true` if it refers to a task, `false` if it is empty
      */
-    ~Employer_t() {
-        shutdown();
-
-        //clean up
-        delete[] m_worker;
-        m_worker = nullptr;
-    }
-
-    //cannot be moved nor copied
-    Employer_t(const Employer_t&) = delete;
-    Employer_t(Employer_t&&) = delete;
-    Employer_t& operator=(const Employer_t&) = delete;
-    Employer_t& operator=(Employer_t&&) = delete;
+    inline bool valid() const noexcept(true)
+    {return m_state != nullptr;}
 
     /**
-     * @brief add a job to the system
+     * @brief check if the task completed
      * 
-     * @param job a pointer to the job to queue
+     * @return `true` if the task ran or failed, `false` if it is still pending or the handle is empty
      */
-    void add(Job* job) {
-        //can't add on shutdown
-        if (m_locked.load(std::memory_order_acquire))
-        {return;}
-        //pull initial nodes
-        while (Job::TaskNode* node = job->next()) {
-            //queue the nodes and register the work
-            m_todo.fetch_add(1, std::memory_order_acq_rel);
-            m_queuedWork.fetch_add(1, std::memory_order_acq_rel);
-            uint32_t idx = m_roundRobinNext.fetch_add(1, std::memory_order_relaxed) % m_workerCount;
-            //switch implementation between lockfree / non-lockfree
-            #ifndef TINY_JOBS_NO_LOCKFREE
-            m_worker[idx].tasks.enqueue(node);
-            #else
-            //first, lock
-            std::unique_lock lock(m_worker[idx].queueMtx);
-            //then push to the queue
-            m_worker[idx].tasks.push(node);
-            #endif
-            //wake up the thread if it was sleeping
-            if (m_worker[idx].sleeping.load(std::memory_order_acquire))
-            {m_worker[idx].cv.notify_one();}
-        }
-    }
+    inline bool done() const noexcept(true)
+    {return m_state && m_state->completion.completed();}
 
     /**
-     * @brief a function to add a single task node
-     * 
-     * This is used to add a single task
+     * @brief check if the task or one of its inputs threw
      * 
-     * @param node a pointer to the node
+     * @return `true` if the task completed with an exception, `false` otherwise
      */
-    void add(Job::TaskNode* node) {
-        //can't add on shutdown
-        if (m_locked.load(std::memory_order_acquire))
-        {return;}
-        //queue the nodes and register the work
-        m_todo.fetch_add(1, std::memory_order_acq_rel);
-        m_queuedWork.fetch_add(1, std::memory_order_acq_rel);
-        uint32_t idx = m_roundRobinNext.fetch_add(1, std::memory_order_relaxed) % m_workerCount;
-        //switch implementation between lockfree / non-lockfree
-        #ifndef TINY_JOBS_NO_LOCKFREE
-        m_worker[idx].tasks.enqueue(node);
-        #else
-        //first, lock
-        std::unique_lock lock(m_worker[idx].queueMtx);
-        //then push to the queue
-        m_worker[idx].tasks.push(node);
-        #endif
-        //wake up the thread if it was sleeping
-        if (m_worker[idx].sleeping.load(std::memory_order_acquire))
-        {m_worker[idx].cv.notify_one();}
-    }
+    inline bool failed() const noexcept(true)
+    {return done() && m_state->failed.load(std::memory_order_acquire);}
 
     /**
-     * @brief add a lot of new nodes
+     * @brief get the exception the task failed with
      * 
-     * @param nodes the nodes to add
-     * @param count the amount of nodes
+     * @return `std::exception_ptr` the exception or `nullptr` if the task did not fail
      */
-    void add_bulk(Job::TaskNode** nodes, uint64_t count) {
-        //can't add on shutdown
-        if (m_locked.load(std::memory_order_acquire))
-        {return;}
-        //register the work
-        m_todo.fetch_add(count, std::memory_order_acq_rel);
-        m_queuedWork.fetch_add(count, std::memory_order_acq_rel);
-        //divide the load equally
-        uint64_t step = (count + (m_workerCount-1)) / m_workerCount;
-        uint64_t pos = 0;
-        //add all elements
-        for (size_t i = 0; i < m_workerCount; ++i) {
-            //compute how much work to add
-            uint64_t delta = step;
-            if ((pos + delta) > count)
-            {delta = count-pos;}
-            //if delta is 0, just stop
-            if (delta == 0) {break;}
-            //switch implementation between lockfree / non-lockfree
-            #ifndef TINY_JOBS_NO_LOCKFREE
-            m_worker[i].tasks.enqueue_bulk(nodes + pos, delta);
-            #else
-            //first, lock
-            std::unique_lock lock(m_worker[i].queueMtx);
-            //then push to the queue
-            for (size_t j = 0; j < delta; ++j)
-            {m_worker[i].tasks.push(nodes[pos + j]);}
-            #endif
-            //wake up the thread if it was sleeping
-            if (m_worker[i].sleeping.load(std::memory_order_acquire))
-            {m_worker[i].cv.notify_one();}
-            //step forward
-            pos += delta;
-        }
-    }
+    inline std::exception_ptr error() const noexcept(true)
+    {return failed() ? m_state->error : nullptr;}
 
     /**
-     * @brief a function to add a bulk task to the employer
+     * @brief access the result of the task
      * 
-     * @tparam COUNT the amount of tasks stored in the bulk tas
-     * @param task a reference to the bulk task to add
+     * Tasks without a return value store a `uint8_t`, `when_all` and `when_done` do the same. `when_any` stores the 
+     * index of the first input that completed as a `size_t`. 
+     * 
+     * @warning the result is only valid once the task is done and did not fail
+     * 
+     * @return `Future&` a reference to the result
      */
-    template <size_t COUNT>
-    void add_bulk(StaticBulkTask<COUNT>& task)
-    {add_bulk(task.table(), COUNT);}
+    inline Future& result() const noexcept(true)
+    {return m_state->task.result();}
 
     /**
-     * @brief a function to add a bulk task to the employer
+     * @brief access the completion of the task
      * 
-     * @param task a reference to the bulk task to add
+     * @warning the handle must not be empty
+     * 
+     * @return `Completion&` a reference to the completion of the task
      */
-    void add_bulk(BulkTask& task) 
-    {add_bulk(task.table(), task.count());}
+    inline Completion& completion() const noexcept(true)
+    {return m_state->completion;}
 
     /**
-     * @brief a function to check if the employer is idle
+     * @brief wait for the task to complete
      * 
-     * @return `true` if no work is queued, `false` otherwise
+     * The thread waits like `Employer_t::wait`, workers of the employer run queued tasks in the meantime. 
+     * 
+     * @note this blocks the calling thread. Prefer continuations on worker threads. 
      */
-    inline bool idle() const noexcept(true)
-    {return m_todo.load(std::memory_order_relaxed) == 0;}
+    inline void await() const {
+        if (m_state && m_state->waitFor) {m_state->waitFor(m_state->employer, *m_state);}
+        else {while (!done()) {Task::yield();}}
+    }
 
     /**
-     * @brief start the scheduler system
+     * @brief wait for the task and get its result
      * 
-     * automatically done on creation unless requested not to
+     * @throws the exception the task failed with
+     * 
+     * @tparam T the type of the result
+     * @return `T&` a reference to the result
+     */
+    template <typename T>
+    requires (alignof(T) <= alignof(std::max_align_t))
+    T& get() const {
+        await();
+        if (failed()) {std::rethrow_exception(m_state->error);}
+        return result().get<T>();
+    }
+
+protected:
+
+    /**
+     * @brief the employer creates and schedules the tasks
+     */
+    template <size_t FIBER_COUNT>
+    requires (FIBER_COUNT > 0)
+    friend class Employer_t;
+    /**
+     * @brief coroutines report their result through the state
+     */
+    friend struct util::PromiseBase;
+
+    /**
+     * @brief the shared state of a task and its continuations
+     */
+    struct State : public std::enable_shared_from_this<State> {
+        /**
+         * @brief Construct a new State without own work, used to join other tasks
+         */
+        State()
+         : runner([](State* state) {state->__run();}, this), node(&runner)
+        {__setup();}
+
+        /**
+         * @brief Construct a new State
+         * 
+         * @tparam Func the function that the task should execute
+         * @tparam Args the arguments to parse to the functions
+         * @param fn the function that the task should execute
+         * @param args the arguments to parse to the functions
+         */
+        template <typename Func, typename... Args>
+        State(Func&& fn, Args&&... args)
+         : task(std::forward<Func>(fn), std::forward<Args>(args)...), runner([](State* state) {state->__run();}, this), 
+           node(&runner), work(true)
+        {__setup();}
+
+        /**
+         * @brief the work of the task, empty for joins
+         */
+        Task task;
+        /**
+         * @brief the task that is queued, it runs the work and captures exceptions
+         */
+        Task runner;
+        /**
+         * @brief the node to queue the runner with
+         */
+        Job::TaskNode node;
+        /**
+         * @brief completes once the task ran or failed
+         */
+        Completion completion;
+        /**
+         * @brief the amount of inputs that did not complete yet
+         */
+        std::atomic_size_t unmet{0};
+        /**
+         * @brief `true` if the task has work to queue, `false` if it only joins its inputs
+         */
+        bool work = false;
+        /**
+         * @brief `true` if the first completed input releases the task
+         */
+        bool any = false;
+        /**
+         * @brief set once the task or one of its inputs failed
+         */
+        std::atomic_bool failed{false};
+        /**
+         * @brief the exception the task failed with
+         */
+        std::exception_ptr error;
+        /**
+         * @brief the employer to queue the work on
+         */
+        void* employer = nullptr;
+        /**
+         * @brief the function to queue the work with
+         */
+        void (*enqueue)(void*, Job::TaskNode*) = nullptr;
+        /**
+         * @brief the function to wait on the employer until the task completed
+         */
+        void (*waitFor)(void*, const State&) = nullptr;
+        /**
+         * @brief the function to wake the threads that are parked on the employer
+         */
+        void (*notify)(void*) = nullptr;
+        /**
+         * @brief keeps the state alive while it is queued
+         */
+        std::shared_ptr<State> self;
+
+        /**
+         * @brief connect the node to the state
+         */
+        void __setup() noexcept(true) {
+            node.onDone = [](void* data) {static_cast<State*>(data)->__finish();};
+            node.userData = this;
+        }
+
+        /**
+         * @brief run the work and store the exception it may throw
+         */
+        void __run() {
+            try {task.invoke();}
+            catch (...) {__fail(std::current_exception());}
+        }
+
+        /**
+         * @brief store an exception, only the first one is kept
+         * 
+         * @param e the exception to store
+         */
+        void __fail(std::exception_ptr e) noexcept(true) {
+            if (!failed.exchange(true, std::memory_order_acq_rel)) 
+            {error = e;}
+        }
+
+        /**
+         * @brief mark the task as done and release its continuations
+         */
+        void __finish() {
+            //the continuations may drop the last handle, so keep the state alive until they are released
+            std::shared_ptr<State> keep = std::move(self);
+            completion.complete();
+            //threads that await the task may be parked on the employer
+            if (notify) {notify(employer);}
+        }
+
+        /**
+         * @brief queue the work or finish right away if there is none
+         */
+        void __release() {
+            if (work && !failed.load(std::memory_order_acquire)) {
+                self = shared_from_this();
+                enqueue(employer, &node);
+                return;
+            }
+            if (!failed.load(std::memory_order_acquire) && !task.result().valid())
+            {task.result() = uint8_t(1);}
+            __finish();
+        }
+
+        /**
+         * @brief called once an input completed
+         * 
+         * @param source the input that completed or `nullptr` if the input was not a shared task
+         * @param index the index of the input
+         */
+        void __inputDone(State* source, size_t index) {
+            if (any) {
+                //only the first input counts
+                size_t expected = 1;
+                if (!unmet.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {return;}
+                if (source && source->failed.load(std::memory_order_acquire)) {__fail(source->error);}
+                else {task.result() = size_t(index);}
+                __release();
+                return;
+            }
+            if (source && source->failed.load(std::memory_order_acquire)) {__fail(source->error);}
+            if (unmet.fetch_sub(1, std::memory_order_acq_rel) == 1) {__release();}
+        }
+    };
+
+    /**
+     * @brief an edge from an input to a continuation
+     */
+    struct Link : public Completion::Waiter {
+        /**
+         * @brief the continuation
+         */
+        std::shared_ptr<State> target;
+        /**
+         * @brief the input or `nullptr` if the input was not a shared task
+         */
+        State* source = nullptr;
+        /**
+         * @brief the index of the input
+         */
+        size_t index = 0;
+    };
+
+    /**
+     * @brief Construct a new Shared Task
+     * 
+     * @param state the state to refer to
+     */
+    SharedTask(std::shared_ptr<State> state)
+     : m_state(std::move(state))
+    {}
+
+    /**
+     * @brief make a continuation wait for an input
+     * 
+     * @param completion the completion of the input
+     * @param source the input or `nullptr` if the input is not a shared task
+     * @param target the continuation
+     * @param index the index of the input
+     */
+    static void __link(Completion& completion, State* source, const std::shared_ptr<State>& target, size_t index) {
+        Link* link = new Link();
+        link->fire = [](Completion::Waiter* waiter) {
+            Link* link = static_cast<Link*>(waiter);
+            link->target->__inputDone(link->source, link->index);
+            delete link;
+        };
+        link->target = target;
+        link->source = source;
+        link->index = index;
+        //the input is allready done, so release right here
+        if (!completion.push(link)) {link->fire(link);}
+    }
+
+    /**
+     * @brief the shared state of the task
+     */
+    std::shared_ptr<State> m_state;
+
+};
+
+namespace util {
+
+/**
+ * @brief the part of the promise of a coroutine that does not depend on its result type
+ * 
+ * A coroutine is always resumed by a task on its employer. The task and its node live in the promise and are reused for 
+ * every resume, so a suspended coroutine only costs its frame. When the coroutine suspends, it only notes what it waits 
+ * for. The waiter is added once the worker is done with the node, so the node is never queued twice. 
+ * 
+ * @ingroup Utilities
+ */
+struct PromiseBase {
+    /**
+     * @brief Construct a new Promise Base
+     */
+    PromiseBase()
+     : runner([](PromiseBase* promise) {promise->handle.resume();}, this), node(&runner)
+    {
+        node.onDone = [](void* data) {static_cast<PromiseBase*>(data)->__suspended();};
+        node.userData = this;
+        waiter.fire = [](Completion::Waiter* waiter) {
+            PromiseBase* promise = static_cast<ResumeWaiter*>(waiter)->promise;
+            promise->enqueue(promise->employer, &promise->node);
+        };
+        waiter.promise = this;
+    }
+
+    //the task and the waiter point to the promise
+    PromiseBase(const PromiseBase&) = delete;
+    PromiseBase(PromiseBase&&) = delete;
+    PromiseBase& operator=(const PromiseBase&) = delete;
+    PromiseBase& operator=(PromiseBase&&) = delete;
+
+    /**
+     * @brief a waiter that queues the coroutine again
+     */
+    struct ResumeWaiter : public Completion::Waiter {
+        /**
+         * @brief the promise of the coroutine to resume
+         */
+        PromiseBase* promise = nullptr;
+    };
+
+    /**
+     * @brief the handle of the coroutine
+     */
+    std::coroutine_handle<> handle;
+    /**
+     * @brief the task that resumes the coroutine
+     */
+    Task runner;
+    /**
+     * @brief the node to queue the runner with
+     */
+    Job::TaskNode node;
+    /**
+     * @brief the waiter to add to the completion the coroutine waits for
+     */
+    ResumeWaiter waiter;
+    /**
+     * @brief the completion the coroutine waits for or `nullptr` if it should be queued again right away
+     */
+    Completion* waitOn = nullptr;
+    /**
+     * @brief the employer the coroutine runs on
+     */
+    void* employer = nullptr;
+    /**
+     * @brief the function to queue the runner with
+     */
+    void (*enqueue)(void*, Job::TaskNode*) = nullptr;
+    /**
+     * @brief the function to connect a shared task to the employer, nested coroutines are started with it
+     */
+    void (*bind)(void*, SharedTask::State&) = nullptr;
+    /**
+     * @brief the state that holds the result and completes once the coroutine finished
+     */
+    std::shared_ptr<SharedTask::State> state;
+
+    /**
+     * @brief start the coroutine on an employer
+     * 
+     * @param _employer the employer to run on
+     * @param _bind the function to connect the state to the employer
+     * @return `SharedTask` a handle that completes once the coroutine finished
+     */
+    SharedTask __start(void* _employer, void (*_bind)(void*, SharedTask::State&)) {
+        bind = _bind;
+        state = std::make_shared<SharedTask::State>();
+        bind(_employer, *state);
+        employer = state->employer;
+        enqueue = state->enqueue;
+        SharedTask task(state);
+        enqueue(employer, &node);
+        return task;
+    }
+
+    /**
+     * @brief note that the coroutine waits for a completion, called while it suspends
+     * 
+     * @param completion the completion to wait for
+     */
+    inline void __suspendOn(Completion& completion) noexcept(true)
+    {waitOn = &completion;}
+
+    /**
+     * @brief store the result of the coroutine
+     * 
+     * @tparam T the type of the result
+     * @param value the result
+     */
+    template <typename T>
+    void __return(T&& value)
+    {state->task.result() = std::forward<T>(value);}
+
+    /**
+     * @brief store the exception the coroutine failed with
+     * 
+     * @param e the exception
+     */
+    inline void __fail(std::exception_ptr e) noexcept(true)
+    {state->__fail(e);}
+
+    /**
+     * @brief called once the worker is done with the node
+     */
+    void __suspended() {
+        if (handle.done()) {
+            //this destroys the promise, so only locals are used afterwards
+            std::shared_ptr<SharedTask::State> keep = std::move(state);
+            handle.destroy();
+            keep->__finish();
+            return;
+        }
+        Completion* completion = waitOn;
+        waitOn = nullptr;
+        //the waiter may fire right away on another thread, the promise must not be touched after adding it
+        if (!completion || !completion->push(&waiter)) {enqueue(employer, &node);}
+    }
+};
+
+/**
+ * @brief the part of the promise of a coroutine that stores its result
+ * 
+ * @tparam T the type of the result
+ * 
+ * @ingroup Utilities
+ */
+template <typename T>
+struct PromiseResult : public PromiseBase {
+    /**
+     * @brief store the result of the coroutine
+     * 
+     * @tparam U the type of the value
+     * @param value the result
+     */
+    template <typename U>
+    requires std::is_convertible_v<U&&, T>
+    void return_value(U&& value)
+    {__return(T(std::forward<U>(value)));}
+};
+
+/**
+ * @brief the part of the promise of a coroutine without a result
+ * 
+ * @ingroup Utilities
+ */
+template <>
+struct PromiseResult<void> : public PromiseBase {
+    /**
+     * @brief mark the coroutine as done, like tasks without a return value
+     */
+    inline void return_void()
+    {__return(uint8_t(1));}
+};
+
+}
+
+/**
+ * @brief an awaitable that suspends a coroutine until a completion happened
+ * 
+ * @ingroup Tasks
+ */
+class CompletionAwaiter {
+public:
+
+    /**
+     * @brief Construct a new Completion Awaiter
+     * 
+     * @param completion the completion to wait for, it must stay alive until it completed
+     * @param keepAlive an optional owner of the completion that is kept alive while waiting
+     */
+    CompletionAwaiter(Completion& completion, std::shared_ptr<void> keepAlive = nullptr)
+     : m_completion(&completion), m_keepAlive(std::move(keepAlive))
+    {}
+
+    /**
+     * @brief check if the coroutine can continue without suspending
+     * 
+     * @return `true` if the completion allready happened, `false` otherwise
+     */
+    inline bool await_ready() const noexcept(true)
+    {return m_completion->completed();}
+
+    /**
+     * @brief suspend the coroutine until the completion happened
+     * 
+     * @tparam P the promise type of the coroutine, only coroutines of this library can wait
+     * @param handle the handle of the waiting coroutine
+     */
+    template <typename P>
+    requires std::is_base_of_v<util::PromiseBase, P>
+    inline void await_suspend(std::coroutine_handle<P> handle) const noexcept(true)
+    {handle.promise().__suspendOn(*m_completion);}
+
+    /**
+     * @brief called when the coroutine continues
+     */
+    inline void await_resume() const noexcept(true) {}
+
+protected:
+
+    /**
+     * @brief the completion to wait for
+     */
+    Completion* m_completion = nullptr;
+    /**
+     * @brief an optional owner of the completion
+     */
+    std::shared_ptr<void> m_keepAlive;
+
+};
+
+/**
+ * @brief an awaitable that suspends a coroutine until a shared task completed
+ * 
+ * @ingroup Tasks
+ */
+class SharedTaskAwaiter : public CompletionAwaiter {
+public:
+
+    /**
+     * @brief Construct a new Shared Task Awaiter
+     * 
+     * @param task the task to wait for, it must not be empty
+     */
+    SharedTaskAwaiter(const SharedTask& task)
+     : CompletionAwaiter(task.completion()), m_task(task)
+    {}
+
+    /**
+     * @brief called when the coroutine continues
+     * 
+     * @throws the exception the task failed with
+     * 
+     * @return `Future` a copy of the result of the task, the awaiter does not outlive the `co_await` expression
+     */
+    Future await_resume() const {
+        if (m_task.failed()) {std::rethrow_exception(m_task.error());}
+        return m_task.result();
+    }
+
+protected:
+
+    /**
+     * @brief the task to wait for, keeps its result alive
+     */
+    SharedTask m_task;
+
+};
+
+/**
+ * @brief wait for a shared task in a coroutine
+ * 
+ * @param task the task to wait for
+ * @return `SharedTaskAwaiter` the awaitable, it returns a copy of the result of the task
+ */
+inline SharedTaskAwaiter operator co_await(const SharedTask& task)
+{return SharedTaskAwaiter(task);}
+
+/**
+ * @brief wait for all tasks of a job in a coroutine
+ * 
+ * @param job the job to wait for, it must stay alive until it finished
+ * @return `CompletionAwaiter` the awaitable
+ */
+inline CompletionAwaiter operator co_await(Job& job)
+{return CompletionAwaiter(job.completion());}
+
+/**
+ * @brief a stackless task that can suspend while it waits for other work
+ * 
+ * A function becomes a coroutine by returning this type and using `co_await` or `co_return`. It does not start until it 
+ * is passed to `Employer_t::spawn` or awaited by another coroutine. While suspended, it holds no thread and no stack, 
+ * only its frame. It can wait for shared tasks, jobs, other coroutines and every `CompletionAwaiter`. 
+ * 
+ * ```
+ * Coroutine<int> script(Employer& employer) {
+ *     Future loaded = co_await employer.async(loadFile);
+ *     co_return loaded.get<int>() + co_await otherScript();
+ * }
+ * SharedTask done = employer.spawn(script(employer));
+ * ```
+ * 
+ * @note This class can be moved, but not copied. 
+ * 
+ * @tparam T the type of the result or void
+ * 
+ * @ingroup Tasks
+ */
+template <typename T = void>
+requires std::is_void_v<T> || (alignof(T) <= alignof(std::max_align_t))
+class Coroutine {
+public:
+
+    /**
+     * @brief the promise type of the coroutine
+     */
+    struct promise_type : public util::PromiseResult<T> {
+        /**
+         * @brief create the coroutine object that is returned to the caller
+         * 
+         * @return `Coroutine` the owner of the new coroutine
+         */
+        Coroutine get_return_object() noexcept(true) {
+            auto typed = std::coroutine_handle<promise_type>::from_promise(*this);
+            this->handle = typed;
+            return Coroutine(typed);
+        }
+
+        /**
+         * @brief coroutines only start once they are spawned
+         * 
+         * @return `std::suspend_always` always suspend
+         */
+        inline std::suspend_always initial_suspend() const noexcept(true)
+        {return {};}
+
+        /**
+         * @brief the frame is destroyed by the employer once the worker is done with it
+         * 
+         * @return `std::suspend_always` always suspend
+         */
+        inline std::suspend_always final_suspend() const noexcept(true)
+        {return {};}
+
+        /**
+         * @brief store an exception that left the coroutine
+         */
+        inline void unhandled_exception() noexcept(true)
+        {this->__fail(std::current_exception());}
+    };
+
+    /**
+     * @brief Construct a new, empty Coroutine
+     */
+    Coroutine() = default;
+
+    /**
+     * @brief Construct a new Coroutine
+     * 
+     * @param other the coroutine to take over
+     */
+    Coroutine(Coroutine&& other) noexcept(true)
+     : m_handle(std::exchange(other.m_handle, nullptr))
+    {}
+
+    /**
+     * @brief take over another coroutine
+     * 
+     * @param other the coroutine to take over
+     * @return `Coroutine&` a reference to this coroutine
+     */
+    Coroutine& operator=(Coroutine&& other) noexcept(true) {
+        if (this != &other) {
+            if (m_handle) {m_handle.destroy();}
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    //only one owner may exist
+    Coroutine(const Coroutine&) = delete;
+    Coroutine& operator=(const Coroutine&) = delete;
+
+    /**
+     * @brief Destroy the Coroutine, a coroutine that was never started is destroyed with it
+     */
+    ~Coroutine()
+    {if (m_handle) {m_handle.destroy();}}
+
+    /**
+     * @brief check if the object owns a coroutine that was not started yet
+     * 
+     * @return `true` if it owns a coroutine, `false` otherwise
+     */
+    inline bool valid() const noexcept(true)
+    {return static_cast<bool>(m_handle);}
+
+    /**
+     * @brief the awaitable to run a coroutine from another coroutine
+     */
+    class Awaiter {
+    public:
+
+        /**
+         * @brief Construct a new Awaiter
+         * 
+         * @param handle the coroutine to run
+         */
+        Awaiter(std::coroutine_handle<promise_type> handle)
+         : m_handle(handle)
+        {}
+
+        /**
+         * @brief the coroutine allways has to run first
+         * 
+         * @return `false`
+         */
+        inline bool await_ready() const noexcept(true)
+        {return false;}
+
+        /**
+         * @brief start the coroutine on the employer of the waiting coroutine and wait for it
+         * 
+         * @tparam P the promise type of the waiting coroutine
+         * @param handle the handle of the waiting coroutine
+         */
+        template <typename P>
+        requires std::is_base_of_v<util::PromiseBase, P>
+        void await_suspend(std::coroutine_handle<P> handle) {
+            util::PromiseBase& parent = handle.promise();
+            m_task = m_handle.promise().__start(parent.employer, parent.bind);
+            parent.__suspendOn(m_task.completion());
+        }
+
+        /**
+         * @brief get the result of the coroutine
+         * 
+         * @throws the exception the coroutine failed with
+         * 
+         * @return `T` the result
+         */
+        T await_resume() {
+            if (m_task.failed()) {std::rethrow_exception(m_task.error());}
+            if constexpr (!std::is_void_v<T>) 
+            {return std::move(m_task.result().template get<T>());}
+        }
+
+    protected:
+
+        /**
+         * @brief the coroutine to run
+         */
+        std::coroutine_handle<promise_type> m_handle;
+        /**
+         * @brief the handle that completes once the coroutine finished
+         */
+        SharedTask m_task;
+
+    };
+
+    /**
+     * @brief run the coroutine from another coroutine and wait for its result
+     * 
+     * @throws `Tiny::Jobs::Exception` If the coroutine is empty
+     * 
+     * @return `Awaiter` the awaitable
+     */
+    Awaiter operator co_await() && {
+        if (!m_handle) {throw Exception("Can not await an empty coroutine");}
+        return Awaiter(std::exchange(m_handle, nullptr));
+    }
+
+protected:
+
+    /**
+     * @brief the employer starts coroutines
+     */
+    template <size_t FIBER_COUNT>
+    requires (FIBER_COUNT > 0)
+    friend class Employer_t;
+
+    /**
+     * @brief Construct a new Coroutine
+     * 
+     * @param handle the handle of the coroutine to own
+     */
+    Coroutine(std::coroutine_handle<promise_type> handle)
+     : m_handle(handle)
+    {}
+
+    /**
+     * @brief the coroutine while it was not started yet
+     */
+    std::coroutine_handle<promise_type> m_handle;
+
+};
+
+/**
+ * @brief a structure responsible for scheduling and running jobs in a multi-threaded way
+ * 
+ * @note This class can be neither copied nor moved. 
+ * 
+ * @tparam FIBER_COUNT the amount of fibers the employer offers per thread. It must be at least 1. To disabler fibers, use the define or option in the compiler. 
+ * 
+ * @ingroup Scheduler
+ */
+template <size_t FIBER_COUNT = 8>
+requires (FIBER_COUNT > 0)
+class Employer_t {
+public:
+
+    /**
+     * @brief Construct a new Employer
+     * 
+     * @param threads the amount of threads to creat (0 = auto)
+     * @param autostart `true` to start on creation, `false` otherwise
+     * @param pinStart the offset of cores to pin to
+     * @param policy how the workers and waiting threads wait
+     */
+    Employer_t(uint32_t threads = 0, bool autostart = true, uint32_t pinStart = 0, const WaitPolicy& policy = WaitPolicy()) {
+        setWaitPolicy(policy);
+        //if threads is 0, set to 1 (minimum)
+        threads = (threads == 0) ? (std::thread::hardware_concurrency()-1) : threads;
+        if (threads == 0) 
+        {threads = 1;}
+
+        //store the worker count
+        m_workerCount = threads;
+
+        //prepare the workers, every worker picks its victims in a different order
+        m_worker = new Worker[m_workerCount]();
+        for (uint32_t i = 0; i < m_workerCount; ++i)
+        {m_worker[i].seed = (i + 1) * 0x9E3779B9u;}
+
+        //if starting requested, start
+        if (autostart)
+        {start(pinStart);}
+    }
+
+    /**
+     * @brief Destroy the Employer
+     */
+    ~Employer_t() {
+        shutdown();
+
+        //clean up
+        delete[] m_worker;
+        m_worker = nullptr;
+    }
+
+    //cannot be moved nor copied
+    Employer_t(const Employer_t&) = delete;
+    Employer_t(Employer_t&&) = delete;
+    Employer_t& operator=(const Employer_t&) = delete;
+    Employer_t& operator=(Employer_t&&) = delete;
+
+    /**
+     * @brief add a job to the system
+     * 
+     * @param job a pointer to the job to queue
+     */
+    void add(Job* job) {
+        //can't add on shutdown
+        if (m_locked.load(std::memory_order_acquire))
+        {return;}
+        //pull initial nodes
+        while (Job::TaskNode* node = job->next()) {
+            //queue the nodes and register the work
+            m_todo.fetch_add(1, std::memory_order_acq_rel);
+            m_queuedWork.fetch_add(1, std::memory_order_acq_rel);
+            uint32_t idx = m_roundRobinNext.fetch_add(1, std::memory_order_relaxed) % m_workerCount;
+            //switch implementation between lockfree / non-lockfree
+            #ifndef TINY_JOBS_NO_LOCKFREE
+            m_worker[idx].tasks.enqueue(node);
+            #else
+            //first, lock
+            std::unique_lock lock(m_worker[idx].queueMtx);
+            //then push to the queue
+            m_worker[idx].tasks.push(node);
+            #endif
+            //wake up the thread if it was sleeping
+            if (m_worker[idx].sleeping.load(std::memory_order_acquire))
+            {m_worker[idx].cv.notify_one();}
+        }
+    }
+
+    /**
+     * @brief a function to add a single task node
+     * 
+     * This is used to add a single task
+     * 
+     * @param node a pointer to the node
+     */
+    void add(Job::TaskNode* node) {
+        //can't add on shutdown
+        if (m_locked.load(std::memory_order_acquire))
+        {return;}
+        //queue the nodes and register the work
+        m_todo.fetch_add(1, std::memory_order_acq_rel);
+        m_queuedWork.fetch_add(1, std::memory_order_acq_rel);
+        uint32_t idx = m_roundRobinNext.fetch_add(1, std::memory_order_relaxed) % m_workerCount;
+        //switch implementation between lockfree / non-lockfree
+        #ifndef TINY_JOBS_NO_LOCKFREE
+        m_worker[idx].tasks.enqueue(node);
+        #else
+        //first, lock
+        std::unique_lock lock(m_worker[idx].queueMtx);
+        //then push to the queue
+        m_worker[idx].tasks.push(node);
+        #endif
+        //wake up the thread if it was sleeping
+        if (m_worker[idx].sleeping.load(std::memory_order_acquire))
+        {m_worker[idx].cv.notify_one();}
+    }
+
+    /**
+     * @brief add a lot of new nodes
+     * 
+     * Nodes that where counted by an earlier `add_bulk` or `run_bulk` stop counting. 
+     * 
+     * @param nodes the nodes to add
+     * @param count the amount of nodes
+     */
+    void add_bulk(Job::TaskNode** nodes, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {nodes[i]->pending = nullptr;}
+        __addBulk(nodes, count);
+    }
+
+    /**
+     * @brief a function to add a bulk task to the employer
+     * 
+     * @tparam COUNT the amount of tasks stored in the bulk tas
+     * @param task a reference to the bulk task to add
+     */
+    template <size_t COUNT>
+    void add_bulk(StaticBulkTask<COUNT>& task)
+    {add_bulk(task.table(), COUNT);}
+
+    /**
+     * @brief a function to add a bulk task to the employer
+     * 
+     * @param task a reference to the bulk task to add
+     */
+    void add_bulk(BulkTask& task) 
+    {add_bulk(task.table(), task.count());}
+
+    /**
+     * @brief add a lot of new nodes and count down a counter once each of them is done
+     * 
+     * The counter is decremented after the worker last touches a node, so the nodes may be freed as soon as it reaches 
+     * 0. Threads parked in `wait` are woken when it does. 
+     * 
+     * @param nodes a pointer to the nodes to add
+     * @param count the amount of nodes
+     * @param pending the counter to decrement, must be incremented by `count` by the caller
+     */
+    void add_bulk(Job::TaskNode** nodes, uint64_t count, std::atomic_size_t& pending) {
+        for (uint64_t i = 0; i < count; ++i) {nodes[i]->pending = &pending;}
+        __addBulk(nodes, count);
+    }
+
+    /**
+     * @brief a function to add a bulk task to the employer and count down a counter once each of its tasks is done
+     * 
+     * @param task a reference to the bulk task to add
+     * @param pending the counter to decrement, must be incremented by the amount of tasks by the caller
+     */
+    void add_bulk(BulkTask& task, std::atomic_size_t& pending) 
+    {add_bulk(task.table(), task.count(), pending);}
+
+    /**
+     * @brief run a function for all indices of a range in parallel
+     * 
+     * The range is split lazily: a thread only splits off the upper half of its remaining range if other workers may 
+     * be hungry for work, otherwise it keeps working through its range in chunks of `grain` indices. The calling thread 
+     * works on the range too and runs other queued tasks while it waits for the rest. Because of that, parallel loops 
+     * may be nested and may be started from inside of tasks. 
+     * 
+     * If the function throws, the remaining chunks are skipped and the first exception is re-thrown once all running 
+     * chunks are done. 
+     * 
+     * @tparam Func the type of the function, called as `fn(start, end)` for a chunk or as `fn(i)` for every index
+     * @param begin the first index of the range
+     * @param end the index behind the last index of the range
+     * @param grain the minimum amount of indices to run in one go or 0 to choose automatically
+     * @param fn the function to run
+     */
+    template <typename Func>
+    void parallel_for(size_t begin, size_t end, size_t grain, Func&& fn) {
+        if (begin >= end) {return;}
+        //accept both chunk and index functions
+        auto body = [&fn](size_t start, size_t stop) {
+            if constexpr (std::is_invocable_v<Func&, size_t, size_t>)
+            {fn(start, stop);}
+            else
+            {for (size_t i = start; i < stop; ++i) {fn(i);}}
+        };
+
+        RangeState<decltype(body)> state;
+        state.body = &body;
+        state.grain = (grain > 0) ? grain : std::max<size_t>(1, (end - begin) / (size_t(m_workerCount + 1) * 8));
+        runRange(state, begin, end);
+        //help out until all split off chunks are done
+        wait([&] {return state.pending.load(std::memory_order_acquire) == 0;});
+        if (state.error) {std::rethrow_exception(state.error);}
+    }
+
+    /**
+     * @brief run a function for all indices of a range in parallel, the chunk size is chosen automatically
+     * 
+     * @tparam Func the type of the function, called as `fn(start, end)` for a chunk or as `fn(i)` for every index
+     * @param begin the first index of the range
+     * @param end the index behind the last index of the range
+     * @param fn the function to run
+     */
+    template <typename Func>
+    inline void parallel_for(size_t begin, size_t end, Func&& fn)
+    {parallel_for(begin, end, 0, std::forward<Func>(fn));}
+
+    /**
+     * @brief combine values computed for all indices of a range in parallel
+     * 
+     * Uses the same splitting as `parallel_for`. The order partial results are combined in is not defined, so `reduce` 
+     * must be associative and commutative. 
+     * 
+     * @tparam T the type of the result
+     * @tparam Func the type of the function, called as `fn(start, end)` returning the result of a chunk or as `fn(i)` 
+     *              returning the value of a single index
+     * @tparam Reduce the type of the function that combines two results, called as `reduce(a, b)`
+     * @param begin the first index of the range
+     * @param end the index behind the last index of the range
+     * @param grain the minimum amount of indices to run in one go or 0 to choose automatically
+     * @param identity the result of an empty range, used as the starting value of every chunk
+     * @param fn the function that computes the values
+     * @param reduce the function that combines two results
+     * @return `T` the combination of the values of all indices
+     */
+    template <typename T, typename Func, typename Reduce>
+    T parallel_reduce(size_t begin, size_t end, size_t grain, T identity, Func&& fn, Reduce&& reduce) {
+        T result = identity;
+        std::mutex mtx;
+        parallel_for(begin, end, grain, [&](size_t start, size_t stop) {
+            T part = identity;
+            if constexpr (std::is_invocable_v<Func&, size_t, size_t>)
+            {part = fn(start, stop);}
+            else
+            {for (size_t i = start; i < stop; ++i) {part = reduce(std::move(part), fn(i));}}
+            //chunks are large, so the lock is rarely contended
+            std::lock_guard lock(mtx);
+            result = reduce(std::move(result), std::move(part));
+        });
+        return result;
+    }
+
+    /**
+     * @brief queue a function as a shared task that other tasks can continue from
+     * 
+     * @tparam Func the function that the task should execute
+     * @tparam Args the arguments to parse to the functions
+     * @param fn the function that the task should execute
+     * @param args the arguments to parse to the functions
+     * @return `SharedTask` a handle to the queued task
+     */
+    template <typename Func, typename... Args>
+    SharedTask async(Func&& fn, Args&&... args) {
+        auto state = std::make_shared<SharedTask::State>(std::forward<Func>(fn), std::forward<Args>(args)...);
+        __bind(this, *state);
+        state->__release();
+        return SharedTask(std::move(state));
+    }
+
+    /**
+     * @brief queue a function once a shared task completed
+     * 
+     * The function is not run if the input failed, the continuation fails with the same exception instead. 
+     * 
+     * @throws `Tiny::Jobs::Exception` If the input is empty
+     * 
+     * @tparam Func the type of the function, called as `fn(input.result())` or as `fn()`
+     * @param input the task to continue from
+     * @param fn the function to run
+     * @return `SharedTask` a handle to the continuation
+     */
+    template <typename Func>
+    SharedTask then(const SharedTask& input, Func&& fn) {
+        if (!input.valid()) {throw Exception("Can not continue from an empty shared task");}
+        std::shared_ptr<SharedTask::State> state;
+        if constexpr (std::is_invocable_v<std::decay_t<Func>&, Future&>) {
+            //the continuation keeps its input alive to read the result
+            state = std::make_shared<SharedTask::State>([fn = std::decay_t<Func>(std::forward<Func>(fn)), in = input.m_state]() mutable
+                {return fn(in->task.result());});
+        } else 
+        {state = std::make_shared<SharedTask::State>(std::forward<Func>(fn));}
+        __bind(this, *state);
+        state->unmet.store(1, std::memory_order_relaxed);
+        SharedTask::__link(input.m_state->completion, input.m_state.get(), state, 0);
+        return SharedTask(std::move(state));
+    }
+
+    /**
+     * @brief create a task that completes once all inputs completed
+     * 
+     * Fails with the first exception of a failed input. Continue from it with `then` to run something afterwards. 
+     * 
+     * @throws `Tiny::Jobs::Exception` If one of the inputs is empty
+     * 
+     * @param inputs the tasks to wait for
+     * @return `SharedTask` a handle to the joined task
+     */
+    SharedTask when_all(const std::vector<SharedTask>& inputs) {
+        for (const SharedTask& input : inputs) {
+            if (!input.valid()) {throw Exception("Can not join an empty shared task");}
+        }
+        auto state = std::make_shared<SharedTask::State>();
+        __bind(this, *state);
+        //one extra input keeps the join from completing while the links are added
+        state->unmet.store(inputs.size() + 1, std::memory_order_relaxed);
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {SharedTask::__link(inputs[i].m_state->completion, inputs[i].m_state.get(), state, i);}
+        state->__inputDone(nullptr, 0);
+        return SharedTask(std::move(state));
+    }
+
+    /**
+     * @brief create a task that completes once the first input completed
+     * 
+     * The result is the index of the first completed input as a `size_t`. If that input failed, the task fails too. 
+     * 
+     * @throws `Tiny::Jobs::Exception` If no inputs are passed or one of the inputs is empty
+     * 
+     * @param inputs the tasks to wait for
+     * @return `SharedTask` a handle to the joined task
+     */
+    SharedTask when_any(const std::vector<SharedTask>& inputs) {
+        if (inputs.empty()) {throw Exception("Can not wait for any of no shared tasks");}
+        for (const SharedTask& input : inputs) {
+            if (!input.valid()) {throw Exception("Can not join an empty shared task");}
+        }
+        auto state = std::make_shared<SharedTask::State>();
+        __bind(this, *state);
+        state->any = true;
+        state->unmet.store(1, std::memory_order_relaxed);
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {SharedTask::__link(inputs[i].m_state->completion, inputs[i].m_state.get(), state, i);}
+        return SharedTask(std::move(state));
+    }
+
+    /**
+     * @brief start a coroutine
+     * 
+     * @throws `Tiny::Jobs::Exception` If the coroutine is empty
+     * 
+     * @tparam T the type of the result of the coroutine
+     * @param coroutine the coroutine to start, the employer takes it over
+     * @return `SharedTask` a handle that completes once the coroutine finished, the result is stored like for `async`
+     */
+    template <typename T>
+    SharedTask spawn(Coroutine<T>&& coroutine) {
+        if (!coroutine.m_handle) {throw Exception("Can not spawn an empty coroutine");}
+        auto handle = std::exchange(coroutine.m_handle, nullptr);
+        return handle.promise().__start(this, &Employer_t::__bind);
+    }
+
+    /**
+     * @brief create a task that completes once all tasks of a job ran
+     * 
+     * This connects jobs to continuations: continue from the returned task with `then` or join it with other tasks. To 
+     * start a job after a shared task, queue it from a continuation. 
+     * 
+     * @param job the job to wait for, it must stay alive until it finished
+     * @return `SharedTask` a handle to the joined task
+     */
+    SharedTask when_done(Job& job) {
+        auto state = std::make_shared<SharedTask::State>();
+        __bind(this, *state);
+        state->unmet.store(1, std::memory_order_relaxed);
+        SharedTask::__link(job.completion(), nullptr, state, 0);
+        return SharedTask(std::move(state));
+    }
+
+    /**
+     * @brief run all tasks of a bulk task and wait until they are done
+     * 
+     * The calling thread does not run other tasks while it waits, so it may hold locks that other tasks need. If the 
+     * employer does not accept work, the tasks run on the calling thread. 
+     * 
+     * @param nodes a pointer to the nodes to run
+     * @param count the amount of nodes
+     */
+    void run_bulk(Job::TaskNode** nodes, uint64_t count) {
+        if (m_locked.load(std::memory_order_acquire)) {
+            for (uint64_t i = 0; i < count; ++i) {nodes[i]->task->invoke();}
+            return;
+        }
+        //the workers count down once they are completely done with a node
+        std::atomic_size_t pending{count};
+        add_bulk(nodes, count, pending);
+        wait([&] {return pending.load(std::memory_order_acquire) == 0;}, false);
+        //the counter dies with this call, the nodes may be added again later
+        for (uint64_t i = 0; i < count; ++i) {nodes[i]->pending = nullptr;}
+    }
+
+    /**
+     * @brief run all tasks of a bulk task and wait until they are done
+     * 
+     * @tparam COUNT the amount of tasks stored in the bulk task
+     * @param task a reference to the bulk task to run
+     */
+    template <size_t COUNT>
+    void run_bulk(StaticBulkTask<COUNT>& task)
+    {run_bulk(task.table(), COUNT);}
+
+    /**
+     * @brief run all tasks of a bulk task and wait until they are done
+     * 
+     * @param task a reference to the bulk task to run
+     */
+    void run_bulk(BulkTask& task)
+    {run_bulk(task.table(), task.count());}
+
+    /**
+     * @brief wait until a condition is met, optionally running queued tasks in the meantime
+     * 
+     * If there is nothing to help with, the thread waits as described by the wait policy. Parked threads are woken 
+     * whenever a counted task (see `Job::TaskNode::pending`) finishes or `notify` is called, so the condition must 
+     * only depend on those. 
+     * 
+     * @tparam Pred the type of the condition, called as `done()`
+     * @param done the condition to wait for
+     * @param helping `true` to run queued tasks while waiting, `false` to only wait
+     */
+    template <typename Pred>
+    void wait(Pred&& done, bool helping = true) {
+        uint32_t step = 0;
+        while (!done()) {
+            //doing other work is better than waiting
+            if (helping && help()) {step = 0;}
+            else {backoff(step, done);}
+        }
+    }
+
+    /**
+     * @brief wake up all threads that are parked in `wait` or `waitIdle`
+     * 
+     * Only required if a thread waits for something that is not a counted task. 
+     */
+    void notify() const noexcept(true) {
+        //pairs with the fence in backoff, either the waiter sees the change or this sees the waiter
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_parked.load(std::memory_order_relaxed) > 0) {
+            m_epoch.fetch_add(1, std::memory_order_release);
+            m_epoch.notify_all();
+        }
+    }
+
+    /**
+     * @brief change how the workers and waiting threads wait
+     * 
+     * @param policy the new policy
+     */
+    void setWaitPolicy(const WaitPolicy& policy) noexcept(true) {
+        m_spins.store(policy.spins, std::memory_order_relaxed);
+        m_yields.store(policy.yields, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief get how the workers and waiting threads wait
+     * 
+     * @return `WaitPolicy` the current policy
+     */
+    inline WaitPolicy getWaitPolicy() const noexcept(true)
+    {return WaitPolicy{.spins = m_spins.load(std::memory_order_relaxed), .yields = m_yields.load(std::memory_order_relaxed)};}
+
+    /**
+     * @brief run a single queued task on the calling thread
+     * 
+     * Used to do something useful while waiting for other tasks. Worker threads take their own work first, other threads 
+     * steal from the workers. 
+     * 
+     * @return `true` if a task was run, `false` if no work was found
+     */
+    bool help() {
+        Job::TaskNode* node = nullptr;
+        uint32_t idx = (s_current == this) ? s_currentIdx : m_workerCount;
+        if (idx < m_workerCount) 
+        {node = acquire(idx);}
+        else {
+            uint32_t start = m_roundRobinNext.load(std::memory_order_relaxed);
+            for (uint32_t i = 0; (i < m_workerCount) && !node; ++i)
+            {node = steal((start + i) % m_workerCount);}
+        }
+        if (!node) {return false;}
+        m_queuedWork.fetch_sub(1, std::memory_order_acq_rel);
+        execute(node, idx);
+        return true;
+    }
+
+    /**
+     * @brief a function to check if the employer is idle
+     * 
+     * @return `true` if no work is queued, `false` otherwise
+     */
+    inline bool idle() const noexcept(true)
+    {return m_todo.load(std::memory_order_acquire) == 0;}
+
+    /**
+     * @brief get the amount of worker threads the employer runs
+     * 
+     * @return `uint32_t` the amount of worker threads
+     */
+    inline uint32_t workerCount() const noexcept(true)
+    {return m_workerCount;}
+
+    /**
+     * @brief start the scheduler system
+     * 
+     * automatically done on creation unless requested not to
      * 
      * @param pinStart the offset of cores to pin to
      */
@@ -1802,9 +3173,13 @@ public:
 
     /**
      * @brief wait for the employer to become idle
+     * 
+     * The calling thread does not run any tasks, it waits as described by the wait policy. 
      */
-    inline void waitIdle() const noexcept(true)
-    {while (!idle()) {std::this_thread::sleep_for(std::chrono::nanoseconds(1));}}
+    inline void waitIdle() const noexcept(true) {
+        uint32_t step = 0;
+        while (!idle()) {backoff(step, [this] {return idle();});}
+    }
 
 protected:
 
@@ -1819,6 +3194,10 @@ protected:
      * @param idx the index of the worker in the 
      */
     void workerFn(uint32_t idx) {
+        //parallel loops need to know which worker they run on
+        s_current = this;
+        s_currentIdx = idx;
+
         //set stack size
         boost::context::fixedsize_stack stack(256 * 1024);
         /**
@@ -1837,10 +3216,6 @@ protected:
          * Incremented by the main fiber, decremented by workers
          */
         uint32_t active = 0;
-        /**
-         * @brief store the queue to add to nex time
-         */
-        uint32_t roundRobinIdx = 0;
 
         //the main function for a fiber
         auto fiber_main = [&](size_t fiber_idx){
@@ -1849,34 +3224,7 @@ protected:
                 //check if work is todo
                 if (task[fiber_idx]) {
                     //run the task
-                    task[fiber_idx]->task->invoke();
-                    //notify the job that the task is done
-                    Job* job = task[fiber_idx]->owner;
-                    //if no owner exists (yes, that is legal) just skip this
-                    if (job) {
-                        job->notify_done(task[fiber_idx]);
-
-                        //now there may be new tasks available. Poll them. 
-                        while (Job::TaskNode* node = job->next()) {
-                            m_todo.fetch_add(1, std::memory_order_acq_rel);
-                            m_queuedWork.fetch_add(1, std::memory_order_acq_rel);
-                            uint32_t i = (roundRobinIdx++) % m_workerCount;
-                            //switch implementation between lockfree / non-lockfree
-                            #ifndef TINY_JOBS_NO_LOCKFREE
-                            m_worker[i].tasks.enqueue(node);
-                            #else
-                            //first, lock
-                            std::unique_lock lock(m_worker[idx].queueMtx);
-                            //then push to the queue
-                            m_worker[i].tasks.push(node);
-                            #endif
-                            //wake up the thread if it was sleeping
-                            if (m_worker[i].sleeping.load(std::memory_order_acquire))
-                            {m_worker[i].cv.notify_one();}
-                        }
-                    }
-                    //free the slot
-                    m_todo.fetch_sub(1, std::memory_order_acq_rel);
+                    execute(task[fiber_idx], idx);
                     task[fiber_idx] = nullptr;
 
                     //done
@@ -1892,52 +3240,15 @@ protected:
             pool[i] = std::move(boost::fibers::fiber(fiber_main, i));
         }
 
+        //the amount of idle steps taken since the last task
+        uint32_t idle = 0;
+
         //main function for this fiber (thread is now a fiber too)
         while (m_running.load(std::memory_order_relaxed)) {
             //if all fibers are fill, skip
             if (active != FIBER_COUNT) {
-                //try to poll from the queue
-                Job::TaskNode* node = nullptr;
-                //switch implementation between lockfree / non-lockfree implementation
-                #ifndef TINY_JOBS_NO_LOCKFREE
-                if (!m_worker[idx].tasks.try_dequeue(node)) {
-                    //try to steal from somewhere
-                    for (uint32_t i = 0; i < m_workerCount; ++i) {
-                        //can't steal from self
-                        if (i == idx) {continue;}
-                        //steal work
-                        m_worker[i].tasks.try_dequeue(node);
-                        if (node) {break;}
-                    }
-                }
-                #else
-                //first, try to pull from the own queue
-                {
-                //lock the own mutex
-                std::unique_lock lock(m_worker[idx].queueMtx);
-                //then, try to pull from the queue
-                if (!m_worker[idx].tasks.empty()) {
-                    node = m_worker[idx].tasks.front();
-                    m_worker[idx].tasks.pop();
-                }
-                }
-                //if nothing was pulled, try to steal
-                if (!node) {
-                    //iterate over all other nodes
-                    for (uint32_t i = 0; i < m_workerCount; ++i) {
-                        //can't steal from self
-                        if (i == idx) {continue;}
-                        //first, obtain a lock
-                        std::unique_lock lock(m_worker[i].queueMtx);
-                        //then, try to dequeue
-                        if (!m_worker[i].tasks.empty()) {
-                            node = m_worker[i].tasks.front();
-                            m_worker[i].tasks.pop();
-                        }
-                        if (node) {break;}
-                    }
-                }
-                #endif
+                //try to get work from the own queues or steal it from another worker
+                Job::TaskNode* node = acquire(idx);
                 if (node) {
                     //task was dequeued from somewhere
                     m_queuedWork.fetch_sub(1, std::memory_order_acq_rel);
@@ -1958,20 +3269,26 @@ protected:
                     if (!given)
                     {throw Exception("Failed to schedule a task even thou a free slot was reported");}
                     #endif
+                    idle = 0;
                 }
             }
-            //if active is 0, that means the thread may sleep
+            //if active is 0, that means the thread may sleep after waiting a bit for new work
             if ((active == 0) && (m_queuedWork.load(std::memory_order_acquire) == 0)) {
-                //use the condition variable to sleep
-                std::unique_lock lock(m_worker[idx].mtx);
-                //re-check required
-                if ((active == 0) && (m_queuedWork.load(std::memory_order_acquire) == 0)) {
-                    m_worker[idx].sleeping.store(true, std::memory_order_release);
-                    m_worker[idx].cv.wait(lock, [&]
-                        {return !m_running.load(std::memory_order_relaxed) || (m_queuedWork.load(std::memory_order_acquire) > 0);}
-                    );
-                    //no longer sleeping
-                    m_worker[idx].sleeping.store(false, std::memory_order_release);
+                if (!idleStep(idle)) {
+                    //use the condition variable to sleep
+                    std::unique_lock lock(m_worker[idx].mtx);
+                    //re-check required
+                    if ((active == 0) && (m_queuedWork.load(std::memory_order_acquire) == 0)) {
+                        m_worker[idx].sleeping.store(true, std::memory_order_release);
+                        m_sleeping.fetch_add(1);
+                        m_worker[idx].cv.wait(lock, [&]
+                            {return !m_running.load(std::memory_order_relaxed) || (m_queuedWork.load(std::memory_order_acquire) > 0);}
+                        );
+                        //no longer sleeping
+                        m_sleeping.fetch_sub(1);
+                        m_worker[idx].sleeping.store(false, std::memory_order_release);
+                    }
+                    idle = 0;
                 }
             } else {
                 //finally, yield the fiber
@@ -1988,107 +3305,474 @@ protected:
     //else, use a secondary, fiber-less implementation
 
     void workerFn(uint32_t idx) {
-        /**
-         * @brief store the queue to add to nex time
-         */
-        uint32_t roundRobinIdx = 0;
+        //parallel loops need to know which worker they run on
+        s_current = this;
+        s_currentIdx = idx;
+
+        //the amount of idle steps taken since the last task
+        uint32_t idle = 0;
 
         //main function for this fiber (thread is now a fiber too)
         while (m_running.load(std::memory_order_relaxed)) {
-            //try to poll from the queue
-            Job::TaskNode* node = nullptr;
-            //switch implementation between lockfree / non-lockfree implementation
-            #ifndef TINY_JOBS_NO_LOCKFREE
-            if (!m_worker[idx].tasks.try_dequeue(node)) {
-                //try to steal from somewhere
-                for (uint32_t i = 0; i < m_workerCount; ++i) {
-                    //can't steal from self
-                    if (i == idx) {continue;}
-                    //steal work
-                    m_worker[i].tasks.try_dequeue(node);
-                    if (node) {break;}
-                }
-            }
-            #else
-            //first, try to pull from the own queue
-            {
-            //lock the own mutex
-            std::unique_lock lock(m_worker[idx].queueMtx);
-            //then, try to pull from the queue
-            if (!m_worker[idx].tasks.empty()) {
-                node = m_worker[idx].tasks.front();
-                m_worker[idx].tasks.pop();
-            }
-            }
-            //if nothing was pulled, try to steal
-            if (!node) {
-                //iterate over all other nodes
-                for (uint32_t i = 0; i < m_workerCount; ++i) {
-                    //can't steal from self
-                    if (i == idx) {continue;}
-                    //first, obtain a lock
-                    std::unique_lock lock(m_worker[i].queueMtx);
-                    //then, try to dequeue
-                    if (!m_worker[i].tasks.empty()) {
-                        node = m_worker[i].tasks.front();
-                        m_worker[i].tasks.pop();
-                    }
-                    if (node) {break;}
-                }
-            }
-            #endif
+            //try to get work from the own queues or steal it from another worker
+            Job::TaskNode* node = acquire(idx);
             if (node) {
                 //task was dequeued from somewhere
                 m_queuedWork.fetch_sub(1, std::memory_order_acq_rel);
                 //run the task
-                node->task->invoke();
-                //notify the job that the task is done
-                Job* job = node->owner;
-                //if no owner exists (yes, that is legal) just skip this
-                if (job) {
-                    job->notify_done(node);
-
-                    //now there may be new tasks available. Poll them. 
-                    while (Job::TaskNode* node = job->next()) {
-                        m_todo.fetch_add(1, std::memory_order_acq_rel);
-                        m_queuedWork.fetch_add(1, std::memory_order_acq_rel);
-                        uint32_t i = (roundRobinIdx++) % m_workerCount;
-                        //switch implementation between lockfree / non-lockfree
-                        #ifndef TINY_JOBS_NO_LOCKFREE
-                        m_worker[i].tasks.enqueue(node);
-                        #else
-                        //first, lock
-                        std::unique_lock lock(m_worker[idx].queueMtx);
-                        //then push to the queue
-                        m_worker[i].tasks.push(node);
-                        #endif
-                        //wake up the thread if it was sleeping
-                        if (m_worker[i].sleeping.load(std::memory_order_acquire))
-                        {m_worker[i].cv.notify_one();}
-                    }
-                }
-                //free the slot
-                m_todo.fetch_sub(1, std::memory_order_acq_rel);
+                execute(node, idx);
+                idle = 0;
+                continue;
             }
-            //if active is 0, that means the thread may sleep
-            if (m_queuedWork.load(std::memory_order_acquire) == 0) {
+            //if no work is queued, the thread may sleep after waiting a bit for new work
+            if ((m_queuedWork.load(std::memory_order_acquire) == 0) && !idleStep(idle)) {
                 //use the condition variable to sleep
                 std::unique_lock lock(m_worker[idx].mtx);
                 //re-check required
                 if (m_queuedWork.load(std::memory_order_acquire) == 0) {
                     m_worker[idx].sleeping.store(true, std::memory_order_release);
+                    m_sleeping.fetch_add(1);
                     m_worker[idx].cv.wait(lock, [&]
                         {return !m_running.load(std::memory_order_relaxed) || (m_queuedWork.load(std::memory_order_acquire) > 0);}
                     );
                     //no longer sleeping
+                    m_sleeping.fetch_sub(1);
                     m_worker[idx].sleeping.store(false, std::memory_order_release);
                 }
+                idle = 0;
             }
         }
     }
 
     #endif
 
+    /**
+     * @brief run a task and release the tasks that depended on it
+     * 
+     * @param node the task to run, it must allready be removed from the queues
+     * @param idx the index of the worker that runs the task or the worker count for other threads
+     */
+    void execute(Job::TaskNode* node, uint32_t idx) {
+        //the node may be freed as soon as its counter is decremented, so read everything up front
+        Job* job = node->owner;
+        std::atomic_size_t* pending = node->pending;
+        void (*onDone)(void*) = node->onDone;
+        void* userData = node->userData;
+        node->task->invoke();
+        //if no owner exists (yes, that is legal) just skip this
+        if (job) {
+            job->notify_done(node);
+            //now there may be new tasks available. Keep them local, idle workers will steal them. 
+            while (Job::TaskNode* next = job->next()) {
+                if (idx < m_workerCount) {pushLocal(idx, next);}
+                else {add(next);}
+            }
+        }
+        //this may free the node
+        if (onDone) {onDone(userData);}
+        //free the slot and wake up threads that wait for the employer or the node
+        bool wake = (m_todo.fetch_sub(1, std::memory_order_acq_rel) == 1);
+        if (pending) {wake |= (pending->fetch_sub(1, std::memory_order_acq_rel) == 1);}
+        if (wake) {notify();}
+    }
+
+    /**
+     * @brief a single step of waiting as described by the wait policy
+     * 
+     * @tparam Pred the type of the condition, called as `done()`
+     * @param step the amount of steps taken so far, advanced by the function
+     * @param done the condition that ends the wait
+     */
+    template <typename Pred>
+    void backoff(uint32_t& step, Pred&& done) const {
+        uint32_t spins = m_spins.load(std::memory_order_relaxed);
+        uint32_t yields = m_yields.load(std::memory_order_relaxed);
+        if (step < spins) {
+            ++step;
+            util::spin_pause();
+            return;
+        }
+        //parking would block all fibers of the worker, including the ones that may be waited for
+        #ifndef TINY_JOBS_NO_FIBERS
+        bool mayPark = (s_current == nullptr);
+        #else
+        bool mayPark = true;
+        #endif
+        if ((step < spins + yields) || !mayPark) {
+            ++step;
+            Task::yield();
+            return;
+        }
+        //park until something finishes
+        uint32_t epoch = m_epoch.load(std::memory_order_acquire);
+        m_parked.fetch_add(1, std::memory_order_acq_rel);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!done()) {m_epoch.wait(epoch, std::memory_order_acquire);}
+        m_parked.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /**
+     * @brief a single step of an idle worker before it goes to sleep
+     * 
+     * @param step the amount of steps taken so far, advanced by the function
+     * @return `true` if the worker waited and should look for work again, `false` if it should go to sleep
+     */
+    bool idleStep(uint32_t& step) const noexcept(true) {
+        uint32_t spins = m_spins.load(std::memory_order_relaxed);
+        uint32_t yields = m_yields.load(std::memory_order_relaxed);
+        if (step < spins) {util::spin_pause();}
+        else if (step < spins + yields) {std::this_thread::yield();}
+        else {return false;}
+        ++step;
+        return true;
+    }
+
+    /**
+     * @brief a chunk of a range that was split off for another worker
+     */
+    struct RangeSplit {
+        /**
+         * @brief Construct a new Range Split
+         * 
+         * @tparam Args the types of the arguments for the task
+         * @param args the arguments for the task
+         */
+        template <typename... Args>
+        RangeSplit(Args&&... args)
+         : task(std::forward<Args>(args)...), node(&task)
+        {}
+
+        /**
+         * @brief the task that runs the chunk
+         */
+        Task task;
+        /**
+         * @brief the node to queue the task with
+         */
+        Job::TaskNode node;
+    };
+
+    /**
+     * @brief the shared state of a single parallel loop
+     * 
+     * @tparam Body the type of the function that runs a chunk
+     */
+    template <typename Body>
+    struct RangeState {
+        /**
+         * @brief the function that runs a chunk
+         */
+        Body* body = nullptr;
+        /**
+         * @brief the minimum amount of indices to run in one go
+         */
+        size_t grain = 1;
+        /**
+         * @brief the amount of split off chunks that are not done yet
+         */
+        std::atomic_size_t pending{0};
+        /**
+         * @brief set once a chunk threw, the remaining chunks are skipped
+         */
+        std::atomic_bool failed{false};
+        /**
+         * @brief the first exception thrown by a chunk
+         */
+        std::exception_ptr error;
+        /**
+         * @brief protects the exception and the split off chunks
+         */
+        std::mutex mtx;
+        /**
+         * @brief the storage of all split off chunks, a deque keeps them in place
+         */
+        std::deque<RangeSplit> splits;
+    };
+
+    /**
+     * @brief work through a range, splitting off the upper half whenever other workers could use the work
+     * 
+     * @tparam Body the type of the function that runs a chunk
+     * @param state the state of the loop
+     * @param begin the first index of the range
+     * @param end the index behind the last index of the range
+     */
+    template <typename Body>
+    void runRange(RangeState<Body>& state, size_t begin, size_t end) {
+        try {
+            while ((begin < end) && !state.failed.load(std::memory_order_relaxed)) {
+                while (((end - begin) > state.grain) && shouldSplit()) {
+                    size_t mid = begin + (end - begin) / 2;
+                    spawnRange(state, mid, end);
+                    end = mid;
+                }
+                size_t stop = begin + std::min(state.grain, end - begin);
+                (*state.body)(begin, stop);
+                begin = stop;
+            }
+        } catch (...) {
+            std::unique_lock lock(state.mtx);
+            if (!state.error) {state.error = std::current_exception();}
+            state.failed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief queue a part of a range as its own task
+     * 
+     * @tparam Body the type of the function that runs a chunk
+     * @param state the state of the loop
+     * @param begin the first index of the part
+     * @param end the index behind the last index of the part
+     */
+    template <typename Body>
+    void spawnRange(RangeState<Body>& state, size_t begin, size_t end) {
+        RangeSplit* split = nullptr;
+        {
+        std::unique_lock lock(state.mtx);
+        //the arguments are stored by value, so no references to locals end up in the task
+        split = &state.splits.emplace_back([](Employer_t* self, RangeState<Body>* state, size_t begin, size_t end)
+            {self->runRange(*state, begin, end);}, 
+            this, &state, size_t(begin), size_t(end));
+        }
+        split->node.pending = &state.pending;
+        state.pending.fetch_add(1, std::memory_order_acq_rel);
+        //workers keep the split for themselves until someone steals it
+        if (s_current == this) {pushLocal(s_currentIdx, &split->node);}
+        else {add(&split->node);}
+    }
+
+    /**
+     * @brief check if a running parallel loop should split its range
+     * 
+     * Workers split if all of their own work was stolen or if a worker sleeps. Other threads split while there are less 
+     * queued tasks than workers. 
+     * 
+     * @return `true` if the range should be split, `false` if the work should continue on the calling thread
+     */
+    bool shouldSplit() const noexcept {
+        //nobody would pick up the split
+        if (m_locked.load(std::memory_order_relaxed)) {return false;}
+        if (s_current == this) {
+            return (m_worker[s_currentIdx].localSize.load(std::memory_order_relaxed) == 0) || 
+                   (m_sleeping.load(std::memory_order_relaxed) > 0);
+        }
+        return m_queuedWork.load(std::memory_order_relaxed) < m_workerCount;
+    }
+
+    /**
+     * @brief add a lot of new nodes without changing their counters
+     * 
+     * @param nodes the nodes to add
+     * @param count the amount of nodes
+     */
+    void __addBulk(Job::TaskNode** nodes, uint64_t count) {
+        //can't add on shutdown
+        if (m_locked.load(std::memory_order_acquire))
+        {return;}
+        //register the work
+        m_todo.fetch_add(count, std::memory_order_acq_rel);
+        m_queuedWork.fetch_add(count, std::memory_order_acq_rel);
+        //divide the load equally
+        uint64_t step = (count + (m_workerCount-1)) / m_workerCount;
+        uint64_t pos = 0;
+        //add all elements
+        for (size_t i = 0; i < m_workerCount; ++i) {
+            //compute how much work to add
+            uint64_t delta = step;
+            if ((pos + delta) > count)
+            {delta = count-pos;}
+            //if delta is 0, just stop
+            if (delta == 0) {break;}
+            //switch implementation between lockfree / non-lockfree
+            #ifndef TINY_JOBS_NO_LOCKFREE
+            m_worker[i].tasks.enqueue_bulk(nodes + pos, delta);
+            #else
+            //first, lock
+            std::unique_lock lock(m_worker[i].queueMtx);
+            //then push to the queue
+            for (size_t j = 0; j < delta; ++j)
+            {m_worker[i].tasks.push(nodes[pos + j]);}
+            #endif
+            //wake up the thread if it was sleeping
+            if (m_worker[i].sleeping.load(std::memory_order_acquire))
+            {m_worker[i].cv.notify_one();}
+            //step forward
+            pos += delta;
+        }
+    }
+
+    /**
+     * @brief connect a shared task to an employer
+     * 
+     * @param employer a pointer to the employer to connect to
+     * @param state the state of the shared task
+     */
+    static void __bind(void* employer, SharedTask::State& state) noexcept(true) {
+        state.employer = employer;
+        state.enqueue = &Employer_t::__enqueue;
+        state.waitFor = &Employer_t::__waitFor;
+        state.notify = [](void* employer) {static_cast<Employer_t*>(employer)->notify();};
+    }
+
+    /**
+     * @brief wait until a shared task completed
+     * 
+     * Workers of the employer help, so awaiting a task on a worker can not use up all workers. Other threads only wait, 
+     * they may hold locks the queued tasks need. 
+     * 
+     * @param employer a pointer to the employer the task runs on
+     * @param state the state of the task
+     */
+    static void __waitFor(void* employer, const SharedTask::State& state) {
+        Employer_t* self = static_cast<Employer_t*>(employer);
+        self->wait([&state] {return state.completion.completed();}, s_current == self);
+    }
+
+    /**
+     * @brief queue the work of a shared task
+     * 
+     * Continuations released by a worker stay on that worker, they likely use the data the input just produced. If the 
+     * employer does not accept work, the task runs on the calling thread. 
+     * 
+     * @param employer a pointer to the employer to queue on
+     * @param node the node of the task
+     */
+    static void __enqueue(void* employer, Job::TaskNode* node) {
+        Employer_t* self = static_cast<Employer_t*>(employer);
+        if (self->m_locked.load(std::memory_order_acquire)) {
+            node->task->invoke();
+            node->onDone(node->userData);
+            return;
+        }
+        if (s_current == self) {self->pushLocal(s_currentIdx, node);}
+        else {self->add(node);}
+    }
+
+    /**
+     * @brief queue a task that was spawned by a worker on the worker itself
+     * 
+     * Freshly spawned tasks likely use the data their parent just touched, so the worker runs them itself. Idle workers 
+     * steal them if the worker has more work than it can handle. 
+     * 
+     * @param idx the index of the spawning worker
+     * @param node the task to queue
+     */
+    void pushLocal(uint32_t idx, Job::TaskNode* node) {
+        //register the work
+        m_todo.fetch_add(1, std::memory_order_acq_rel);
+        m_queuedWork.fetch_add(1);
+        {
+        std::unique_lock lock(m_worker[idx].localMtx);
+        m_worker[idx].local.push_back(node);
+        m_worker[idx].localSize.store(m_worker[idx].local.size(), std::memory_order_release);
+        }
+        //a sleeping worker can steal the task
+        wakeSleeper(idx);
+    }
+
+    /**
+     * @brief get the next task for a worker
+     * 
+     * The worker first takes the newest task it spawned itself, then the oldest task that was added to it from the 
+     * outside. If both are empty, it steals from other workers, starting at a random one so that idle workers don't all 
+     * fight over the same victim. 
+     * 
+     * @param idx the index of the worker
+     * @return `Job::TaskNode*` the task to run or `nullptr` if no work was found
+     */
+    Job::TaskNode* acquire(uint32_t idx) {
+        Worker& self = m_worker[idx];
+        //newest own task first, its data is most likely still in the cache
+        if (self.localSize.load(std::memory_order_acquire) > 0) {
+            std::unique_lock lock(self.localMtx);
+            if (!self.local.empty()) {
+                Job::TaskNode* node = self.local.back();
+                self.local.pop_back();
+                self.localSize.store(self.local.size(), std::memory_order_release);
+                return node;
+            }
+        }
+        //then the tasks added from the outside
+        Job::TaskNode* node = nullptr;
+        #ifndef TINY_JOBS_NO_LOCKFREE
+        if (self.tasks.try_dequeue(node)) {return node;}
+        #else
+        {
+        std::unique_lock lock(self.queueMtx);
+        if (!self.tasks.empty()) {
+            node = self.tasks.front();
+            self.tasks.pop();
+            return node;
+        }
+        }
+        #endif
+
+        //finally, steal from a random victim and walk on from there
+        if (m_workerCount < 2) {return nullptr;}
+        self.seed ^= self.seed << 13;
+        self.seed ^= self.seed >> 17;
+        self.seed ^= self.seed << 5;
+        uint32_t start = self.seed % m_workerCount;
+        for (uint32_t i = 0; i < m_workerCount; ++i) {
+            uint32_t victim = (start + i) % m_workerCount;
+            if (victim == idx) {continue;}
+            if ((node = steal(victim))) {return node;}
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief steal a task from another worker
+     * 
+     * Stolen tasks are taken from the opposite end the owner works on. These are the oldest tasks, which are the least 
+     * likely to be in the cache of the owner and tend to spawn the most work. 
+     * 
+     * @param victim the index of the worker to steal from
+     * @return `Job::TaskNode*` the stolen task or `nullptr` if the worker had no work
+     */
+    Job::TaskNode* steal(uint32_t victim) {
+        Worker& other = m_worker[victim];
+        if (other.localSize.load(std::memory_order_acquire) > 0) {
+            std::unique_lock lock(other.localMtx);
+            if (!other.local.empty()) {
+                Job::TaskNode* node = other.local.front();
+                other.local.pop_front();
+                other.localSize.store(other.local.size(), std::memory_order_release);
+                return node;
+            }
+        }
+        Job::TaskNode* node = nullptr;
+        #ifndef TINY_JOBS_NO_LOCKFREE
+        other.tasks.try_dequeue(node);
+        #else
+        std::unique_lock lock(other.queueMtx);
+        if (!other.tasks.empty()) {
+            node = other.tasks.front();
+            other.tasks.pop();
+        }
+        #endif
+        return node;
+    }
+
+    /**
+     * @brief wake up a single sleeping worker, if there is one
+     * 
+     * @param idx the index of the worker that searches, the search starts at the worker behind it
+     */
+    void wakeSleeper(uint32_t idx) {
+        if (m_sleeping.load() == 0) {return;}
+        for (uint32_t i = 1; i < m_workerCount; ++i) {
+            Worker& other = m_worker[(idx + i) % m_workerCount];
+            if (other.sleeping.load(std::memory_order_acquire)) {
+                //taking the lock makes sure the worker is either waiting or will see the new work
+                {std::unique_lock lock(other.mtx);}
+                other.cv.notify_one();
+                return;
+            }
+        }
+    }
+
     /**
      * @brief a function to pin an std::thread to a specific core
      * 
@@ -2127,8 +3811,10 @@ protected:
     
     /**
      * @brief store the per-worker data
+     * 
+     * Each worker gets its own cache lines so that stealing from one worker does not slow down its neighbours. 
      */
-    struct Worker {
+    struct alignas(64) Worker {
         /**
          * @brief store the thread of the worker
          */
@@ -2153,6 +3839,27 @@ protected:
         std::mutex queueMtx;
         #endif
 
+        /**
+         * @brief the tasks spawned by the worker itself
+         * 
+         * The owner works on the back, thieves take from the front. 
+         */
+        std::deque<Job::TaskNode*> local;
+        /**
+         * @brief a mutex for the local tasks
+         */
+        std::mutex localMtx;
+        /**
+         * @brief the amount of local tasks, so that empty workers can be skipped without locking them
+         */
+        std::atomic_size_t localSize{0};
+        /**
+         * @brief the state of the random number generator used to pick the victims to steal from
+         * 
+         * Only touched by the worker itself. 
+         */
+        uint32_t seed = 0;
+
         /**
          * @brief store a mutex
          * 
@@ -2200,6 +3907,34 @@ protected:
      * @brief store how many tasks are queued
      */
     std::atomic_size_t m_queuedWork{0};
+    /**
+     * @brief store how many workers are sleeping
+     */
+    std::atomic_uint32_t m_sleeping{0};
+    /**
+     * @brief the amount of checks with a CPU pause hint before yielding
+     */
+    std::atomic_uint32_t m_spins{0};
+    /**
+     * @brief the amount of checks that yield the time slice before parking
+     */
+    std::atomic_uint32_t m_yields{0};
+    /**
+     * @brief incremented to wake up parked threads
+     */
+    mutable std::atomic_uint32_t m_epoch{0};
+    /**
+     * @brief the amount of parked threads, nobody has to be woken up if this is 0
+     */
+    mutable std::atomic_uint32_t m_parked{0};
+    /**
+     * @brief the employer the calling thread works for, if any
+     */
+    inline static thread_local const Employer_t* s_current = nullptr;
+    /**
+     * @brief the index of the worker the calling thread is
+     */
+    inline static thread_local uint32_t s_currentIdx = 0;
 
 };
 
@@ -126,6 +126,14 @@ namespace Asset {
 
     protected:
 
+        /**
+         * @brief decode an image file using stb
+         * 
+         * @param file the file to decode
+         * @param format the format of the file (decides between float and RGBA8 decoding)
+         */
+        void importSTB(const std::filesystem::path& file, u32 format) noexcept(false);
+
         /**
          * @brief store the image
          */
@@ -20,6 +20,14 @@
 //add CPU samplers
 #include "SamplerCPU.h"
 
+//the employer is only used by reference, the job system is included by the source file
+namespace GLGE::Tiny::Jobs {
+    template <size_t FIBER_COUNT>
+    requires (FIBER_COUNT > 0)
+    class Employer_t;
+    typedef Employer_t<8> Employer;
+}
+
 //use the library namespace
 namespace GLGE::Graphic {
 
@@ -86,6 +94,17 @@ namespace GLGE::Graphic {
          */
         ImageCPU toFormat(const PixelFormat& format);
 
+        /**
+         * @brief Create an image that contains the same data as this one but with a different format
+         * 
+         * The pixels are converted in parallel on the employer. 
+         * 
+         * @param format the format of the new image
+         * @param employer the employer to convert the pixels on
+         * @return `ImageCPU` the reformatted image
+         */
+        ImageCPU toFormat(const PixelFormat& format, Tiny::Jobs::Employer& employer);
+
         /**
          * @brief read a texel from the image
          * 
@@ -0,0 +1,294 @@
+/**
+ * @file AssetManager.cpp
+ * @author DM8AT
+ * @brief implement the dependency graph of the asset manager
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+//add the asset manager
+#include "Core/AssetManager.h"
+
+//for the critical path search
+#include <unordered_set>
+#include <algorithm>
+//for error messages
+#include <sstream>
+
+/**
+ * @brief a frame of the per-thread stack of assets that are currently loaded through the dependency graph
+ */
+struct DependencyFrame {
+    /**
+     * @brief the node that is loaded
+     */
+    void* node;
+    /**
+     * @brief the time the load spent waiting for dependencies
+     */
+    std::chrono::nanoseconds waited;
+    /**
+     * @brief `true` once the path of the node was handed out by `claimDependencyPath`
+     */
+    bool claimed;
+};
+
+/**
+ * @brief the stack of assets the current thread is loading through the dependency graph
+ */
+static thread_local std::vector<DependencyFrame> ts_dependencyStack;
+
+/**
+ * @brief what a thread that loads assets through the dependency graph waits for
+ */
+struct DependencyWaiter {
+    /**
+     * @brief the node the thread waits for, `nullptr` while it is not waiting (guarded by the dependency mutex)
+     */
+    void* waitingFor = nullptr;
+};
+
+/**
+ * @brief the wait state of the current thread, nodes point to it while the thread loads them
+ */
+static thread_local DependencyWaiter ts_dependencyWaiter;
+
+GLGE::AssetManager::~AssetManager() {
+    //queued task nodes live in the dependency nodes and run functions of the manager
+    auto finished = [this]() {return m_queuedDependencies.load() == 0;};
+    if (m_employer) {m_employer->wait(finished);}
+    else {while (!finished()) {Tiny::Jobs::Task::yield();}}
+}
+
+std::filesystem::path GLGE::AssetManager::claimDependencyPath() {
+    //only the first asset loaded in the frame of a node of this manager is the asset of the node
+    if (ts_dependencyStack.empty() || ts_dependencyStack.back().claimed) {return {};}
+    DependencyNode* node = static_cast<DependencyNode*>(ts_dependencyStack.back().node);
+    if (node->manager != this) {return {};}
+    ts_dependencyStack.back().claimed = true;
+    return node->path;
+}
+
+void GLGE::AssetManager::__addDependencyEdge(DependencyNode* dependency) {
+    //only loads through the dependency graph have a parent
+    if (ts_dependencyStack.empty()) {return;}
+    DependencyNode* parent = static_cast<DependencyNode*>(ts_dependencyStack.back().node);
+    //store the edge once
+    std::unique_lock lock(m_dependencyMtx);
+    if (std::find(parent->dependencies.begin(), parent->dependencies.end(), dependency) == parent->dependencies.end())
+    {parent->dependencies.push_back(dependency);}
+}
+
+void GLGE::AssetManager::__scheduleDependency(DependencyNode* node) {
+    //only idle nodes can be queued
+    u8 expected = DEPENDENCY_IDLE;
+    if (!node->state.compare_exchange_strong(expected, DEPENDENCY_QUEUED)) {return;}
+
+    //without an employer the node stays queued until a thread requires it
+    if (!m_employer) {return;}
+
+    //the load runs as a stand-alone task (no owning job), the task is only created once
+    if (!node->task) {
+        node->task = std::make_unique<Tiny::Jobs::Task>([this, node]() {__runDependency(node);});
+        node->taskNode.task = node->task.get();
+        node->taskNode.owner = nullptr;
+        node->taskNode.userData = node;
+        node->taskNode.onDone = [](void* data) {
+            DependencyNode* node = static_cast<DependencyNode*>(data);
+            AssetManager* manager = node->manager;
+            Tiny::Jobs::Employer* employer = manager->m_employer;
+            node->queued.store(false);
+            //the node may have been queued again while the old task node was still in a queue
+            if (node->state.load() == DEPENDENCY_QUEUED) {manager->__queueDependency(node);}
+            //the manager may be destroyed as soon as the count drops to zero, so this is the last access to it
+            if ((manager->m_queuedDependencies.fetch_sub(1) == 1) && employer) {employer->notify();}
+        };
+    }
+    __queueDependency(node);
+}
+
+void GLGE::AssetManager::__queueDependency(DependencyNode* node) {
+    //pairs with the sequentially consistent state check in the finish hook of the task node, so either the old 
+    //task node sees the new state or this sees that the old task node is gone
+    if (node->queued.exchange(true) || !m_employer) {return;}
+    m_queuedDependencies.fetch_add(1);
+    m_employer->add(&node->taskNode);
+}
+
+void GLGE::AssetManager::__runDependency(DependencyNode* node) {
+    //claim the node, if another thread already did this is a no-op
+    u8 expected = DEPENDENCY_QUEUED;
+    if (!node->state.compare_exchange_strong(expected, DEPENDENCY_LOADING, std::memory_order_acq_rel)) {return;}
+
+    GLGE_PROFILER_SCOPE();
+    {
+        std::unique_lock lock(m_dependencyMtx);
+        node->loader = &ts_dependencyWaiter;
+    }
+    //make the node the parent of all dependencies declared while loading
+    ts_dependencyStack.push_back(DependencyFrame{node, std::chrono::nanoseconds(0), false});
+    auto start = std::chrono::steady_clock::now();
+    u8 result = DEPENDENCY_DONE;
+    try {
+        (*node->loadFn)(this, *node);
+    } catch (const std::exception& e) {
+        node->error = e.what();
+        result = DEPENDENCY_FAILED;
+    } catch (...) {
+        node->error = "Unknown error while loading asset";
+        result = DEPENDENCY_FAILED;
+    }
+    //only the own work counts, waiting for dependencies is accounted to the dependencies
+    auto total = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    node->loadTime = total - ts_dependencyStack.back().waited;
+    ts_dependencyStack.pop_back();
+
+    //publish the result and wake the threads that wait for it
+    {
+        std::unique_lock lock(m_dependencyMtx);
+        node->loader = nullptr;
+    }
+    node->state.store(result);
+    if (m_employer) {m_employer->notify();}
+}
+
+void GLGE::AssetManager::__resolveDependency(DependencyNode* node) {
+    GLGE_PROFILER_SCOPE();
+    auto start = std::chrono::steady_clock::now();
+    while (true) {
+        u8 state = node->state.load(std::memory_order_acquire);
+        if (state == DEPENDENCY_DONE) {break;}
+        if (state == DEPENDENCY_FAILED) {
+            std::stringstream stream;
+            stream << "Failed to load dependency " << node->path << ": " << node->error;
+            throw Exception(stream.str(), "GLGE::AssetManager::__resolveDependency");
+        }
+        if (state == DEPENDENCY_IDLE) {
+            //not queued yet, queue it and run it right here
+            __scheduleDependency(node);
+            continue;
+        }
+        if (state == DEPENDENCY_QUEUED) {
+            //nobody started the load, so do it on this thread instead of waiting
+            __runDependency(node);
+            continue;
+        }
+
+        //the node is loading further down this thread or on another thread
+        __awaitDependency(node);
+    }
+
+    //account the time to the parent
+    if (!ts_dependencyStack.empty())
+    {ts_dependencyStack.back().waited += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);}
+}
+
+void GLGE::AssetManager::__awaitDependency(DependencyNode* node) {
+    {
+        std::unique_lock lock(m_dependencyMtx);
+        __checkDependencyCycle(node);
+    }
+
+    //the queued dependencies of the node are needed anyway. Running other work here could run a load that requires an 
+    //asset further down this thread, which would never finish. 
+    for (DependencyNode* dep : __collectClosure(node)) {
+        if (dep->state.load(std::memory_order_acquire) == DEPENDENCY_QUEUED) {__runDependency(dep);}
+    }
+
+    //the dependencies of the node may have waited for this thread, so check again before parking
+    {
+        std::unique_lock lock(m_dependencyMtx);
+        if (node->state.load(std::memory_order_acquire) != DEPENDENCY_LOADING) {return;}
+        __checkDependencyCycle(node);
+        ts_dependencyWaiter.waitingFor = node;
+    }
+    auto finished = [node]() {return node->state.load() != DEPENDENCY_LOADING;};
+    if (m_employer) {m_employer->wait(finished, false);}
+    else {while (!finished()) {Tiny::Jobs::Task::yield();}}
+    std::unique_lock lock(m_dependencyMtx);
+    ts_dependencyWaiter.waitingFor = nullptr;
+}
+
+void GLGE::AssetManager::__checkDependencyCycle(DependencyNode* node) {
+    //follow the loads that wait for each other, every node is visited at most once on the way
+    DependencyNode* current = node;
+    for (size_t steps = 0; current && (steps <= m_dependencyNodes.size()); ++steps) {
+        const DependencyWaiter* loader = static_cast<const DependencyWaiter*>(current->loader);
+        //a node without loader finishes on its own, a loader that does not wait makes progress
+        if (!loader) {return;}
+        if (loader == &ts_dependencyWaiter) {
+            std::stringstream stream;
+            stream << "Detected a cyclic asset dependency on " << node->path;
+            throw Exception(stream.str(), "GLGE::AssetManager::__checkDependencyCycle");
+        }
+        current = static_cast<DependencyNode*>(loader->waitingFor);
+    }
+}
+
+std::vector<GLGE::AssetManager::DependencyNode*> GLGE::AssetManager::__collectClosure(DependencyNode* root) {
+    std::vector<DependencyNode*> closure = {root};
+    std::unordered_set<DependencyNode*> visited = {root};
+    std::unique_lock lock(m_dependencyMtx);
+    //breadth first walk over the graph
+    for (size_t i = 0; i < closure.size(); ++i) {
+        for (DependencyNode* dep : closure[i]->dependencies) {
+            if (visited.insert(dep).second)
+            {closure.push_back(dep);}
+        }
+    }
+    return closure;
+}
+
+GLGE::AssetManager::DependencyReport GLGE::AssetManager::__buildDependencyReport(DependencyNode* root) {
+    GLGE_PROFILER_SCOPE();
+    std::vector<DependencyNode*> closure = __collectClosure(root);
+
+    DependencyReport report;
+    report.assetCount = closure.size();
+    report.wallTime = root->wallTime;
+
+    //the longest path starting at each node and the dependency it continues with
+    std::unordered_map<DependencyNode*, std::pair<std::chrono::nanoseconds, DependencyNode*>> longest;
+    std::unordered_set<DependencyNode*> active;
+    std::unique_lock lock(m_dependencyMtx);
+    for (DependencyNode* node : closure)
+    {report.serialTime += node->loadTime;}
+    //memoized depth first search, edges back into the active path (cycles) are ignored
+    auto visit = [&](auto& self, DependencyNode* node) -> std::chrono::nanoseconds {
+        auto it = longest.find(node);
+        if (it != longest.end()) {return it->second.first;}
+        active.insert(node);
+        std::pair<std::chrono::nanoseconds, DependencyNode*> best{std::chrono::nanoseconds(0), nullptr};
+        for (DependencyNode* dep : node->dependencies) {
+            if (active.contains(dep)) {continue;}
+            std::chrono::nanoseconds length = self(self, dep);
+            if (!best.second || length > best.first)
+            {best = {length, dep};}
+        }
+        active.erase(node);
+        longest[node] = {node->loadTime + best.first, best.second};
+        return node->loadTime + best.first;
+    };
+    report.criticalPathTime = visit(visit, root);
+
+    //walk the chain from the root
+    std::unordered_set<DependencyNode*> onPath;
+    for (DependencyNode* node = root; node && onPath.insert(node).second; node = longest[node].second)
+    {report.criticalPath.push_back(node->path);}
+    return report;
+}
+
+void GLGE::AssetManager::releasePrefetchedAssets() {
+    GLGE_PROFILER_SCOPE();
+    std::unique_lock lock(m_dependencyMtx);
+    for (DependencyNode& node : m_dependencyNodes) {
+        //loading nodes are left alone, releasing while loading is not supported
+        u8 state = node.state.load(std::memory_order_acquire);
+        if (state != DEPENDENCY_DONE && state != DEPENDENCY_FAILED) {continue;}
+        node.handle = UntypedAssetHandle();
+        node.error.clear();
+        node.state.store(DEPENDENCY_IDLE, std::memory_order_release);
+    }
+}
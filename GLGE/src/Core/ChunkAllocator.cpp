@@ -0,0 +1,215 @@
+/**
+ * @file ChunkAllocator.cpp
+ * @author DM8AT
+ * @brief implement the chunk arena
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//add chunk allocators
+#include "Core/ChunkAllocator.h"
+//add exceptions
+#include "Core/Exception.h"
+#include <algorithm>
+
+//add virtual memory management
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+//the alignment of every allocation, one cache line
+#define ARENA_ALIGNMENT 64
+//the size of a huge page, blocks are aligned to this so they can be backed by huge pages
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+GLGE::ChunkArena::ChunkArena()
+ : ChunkArena(Settings())
+{}
+
+GLGE::ChunkArena::ChunkArena(const Settings& settings)
+ : m_settings(settings)
+{
+    //blocks are always made of whole huge pages
+    m_settings.blockSize = std::max<size_t>(HUGE_PAGE_SIZE, (m_settings.blockSize + HUGE_PAGE_SIZE - 1) & ~size_t(HUGE_PAGE_SIZE - 1));
+}
+
+GLGE::ChunkArena::~ChunkArena() {
+    for (Block& block : m_blocks) {__unmapBlock(block);}
+}
+
+void* GLGE::ChunkArena::allocate(size_t size) {
+    if (size == 0) {size = 1;}
+    size = (size + ARENA_ALIGNMENT - 1) & ~size_t(ARENA_ALIGNMENT - 1);
+    std::lock_guard lock(m_mtx);
+
+    //large buffers get a block of their own, so they don't fragment the shared blocks
+    if (size > m_settings.blockSize) {
+        Block& block = m_blocks.emplace_back(__mapBlock(size));
+        block.dedicated = true;
+        m_used += size;
+        return __take(block, size);
+    }
+
+    //first fit over all shared blocks
+    for (Block& block : m_blocks) {
+        if (block.dedicated) {continue;}
+        if (void* ptr = __take(block, size)) {
+            m_used += size;
+            return ptr;
+        }
+    }
+
+    Block& block = m_blocks.emplace_back(__mapBlock(m_settings.blockSize));
+    m_used += size;
+    return __take(block, size);
+}
+
+void GLGE::ChunkArena::deallocate(void* ptr, size_t size) noexcept {
+    if (!ptr) {return;}
+    if (size == 0) {size = 1;}
+    size = (size + ARENA_ALIGNMENT - 1) & ~size_t(ARENA_ALIGNMENT - 1);
+    std::lock_guard lock(m_mtx);
+
+    u8* bytes = static_cast<u8*>(ptr);
+    auto it = std::find_if(m_blocks.begin(), m_blocks.end(), [bytes](const Block& block) {
+        return (bytes >= block.data) && (bytes < block.data + block.size);
+    });
+    if (it == m_blocks.end()) {return;}
+    m_used -= size;
+
+    //dedicated blocks only hold a single allocation
+    if (it->dedicated) {
+        __unmapBlock(*it);
+        m_blocks.erase(it);
+        return;
+    }
+
+    //insert the range and merge it with its neighbours
+    size_t offset = static_cast<size_t>(bytes - it->data);
+    auto next = it->free.lower_bound(offset);
+    if ((next != it->free.end()) && (offset + size == next->first)) {
+        size += next->second;
+        next = it->free.erase(next);
+    }
+    if (next != it->free.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            prev->second += size;
+            return;
+        }
+    }
+    it->free.emplace_hint(next, offset, size);
+}
+
+size_t GLGE::ChunkArena::getReservedBytes() const noexcept {
+    std::lock_guard lock(m_mtx);
+    size_t bytes = 0;
+    for (const Block& block : m_blocks) {bytes += block.size;}
+    return bytes;
+}
+
+size_t GLGE::ChunkArena::getUsedBytes() const noexcept {
+    std::lock_guard lock(m_mtx);
+    return m_used;
+}
+
+size_t GLGE::ChunkArena::getBlockCount() const noexcept {
+    std::lock_guard lock(m_mtx);
+    return m_blocks.size();
+}
+
+GLGE::ChunkArena::Block GLGE::ChunkArena::__mapBlock(size_t size) {
+    Block block;
+    block.size = (size + HUGE_PAGE_SIZE - 1) & ~size_t(HUGE_PAGE_SIZE - 1);
+
+    #if defined(_WIN32)
+    //large pages need a privilege most users don't have, so they are only a best effort
+    DWORD flags = MEM_RESERVE | MEM_COMMIT;
+    SIZE_T largePage = GetLargePageMinimum();
+    bool large = m_settings.hugePages && (largePage > 0) && ((block.size % largePage) == 0);
+    USHORT node = 0;
+    PROCESSOR_NUMBER proc;
+    GetCurrentProcessorNumberEx(&proc);
+    bool numa = m_settings.numaLocal && GetNumaProcessorNodeEx(&proc, &node);
+    void* ptr = nullptr;
+    if (large) {
+        ptr = numa ? VirtualAllocExNuma(GetCurrentProcess(), nullptr, block.size, flags | MEM_LARGE_PAGES, PAGE_READWRITE, node)
+                   : VirtualAlloc(nullptr, block.size, flags | MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+    if (!ptr) {
+        ptr = numa ? VirtualAllocExNuma(GetCurrentProcess(), nullptr, block.size, flags, PAGE_READWRITE, node)
+                   : VirtualAlloc(nullptr, block.size, flags, PAGE_READWRITE);
+    }
+    if (!ptr)
+    {throw Exception("Failed to reserve a block of " + std::to_string(block.size) + " bytes", "GLGE::ChunkArena::__mapBlock");}
+    block.data = static_cast<u8*>(ptr);
+    #else
+    //over-allocate so the block can be aligned to a huge page, the rest is given back right away
+    size_t mapped = block.size + HUGE_PAGE_SIZE;
+    void* ptr = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+    {throw Exception("Failed to reserve a block of " + std::to_string(block.size) + " bytes", "GLGE::ChunkArena::__mapBlock");}
+    uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+    uintptr_t aligned = (start + HUGE_PAGE_SIZE - 1) & ~uintptr_t(HUGE_PAGE_SIZE - 1);
+    if (aligned > start) {munmap(ptr, aligned - start);}
+    if (aligned + block.size < start + mapped) {munmap(reinterpret_cast<void*>(aligned + block.size), (start + mapped) - (aligned + block.size));}
+    block.data = reinterpret_cast<u8*>(aligned);
+
+    #if defined(MADV_HUGEPAGE)
+    if (m_settings.hugePages) {madvise(block.data, block.size, MADV_HUGEPAGE);}
+    #endif
+    #if defined(__linux__) && defined(SYS_mbind) && defined(SYS_getcpu)
+    if (m_settings.numaLocal) {
+        //prefer the node of the calling thread. This fails harmlessly on systems without NUMA.
+        unsigned int cpu = 0, node = 0;
+        if ((syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) && (node < sizeof(unsigned long) * 8)) {
+            //MPOL_PREFERRED, spelled out to not depend on the NUMA headers
+            constexpr int preferred = 1;
+            unsigned long mask = 1ul << node;
+            syscall(SYS_mbind, block.data, block.size, preferred, &mask, sizeof(unsigned long) * 8, 0);
+        }
+    }
+    #endif
+    #endif
+
+    block.free.emplace(0, block.size);
+    return block;
+}
+
+void GLGE::ChunkArena::__unmapBlock(Block& block) noexcept {
+    if (!block.data) {return;}
+    #if defined(_WIN32)
+    VirtualFree(block.data, 0, MEM_RELEASE);
+    #else
+    munmap(block.data, block.size);
+    #endif
+    block.data = nullptr;
+}
+
+void* GLGE::ChunkArena::__take(Block& block, size_t size) noexcept {
+    for (auto it = block.free.begin(); it != block.free.end(); ++it) {
+        if (it->second < size) {continue;}
+        //take the front of the range, the rest stays free
+        size_t offset = it->first;
+        size_t left = it->second - size;
+        auto hint = block.free.erase(it);
+        if (left > 0) {block.free.emplace_hint(hint, offset + size, left);}
+        return block.data + offset;
+    }
+    return nullptr;
+}
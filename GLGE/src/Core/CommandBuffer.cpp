@@ -0,0 +1,273 @@
+/**
+ * @file CommandBuffer.cpp
+ * @author DM8AT
+ * @brief implement command buffers for deferred structural changes
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//add command buffers
+#include "Core/CommandBuffer.h"
+//add the profiler
+#include "Core/Profiler.h"
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+//the size of a single storage block for recorded component values
+#define VALUE_BLOCK_SIZE (16 * 1024)
+
+/**
+ * @brief hand out unique identifiers for command buffers
+ * 
+ * Identifiers are never re-used, so a thread can not confuse a new command buffer with a destroyed one at the same address.
+ */
+static std::atomic<GLGE::u64> nextBufferId{1};
+
+void GLGE::CommandBuffer::Recorder::reset() noexcept {
+    //the values are destroyed in place, the storage itself is kept for the next frame
+    for (const Value& value : m_values) {value.ops->destroy(value.data);}
+    for (const Change& change : m_changes) {
+        if (change.value.data) {change.value.ops->destroy(change.value.data);}
+    }
+    m_creations.clear();
+    m_values.clear();
+    m_changes.clear();
+    m_links.clear();
+    m_destroyed.clear();
+    m_block = 0;
+    m_used = 0;
+}
+
+void* GLGE::CommandBuffer::Recorder::__allocate(size_t size) {
+    //keep every value aligned for any type
+    size = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    //find a block that has enough space left, blocks of earlier frames are re-used
+    while ((m_block < m_blocks.size()) && (m_used + size > m_blockSizes[m_block])) {
+        ++m_block;
+        m_used = 0;
+    }
+    if (m_block == m_blocks.size()) {
+        //huge values get a block of their own
+        size_t blockSize = std::max<size_t>(VALUE_BLOCK_SIZE, size);
+        m_blocks.push_back(std::make_unique<std::max_align_t[]>(blockSize / sizeof(std::max_align_t)));
+        m_blockSizes.push_back(blockSize);
+        m_used = 0;
+    }
+
+    void* ptr = reinterpret_cast<u8*>(m_blocks[m_block].get()) + m_used;
+    m_used += size;
+    return ptr;
+}
+
+GLGE::CommandBuffer::CommandBuffer(World& world)
+ : m_world(&world), m_id(nextBufferId.fetch_add(1, std::memory_order_relaxed))
+{}
+
+GLGE::CommandBuffer::~CommandBuffer() {
+    Recorder* rec = m_head.load(std::memory_order_acquire);
+    while (rec) {
+        Recorder* next = rec->m_next;
+        delete rec;
+        rec = next;
+    }
+}
+
+GLGE::CommandBuffer::Recorder& GLGE::CommandBuffer::local() {
+    //every thread remembers the recorder it used last, this is the common case inside a parallel iteration
+    thread_local struct {u64 buffer = 0; Recorder* recorder = nullptr;} cache;
+    if (cache.buffer == m_id) {return *cache.recorder;}
+
+    //search the recorder of this thread. Recorders are only ever added to the front, so the list can be walked while
+    //other threads add to it.
+    std::thread::id self = std::this_thread::get_id();
+    Recorder* rec = m_head.load(std::memory_order_acquire);
+    while (rec && (rec->m_thread != self)) {rec = rec->m_next;}
+
+    if (!rec) {
+        //this thread records for the first time, so publish a new recorder
+        rec = new Recorder(m_recorderCount.fetch_add(1, std::memory_order_relaxed));
+        rec->m_next = m_head.load(std::memory_order_relaxed);
+        while (!m_head.compare_exchange_weak(rec->m_next, rec, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    cache.buffer = m_id;
+    cache.recorder = rec;
+    return *rec;
+}
+
+void GLGE::CommandBuffer::flush() {
+    GLGE_PROFILER_SCOPE();
+    std::vector<Recorder*> recorders = __recorders();
+
+    //creations come first, every other command may refer to them
+    __applyCreations(recorders);
+    __applyChanges(recorders);
+
+    //parents are set in order, the same object may be moved multiple times
+    for (Recorder* rec : recorders) {
+        for (const auto& [subject, parent] : rec->m_links) {
+            Object obj = __resolve(subject);
+            if (obj.valid()) {m_world->setParent(obj, __resolve(parent));}
+        }
+    }
+
+    //destruction comes last, so other commands never see destroyed objects
+    for (Recorder* rec : recorders) {
+        for (const Target& target : rec->m_destroyed) {
+            Object obj = __resolve(target);
+            if (obj.valid() && m_world->m_reg.entityColumns(obj)) {m_world->destroy(obj);}
+        }
+    }
+
+    for (Recorder* rec : recorders) {rec->reset();}
+}
+
+void GLGE::CommandBuffer::clear() noexcept {
+    for (Recorder* rec = m_head.load(std::memory_order_acquire); rec; rec = rec->m_next)
+    {rec->reset();}
+}
+
+GLGE::Object GLGE::CommandBuffer::resolve(Pending obj) const noexcept {
+    if ((obj.recorder >= m_created.size()) || (obj.index >= m_created[obj.recorder].size())) {return Object();}
+    return m_created[obj.recorder][obj.index];
+}
+
+std::vector<GLGE::CommandBuffer::Recorder*> GLGE::CommandBuffer::__recorders() const {
+    //the list is in reverse order of creation, sort it so the threads that recorded first are applied first
+    std::vector<Recorder*> recorders;
+    for (Recorder* rec = m_head.load(std::memory_order_acquire); rec; rec = rec->m_next)
+    {recorders.push_back(rec);}
+    std::sort(recorders.begin(), recorders.end(), [](const Recorder* a, const Recorder* b) {return a->m_index < b->m_index;});
+    return recorders;
+}
+
+void GLGE::CommandBuffer::__applyCreations(const std::vector<Recorder*>& recorders) {
+    Registry& reg = m_world->m_reg;
+
+    //group all creations by their set of components
+    std::map<std::vector<Registry::column_t>, std::vector<std::pair<u32, u32>>> groups;
+    m_created.assign(recorders.empty() ? 0 : (recorders.back()->m_index + 1), {});
+    for (const Recorder* rec : recorders) {
+        m_created[rec->m_index].resize(rec->m_creations.size());
+        for (u32 i = 0; i < rec->m_creations.size(); ++i) {
+            const Recorder::Creation& creation = rec->m_creations[i];
+            std::vector<Registry::column_t> columns;
+            columns.reserve(creation.valueCount);
+            for (u32 v = 0; v < creation.valueCount; ++v) {
+                //sparse components are added after the object exists
+                const ComponentOps* ops = rec->m_values[creation.firstValue + v].ops;
+                if (!ops->sparse) {columns.push_back(ops->registerColumn(reg));}
+            }
+            std::sort(columns.begin(), columns.end());
+            columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+            groups[std::move(columns)].emplace_back(rec->m_index, i);
+        }
+    }
+
+    //create every group in one go and move the recorded values in
+    std::vector<std::pair<Object, Object>> links;
+    std::vector<std::string_view> names;
+    std::vector<Object> objects;
+    for (const auto& [columns, members] : groups) {
+        names.clear();
+        objects.clear();
+        for (const auto& [recIdx, creationIdx] : members)
+        {names.push_back(recorders[recIdx]->m_creations[creationIdx].name);}
+        m_world->bulkCreate(names, columns, objects);
+
+        for (size_t i = 0; i < members.size(); ++i) {
+            const Recorder* rec = recorders[members[i].first];
+            const Recorder::Creation& creation = rec->m_creations[members[i].second];
+            for (u32 v = 0; v < creation.valueCount; ++v) {
+                const Value& value = rec->m_values[creation.firstValue + v];
+                if (value.ops->sparse) {value.ops->apply(reg, objects[i], value.data);}
+                else {value.ops->assign(reg, objects[i], value.data);}
+            }
+            m_created[rec->m_index][members[i].second] = objects[i];
+        }
+    }
+
+    //link the new objects into the hierarchy, the parent may be a new object as well
+    for (const Recorder* rec : recorders) {
+        for (u32 i = 0; i < rec->m_creations.size(); ++i)
+        {links.emplace_back(m_created[rec->m_index][i], __resolve(rec->m_creations[i].parent));}
+    }
+    m_world->bulkSetParent(links);
+}
+
+void GLGE::CommandBuffer::__applyChanges(const std::vector<Recorder*>& recorders) {
+    Registry& reg = m_world->m_reg;
+
+    /**
+     * @brief the final state of a changed object
+     */
+    struct State {
+        /**
+         * @brief the changed object
+         */
+        Object object;
+        /**
+         * @brief the columns of the object after all changes
+         */
+        std::vector<Registry::column_t> columns;
+        /**
+         * @brief the values to move in after the object reached its archtype, only the last value per column is kept
+         */
+        std::vector<std::pair<Registry::column_t, const Value*>> values;
+        /**
+         * @brief `true` if the set of columns changed
+         */
+        bool moved = false;
+    };
+
+    //fold all changes of an object into its final state
+    std::vector<State> states;
+    std::unordered_map<u64, size_t> lookup;
+    for (const Recorder* rec : recorders) {
+        for (const Recorder::Change& change : rec->m_changes) {
+            Object obj = __resolve(change.target);
+            const auto* current = obj.valid() ? reg.entityColumns(obj) : nullptr;
+            if (!current) {continue;}
+            //sparse components don't move the object, so they are applied right away
+            if (change.value.ops->sparse) {
+                change.value.ops->apply(reg, obj, change.value.data);
+                continue;
+            }
+
+            auto [it, inserted] = lookup.try_emplace(Tiny::ECS::Entity(obj).getBlob(), states.size());
+            if (inserted) {states.push_back(State{obj, std::vector<Registry::column_t>(current->begin(), current->end()), {}, false});}
+            State& state = states[it->second];
+
+            Registry::column_t col = change.value.ops->registerColumn(reg);
+            auto colIt = std::find(state.columns.begin(), state.columns.end(), col);
+            std::erase_if(state.values, [col](const auto& value) {return value.first == col;});
+            if (change.value.data) {
+                if (colIt == state.columns.end()) {state.columns.push_back(col); state.moved = true;}
+                state.values.emplace_back(col, &change.value);
+            } else if (colIt != state.columns.end()) {
+                state.columns.erase(colIt);
+                state.moved = true;
+            }
+        }
+    }
+
+    //move all objects that end up with the same components together
+    std::map<std::vector<Registry::column_t>, std::vector<Tiny::ECS::Entity>> groups;
+    for (State& state : states) {
+        if (!state.moved) {continue;}
+        std::sort(state.columns.begin(), state.columns.end());
+        groups[state.columns].push_back(state.object);
+    }
+    for (auto& [columns, entities] : groups)
+    {reg.bulkMigrate(entities, columns);}
+
+    //the components exist now, so move the values in
+    for (const State& state : states) {
+        for (const auto& [col, value] : state.values)
+        {value->ops->assign(reg, state.object, value->data);}
+    }
+}
@@ -144,6 +144,7 @@ GLGE::u64 GLGE::CompoundAsset::load(AssetManager* manager, const std::vector<u8>
     m_manager = manager;
     m_virtualEntryMap.clear();
     m_rawBlob.clear();
+    m_pathIndex.clear();
 
     //sanity-check the size early
     if (data.size() < 12) 
@@ -205,6 +206,11 @@ GLGE::u64 GLGE::CompoundAsset::load(AssetManager* manager, const std::vector<u8>
         {offs = oldOffs + entry.reference.compressedSize;}
     }
 
+    //if this asset is loaded through the dependency graph, the sub-assets are embedded dependencies named after it, so 
+    //they load in parallel and a prefetch of this asset already knows about them
+    std::filesystem::path graphPath = m_manager->claimDependencyPath();
+    std::vector<std::pair<FileEntry*, std::filesystem::path>> embedded;
+
     //load all detected compound sub-assets
     for (auto& [name, entry] : m_virtualEntryMap) {
         //check if the asset type is a compound asset
@@ -213,10 +219,21 @@ GLGE::u64 GLGE::CompoundAsset::load(AssetManager* manager, const std::vector<u8>
         //load the sub-asset
         std::vector<u8> dat;
         getUncompressed(dat, entry.reference);
-        entry.handle = m_manager->load<CompoundAsset>(dat);
+        if (graphPath.empty()) {
+            entry.handle = m_manager->load<CompoundAsset>(dat);
+        } else {
+            embedded.emplace_back(&entry, graphPath / name);
+            m_manager->declareEmbeddedDependency<CompoundAsset>(embedded.back().second, std::move(dat));
+        }
 
         //this recursive loading ensures that sub-asset paths are fully accessible
     }
+    //wait for the embedded sub-assets, the calling thread helps loading them
+    for (auto& [entry, path] : embedded)
+    {entry->handle = m_manager->requireEmbedded<CompoundAsset>(path);}
+
+    //build the flat path index once, so lookups never walk the directory tree
+    __rebuildIndex();
 
     //return how much was read (this MAY not be the full data)
     return offs;
@@ -252,6 +269,8 @@ void GLGE::CompoundAsset::store(std::vector<u8>& data) {
 }
 
 void GLGE::CompoundAsset::import_from(AssetManager* manager, const std::filesystem::path& file, u32 format) noexcept(false) {
+    //store the manager, even empty compound assets need it to load their entries later
+    m_manager = manager;
     //empty path ("") means to just stop
     if (file == "") {return;}
 
@@ -304,27 +323,48 @@ void GLGE::CompoundAsset::export_as(const std::filesystem::path& file, u32 forma
     }
 }
 
-bool GLGE::CompoundAsset::hasEntry(const std::filesystem::path& virtualPath) {
-    //get only the top most entry
-    //the actual virtual file that is looked for may be in sub-directories
-
-    //sanity check if the front exists
-    auto beg = virtualPath.begin();
-    if (beg == virtualPath.end()) {return false;}
+bool GLGE::CompoundAsset::hasEntry(u64 pathHash) {
+    GLGE_PROFILER_SCOPE();
+    __ensureIndex();
+    return m_pathIndex.contains(pathHash);
+}
 
-    //check for the top most entry to exist
-    bool exists = m_virtualEntryMap.contains(beg->string());
+void GLGE::CompoundAsset::__rebuildIndex() {
+    GLGE_PROFILER_SCOPE();
+    m_pathIndex.clear();
+    m_pathIndex.reserve(m_virtualEntryMap.size());
+    for (auto& [name, entry] : m_virtualEntryMap) {
+        //index the entry itself
+        __addIndexEntry(IndexEntry{name, this, &entry});
+
+        //nested compound assets contribute all their entries, prefixed with the directory name
+        if ((entry.reference.fileType != getTypeHash64<CompoundAsset>()) || !entry.handle.isValid()) {continue;}
+        CompoundAsset& child = entry.handle.getTyped<CompoundAsset>().reference().getAsset();
+        child.__ensureIndex();
+        for (const auto& [_, sub] : child.m_pathIndex)
+        {__addIndexEntry(IndexEntry{name + "/" + sub.path, sub.owner, sub.entry});}
+    }
+    m_indexDirty = false;
+}
 
-    //if it does not exist, stop
-    if (!exists) {return false;}
+void GLGE::CompoundAsset::__addIndexEntry(IndexEntry&& entry) {
+    u64 hash = __FNV_1A_64_HASH(entry.path);
+    auto it = m_pathIndex.find(hash);
+    if (it == m_pathIndex.end()) {
+        m_pathIndex.emplace(hash, std::move(entry));
+        return;
+    }
+    //a collision would silently make one of the paths resolve to the other, the index stays dirty
+    if (it->second.path != entry.path) {
+        throw GLGE::Exception("The virtual paths \"" + it->second.path + "\" and \"" + entry.path + "\" have the same hash", "GLGE::CompoundAsset::__addIndexEntry");
+    }
+}
 
-    //else, potentially recurse deeper
-    beg++;
-    if (beg == virtualPath.end()) {return exists;}
-    if (m_virtualEntryMap.at(beg->string()).reference.fileType == getTypeHash64<CompoundAsset>())
-    {return m_virtualEntryMap.at(beg->string()).handle.getTyped<CompoundAsset>().reference()->hasEntry(*beg);}
-    //at this point -> fail
-    return false;
+const GLGE::CompoundAsset::IndexEntry* GLGE::CompoundAsset::__findEntry(const std::filesystem::path& virtualPath) {
+    __ensureIndex();
+    std::string path = virtualPath.generic_string();
+    auto it = m_pathIndex.find(__FNV_1A_64_HASH(path));
+    return ((it != m_pathIndex.end()) && (it->second.path == path)) ? &it->second : nullptr;
 }
 
 bool GLGE::CompoundAsset::erase(const std::filesystem::path& virtualPath) {
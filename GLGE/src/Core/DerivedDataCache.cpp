@@ -0,0 +1,278 @@
+/**
+ * @file DerivedDataCache.cpp
+ * @author DM8AT
+ * @brief implement the derived data cache
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+//add the derived data cache
+#include "Core/DerivedDataCache.h"
+//add exceptions
+#include "Core/Exception.h"
+//add settings (for the library version)
+#include "Core/Settings.h"
+//add the profiler
+#include "Core/Profiler.h"
+
+//add file IO
+#include <fstream>
+//add thread safety
+#include <shared_mutex>
+#include <mutex>
+#include <atomic>
+#include <thread>
+//add string formatting
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+
+/*
+Entry File Format:
+1. Magic Number: "DDC0"
+2. key (u64) //must match the file name
+3. payload size (u64)
+4. payload hash (u64) //FNV-1a 64 of the payload
+5. payload (payload size bytes)
+*/
+
+/**
+ * @brief the size of the header of an entry file
+ */
+static constexpr GLGE::u64 ENTRY_HEADER_SIZE = 4 + 3*sizeof(GLGE::u64);
+
+/**
+ * @brief the initial value of the FNV-1a 64 bit hash
+ */
+static constexpr GLGE::u64 FNV_OFFSET = 1469598103934665603ull;
+/**
+ * @brief the prime of the FNV-1a 64 bit hash
+ */
+static constexpr GLGE::u64 FNV_PRIME = 1099511628211ull;
+
+/**
+ * @brief continue a FNV-1a 64 bit hash over a block of bytes
+ *
+ * @param hash the hash to continue
+ * @param data a pointer to the bytes to hash
+ * @param size the amount of bytes to hash
+ * @return `GLGE::u64` the new hash
+ */
+static GLGE::u64 hashBytes(GLGE::u64 hash, const void* data, size_t size) noexcept {
+    const GLGE::u8* bytes = reinterpret_cast<const GLGE::u8*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {hash = (hash ^ bytes[i]) * FNV_PRIME;}
+    return hash;
+}
+
+/**
+ * @brief continue a FNV-1a 64 bit hash over a single value
+ *
+ * @tparam T the type of the value to hash
+ * @param hash the hash to continue
+ * @param value the value to hash
+ * @return `GLGE::u64` the new hash
+ */
+template<typename T>
+static GLGE::u64 hashValue(GLGE::u64 hash, const T& value) noexcept
+{return hashBytes(hash, &value, sizeof(T));}
+
+/**
+ * @brief the shared state of the cache
+ */
+struct CacheState {
+    /**
+     * @brief protect the directory
+     */
+    std::shared_mutex mtx;
+    /**
+     * @brief the directory the entries are stored in (empty if not yet determined)
+     */
+    std::filesystem::path directory;
+    /**
+     * @brief store if the cache is enabled
+     */
+    std::atomic_bool enabled{true};
+    /**
+     * @brief the amount of cache hits
+     */
+    std::atomic<GLGE::u64> hits{0};
+    /**
+     * @brief the amount of cache misses
+     */
+    std::atomic<GLGE::u64> misses{0};
+};
+
+/**
+ * @brief get the state of the cache
+ *
+ * @return `CacheState&` a reference to the lazily constructed state
+ */
+static CacheState& getState() noexcept {
+    static CacheState state;
+    return state;
+}
+
+GLGE::u64 GLGE::DerivedDataCache::computeKey(const std::filesystem::path& source, std::string_view importer, u64 settings, u32 formatVersion) noexcept(false) {
+    GLGE_PROFILER_SCOPE();
+    //open the source file
+    std::ifstream f(source, std::ifstream::binary);
+    if (!f.is_open()) {
+        std::stringstream stream;
+        stream << "Failed to open file " << source << " to compute the derived data key";
+        throw Exception(stream.str(), "GLGE::DerivedDataCache::computeKey");
+    }
+
+    //hash the file content in blocks
+    u64 hash = FNV_OFFSET;
+    std::vector<char> block(1 << 16);
+    while (f) {
+        f.read(block.data(), block.size());
+        hash = hashBytes(hash, block.data(), static_cast<size_t>(f.gcount()));
+    }
+
+    //mix in everything that influences the cooked result
+    hash = hashBytes(hash, importer.data(), importer.size());
+    hash = hashValue(hash, settings);
+    hash = hashValue(hash, formatVersion);
+    return hashValue(hash, static_cast<u32>(GLGE_VERSION));
+}
+
+std::filesystem::path GLGE::DerivedDataCache::entryPath(u64 key) {
+    //name the file after the key
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".ddc";
+    return getDirectory() / name.str();
+}
+
+bool GLGE::DerivedDataCache::fetch(u64 key, std::vector<u8>& data) noexcept {
+    GLGE_PROFILER_SCOPE();
+    CacheState& state = getState();
+    if (!state.enabled) {return false;}
+
+    try {
+        std::filesystem::path path = entryPath(key);
+        std::ifstream f(path, std::ifstream::binary | std::ifstream::ate);
+        if (!f.is_open()) {++state.misses; return false;}
+
+        //read and validate the header
+        u64 fileSize = f.tellg();
+        f.seekg(std::ifstream::beg);
+        char magic[4];
+        u64 storedKey = 0, size = 0, checksum = 0;
+        f.read(magic, 4);
+        f.read(reinterpret_cast<char*>(&storedKey), sizeof(storedKey));
+        f.read(reinterpret_cast<char*>(&size), sizeof(size));
+        f.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+        bool valid = f && (memcmp(magic, "DDC0", 4) == 0) && (storedKey == key) && (fileSize == ENTRY_HEADER_SIZE + size);
+
+        //read the payload directly behind the existing data
+        size_t start = data.size();
+        if (valid) {
+            data.resize(start + size);
+            f.read(reinterpret_cast<char*>(data.data() + start), size);
+            valid = f && (hashBytes(FNV_OFFSET, data.data() + start, size) == checksum);
+        }
+
+        //invalid entries are dropped so they are re-cooked
+        if (!valid) {
+            data.resize(start);
+            f.close();
+            std::error_code err;
+            std::filesystem::remove(path, err);
+            ++state.misses;
+            return false;
+        }
+
+        ++state.hits;
+        return true;
+    } catch (...) {
+        //the cache never fails an import
+        ++state.misses;
+        return false;
+    }
+}
+
+void GLGE::DerivedDataCache::store(u64 key, const std::vector<u8>& data) noexcept {
+    GLGE_PROFILER_SCOPE();
+    if (!getState().enabled) {return;}
+
+    try {
+        std::filesystem::path path = entryPath(key);
+        std::error_code err;
+        std::filesystem::create_directories(path.parent_path(), err);
+        if (err) {return;}
+
+        //write to a per-thread temporary file so no reader sees a partial entry
+        std::filesystem::path tmp = path;
+        tmp += "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+        {
+            std::ofstream f(tmp, std::ofstream::binary | std::ofstream::trunc);
+            if (!f.is_open()) {return;}
+            u64 size = data.size();
+            u64 checksum = hashBytes(FNV_OFFSET, data.data(), data.size());
+            f.write("DDC0", 4);
+            f.write(reinterpret_cast<const char*>(&key), sizeof(key));
+            f.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            f.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+            f.write(reinterpret_cast<const char*>(data.data()), data.size());
+            if (!f) {
+                f.close();
+                std::filesystem::remove(tmp, err);
+                return;
+            }
+        }
+
+        //publish the entry
+        std::filesystem::rename(tmp, path, err);
+        if (err) {std::filesystem::remove(tmp, err);}
+    } catch (...) {
+        //the cache is only an optimization, so writing may silently fail
+    }
+}
+
+void GLGE::DerivedDataCache::clear() noexcept {
+    try {
+        std::error_code err;
+        for (const auto& entry : std::filesystem::directory_iterator(getDirectory(), err)) {
+            if (entry.path().extension() == ".ddc" || entry.path().extension() == ".tmp")
+            {std::filesystem::remove(entry.path(), err);}
+        }
+    } catch (...) {}
+}
+
+void GLGE::DerivedDataCache::setDirectory(const std::filesystem::path& directory) {
+    CacheState& state = getState();
+    std::unique_lock lock(state.mtx);
+    state.directory = directory;
+}
+
+std::filesystem::path GLGE::DerivedDataCache::getDirectory() {
+    CacheState& state = getState();
+    {
+        std::shared_lock lock(state.mtx);
+        if (!state.directory.empty()) {return state.directory;}
+    }
+    //lazily determine the default directory
+    std::unique_lock lock(state.mtx);
+    if (state.directory.empty()) {
+        std::error_code err;
+        std::filesystem::path tmp = std::filesystem::temp_directory_path(err);
+        state.directory = (err ? std::filesystem::path(".") : tmp) / "GLGE" / "DerivedDataCache";
+    }
+    return state.directory;
+}
+
+void GLGE::DerivedDataCache::setEnabled(bool enabled) noexcept
+{getState().enabled = enabled;}
+
+bool GLGE::DerivedDataCache::isEnabled() noexcept
+{return getState().enabled;}
+
+GLGE::u64 GLGE::DerivedDataCache::getHitCount() noexcept
+{return getState().hits;}
+
+GLGE::u64 GLGE::DerivedDataCache::getMissCount() noexcept
+{return getState().misses;}
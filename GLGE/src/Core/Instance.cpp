@@ -12,6 +12,14 @@
 #include "Core/Instance.h"
 //add embree
 #include <embree4/rtcore.h>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+#include <queue>
+#include <functional>
 
 //use the libraries namespace
 using namespace GLGE;
@@ -21,6 +29,107 @@ using namespace GLGE;
  */
 static constexpr Version __GLGE_VERSION = GLGE_VERSION;
 
+/**
+ * @brief the update dependencies between all extensions of an instance
+ */
+struct UpdateGraph {
+    /**
+     * @brief a single extension in the flattened extension tree
+     */
+    struct Node {
+        /**
+         * @brief the extension
+         */
+        InstanceExtension* ext;
+        /**
+         * @brief the name the extension is attached with
+         */
+        std::string_view name;
+        /**
+         * @brief the index of the parent extension, `SIZE_MAX` for extensions attached to the instance
+         */
+        size_t parent;
+        /**
+         * @brief the index behind the last extension of the subtree of this extension
+         */
+        size_t end;
+    };
+    /**
+     * @brief all extensions, parents come before their children and every subtree is a continuous range
+     */
+    std::vector<Node> nodes;
+    /**
+     * @brief for each extension, the extensions that must update after it
+     */
+    std::vector<std::vector<size_t>> users;
+    /**
+     * @brief all extensions in a topological order that keeps the tree order where possible
+     */
+    std::vector<size_t> sorted;
+    /**
+     * @brief the level of each extension, extensions on the same level never depend on each other
+     */
+    std::vector<size_t> level;
+};
+
+/**
+ * @brief build the update graph of an extension tree
+ * 
+ * @param extensions the extensions attached to the instance
+ * @param graph the graph to fill
+ */
+static void buildUpdateGraph(OrderedMap<std::string_view, InstanceExtension*>& extensions, UpdateGraph& graph) {
+    //flatten the extension tree depth first
+    std::vector<UpdateGraph::Node>& nodes = graph.nodes;
+    auto flatten = [&nodes](auto& self, OrderedMap<std::string_view, InstanceExtension*>& list, size_t parent) -> void {
+        for (auto& [name, ext] : list) {
+            size_t idx = nodes.size();
+            nodes.push_back(UpdateGraph::Node{ext, name, parent, 0});
+            self(self, ext->extensions(), idx);
+            nodes[idx].end = nodes.size();
+        }
+    };
+    flatten(flatten, extensions, SIZE_MAX);
+
+    //an extension depends on its parent and on every extension in the subtrees of the siblings it runs after
+    std::vector<std::vector<size_t>>& users = graph.users;
+    users.resize(nodes.size());
+    std::vector<size_t> unmet(nodes.size(), 0);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].parent != SIZE_MAX) {users[nodes[i].parent].push_back(i); ++unmet[i];}
+        for (std::string_view after : nodes[i].ext->getDependencies()) {
+            size_t sibling = SIZE_MAX;
+            for (size_t j = 0; j < nodes.size(); ++j) {
+                if ((j != i) && (nodes[j].parent == nodes[i].parent) && (nodes[j].name == after)) {sibling = j; break;}
+            }
+            if (sibling == SIZE_MAX)
+            {throw Exception("The extension \"" + std::string(nodes[i].name) + "\" should run after \"" + std::string(after) + "\", but no sibling with that name exists", "GLGE::buildUpdateGraph");}
+            for (size_t j = sibling; j < nodes[sibling].end; ++j) {users[j].push_back(i); ++unmet[i];}
+        }
+    }
+
+    //sort the graph topologically, always continuing with the earliest ready extension in tree order. Without any 
+    //dependencies this is the attach order. The level of an extension is one higher than the highest level of its 
+    //dependencies.
+    graph.level.assign(nodes.size(), 0);
+    graph.sorted.reserve(nodes.size());
+    std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> ready;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (unmet[i] == 0) {ready.push(i);}
+    }
+    while (!ready.empty()) {
+        size_t i = ready.top();
+        ready.pop();
+        graph.sorted.push_back(i);
+        for (size_t user : users[i]) {
+            graph.level[user] = std::max(graph.level[user], graph.level[i] + 1);
+            if (--unmet[user] == 0) {ready.push(user);}
+        }
+    }
+    if (graph.sorted.size() != nodes.size())
+    {throw Exception("The update dependencies of the instance extensions contain a cycle", "GLGE::buildUpdateGraph");}
+}
+
 InstanceExtension::InstanceExtension(const OrderedMap<std::string_view, InstanceExtension*> extensions) 
  : m_extensions(extensions)
 {
@@ -55,7 +164,7 @@ void InstanceExtension::update() {
         GLGE_PROFILER_SCOPE_NAMED("GLGE::InstanceExtension::update - onUpdate");
 
         //call the update binding
-        onUpdate();
+        timedUpdate();
     }
 
     {
@@ -67,6 +176,18 @@ void InstanceExtension::update() {
     }
 }
 
+void InstanceExtension::timedUpdate() {
+    auto start = std::chrono::steady_clock::now();
+    onUpdate();
+    //an extension only updates once per tick, so its timing is only written by one thread
+    double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    m_timing.last = time;
+    m_timing.max = std::max(m_timing.max, time);
+    m_totalTime += time;
+    ++m_timing.calls;
+    m_timing.average = m_totalTime / static_cast<double>(m_timing.calls);
+}
+
 void InstanceExtension::mainUpdate() {
     GLGE_PROFILER_SCOPE();
     
@@ -193,6 +314,9 @@ void Instance::updateThread() {
 }
 
 void Instance::nonTemplateCreate() {
+    //let the asset manager prefetch dependencies on the job system
+    m_assetManager.setEmployer(&m_employer);
+
     //create the embree device
     m_embreeDevice = rtcNewDevice(nullptr);
     if (!m_embreeDevice) {
@@ -212,6 +336,11 @@ Instance::~Instance() {
     rtcReleaseDevice(reinterpret_cast<RTCDevice>(m_embreeDevice));
 }
 
+Tiny::Jobs::CompletionAwaiter Instance::nextFrame() {
+    std::lock_guard lock(m_frameMtx);
+    return Tiny::Jobs::CompletionAwaiter(*m_nextFrame, m_nextFrame);
+}
+
 const Version& Instance::getGLGEVersion() noexcept 
 {return __GLGE_VERSION;}
 
@@ -235,6 +364,10 @@ void Instance::start() {
     //if the instance is allready active, stop
     if (m_active) {return;}
 
+    //unknown siblings and cycles are reported here instead of on the update thread
+    UpdateGraph graph;
+    buildUpdateGraph(m_extensions, graph);
+
     //start all the extensions
     for (auto& [name, ext] : m_extensions)
     {ext->start();}
@@ -252,9 +385,16 @@ void Instance::update() {
     //updates are only allowed in an active state
     if (!m_active) {return;}
 
+    //resume everything that waited for this tick, coroutines that wait again wait for the following one
+    std::shared_ptr<Tiny::Jobs::Completion> frame = std::make_shared<Tiny::Jobs::Completion>();
+    {
+        std::lock_guard lock(m_frameMtx);
+        m_nextFrame.swap(frame);
+    }
+    frame->complete();
+
     //update all the extensions
-    for (auto& [name, ext] : m_extensions)
-    {ext->update();}
+    updateExtensions();
 
     //update the keyboards
     {
@@ -300,6 +440,146 @@ void Instance::update() {
     }
 }
 
+void Instance::updateExtensions() {
+    GLGE_PROFILER_SCOPE();
+    auto start = std::chrono::steady_clock::now();
+
+    UpdateGraph graph;
+    buildUpdateGraph(m_extensions, graph);
+    std::vector<UpdateGraph::Node>& nodes = graph.nodes;
+    std::vector<std::vector<size_t>>& users = graph.users;
+    std::vector<size_t>& sorted = graph.sorted;
+    std::vector<size_t>& level = graph.level;
+
+    //group the extensions by level, the sort is stable to keep the tree order inside a level
+    std::vector<size_t> order(nodes.size());
+    for (size_t i = 0; i < order.size(); ++i) {order[i] = i;}
+    std::stable_sort(order.begin(), order.end(), [&level](size_t a, size_t b) {return level[a] < level[b];});
+    size_t levelCount = order.empty() ? 0 : (level[order.back()] + 1);
+
+    if (!m_parallelUpdate.load(std::memory_order_relaxed)) {
+        //the topological order keeps the attach order wherever no dependency requires something else
+        for (size_t i : sorted) {
+            GLGE_PROFILER_SCOPE_NAMED("GLGE::Instance::updateExtensions - onUpdate");
+            nodes[i].ext->timedUpdate();
+        }
+    } else {
+        //an extension that waits for its own parallel work blocks the worker it runs on. One worker is always kept free 
+        //so that this work can be picked up, the update thread updates extensions as well.
+        u32 workers = m_employer.workerCount();
+        size_t helpers = (workers > 1) ? (workers - 1) : 0;
+
+        for (size_t first = 0; first < order.size();) {
+            size_t end = first;
+            while ((end < order.size()) && (level[order[end]] == level[order[first]])) {++end;}
+            size_t count = end - first;
+
+            size_t taskCount = std::min(count - 1, helpers);
+            if (taskCount == 0) {
+                //nothing to update concurrently
+                for (size_t i = first; i < end; ++i) {
+                    GLGE_PROFILER_SCOPE_NAMED("GLGE::Instance::updateExtensions - onUpdate");
+                    nodes[order[i]].ext->timedUpdate();
+                }
+                first = end;
+                continue;
+            }
+
+            //the tasks and the update thread all pull extensions from the same counter until the level is done
+            std::atomic_size_t next{first};
+            std::atomic_size_t leftJobs{taskCount};
+            std::exception_ptr error;
+            std::mutex errorMtx;
+            auto work = [&]() {
+                for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < end; i = next.fetch_add(1, std::memory_order_relaxed)) {
+                    GLGE_PROFILER_SCOPE_NAMED("GLGE::Instance::updateExtensions - onUpdate");
+                    //exceptions can not leave a task, so the first one is stored and re-thrown
+                    try {nodes[order[i]].ext->timedUpdate();}
+                    catch (...) {
+                        std::lock_guard lock(errorMtx);
+                        if (!error) {error = std::current_exception();}
+                    }
+                }
+            };
+            Tiny::Jobs::BulkTask tasks(taskCount, [&](size_t) {work();});
+            m_employer.add_bulk(tasks, leftJobs);
+            work();
+            //the next level depends on this one, so wait for all extensions to finish
+            m_employer.wait([&] {return leftJobs.load(std::memory_order_acquire) == 0;}, false);
+            if (error) {std::rethrow_exception(error);}
+
+            first = end;
+        }
+    }
+
+    //walk the graph in topological order to find the longest chain of dependent updates
+    std::vector<double> pathTime(nodes.size(), 0.);
+    std::vector<size_t> pathPrev(nodes.size(), SIZE_MAX);
+    std::vector<ExtensionTiming> timings(nodes.size());
+    size_t last = SIZE_MAX;
+    for (size_t i : sorted) {
+        timings[i] = nodes[i].ext->m_timing;
+        timings[i].name = nodes[i].name;
+        pathTime[i] += timings[i].last;
+        if ((last == SIZE_MAX) || (pathTime[i] > pathTime[last])) {last = i;}
+        for (size_t user : users[i]) {
+            if ((pathPrev[user] == SIZE_MAX) || (pathTime[i] > pathTime[user])) {pathTime[user] = pathTime[i]; pathPrev[user] = i;}
+        }
+    }
+    std::vector<size_t> path;
+    for (size_t i = last; i != SIZE_MAX; i = pathPrev[i]) {path.push_back(i);}
+    std::reverse(path.begin(), path.end());
+
+    double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::lock_guard lock(m_updateStatMtx);
+    m_updateTimings = std::move(timings);
+    m_criticalPath = std::move(path);
+    m_criticalPathTime = (last == SIZE_MAX) ? 0. : pathTime[last];
+    m_lastUpdateTime = time;
+    m_updateLevelCount = levelCount;
+}
+
+std::vector<ExtensionTiming> Instance::getUpdateTimings() const {
+    std::lock_guard lock(m_updateStatMtx);
+    return m_updateTimings;
+}
+
+std::vector<std::string_view> Instance::getCriticalPath() const {
+    std::lock_guard lock(m_updateStatMtx);
+    std::vector<std::string_view> path;
+    path.reserve(m_criticalPath.size());
+    for (size_t i : m_criticalPath) {path.push_back(m_updateTimings[i].name);}
+    return path;
+}
+
+double Instance::getCriticalPathTime() const {
+    std::lock_guard lock(m_updateStatMtx);
+    return m_criticalPathTime;
+}
+
+std::string Instance::getUpdateReport() const {
+    std::lock_guard lock(m_updateStatMtx);
+    //align the columns to the longest name
+    size_t width = 9;
+    for (const ExtensionTiming& timing : m_updateTimings) {width = std::max(width, timing.name.size());}
+
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << std::left << std::setw(static_cast<int>(width)) << "Extension" << std::right
+           << std::setw(12) << "last (ms)" << std::setw(12) << "avg (ms)" << std::setw(12) << "max (ms)" << std::setw(10) << "calls" << "\n";
+    for (const ExtensionTiming& timing : m_updateTimings) {
+        stream << std::left << std::setw(static_cast<int>(width)) << timing.name << std::right
+               << std::setw(12) << timing.last << std::setw(12) << timing.average << std::setw(12) << timing.max
+               << std::setw(10) << timing.calls << "\n";
+    }
+    stream << "Critical path:";
+    for (size_t i = 0; i < m_criticalPath.size(); ++i)
+    {stream << ((i == 0) ? " " : " -> ") << m_updateTimings[m_criticalPath[i]].name;}
+    stream << " (" << m_criticalPathTime << " ms)\n";
+    stream << "Last update: " << m_lastUpdateTime << " ms in " << m_updateLevelCount << " level(s)\n";
+    return stream.str();
+}
+
 void Instance::shutdown() {
     GLGE_PROFILER_SCOPE();
 
@@ -11,6 +11,9 @@
 //add the mesh asset
 #include "Core/MeshAsset.h"
 
+//add the derived data cache
+#include "Core/DerivedDataCache.h"
+
 //add miniz
 #include "../external/miniz/miniz.h"
 
@@ -73,6 +76,20 @@ File Format:
       //this contains the vertex, index and BVH data
 */
 
+/**
+ * @brief the post processing flags used when importing meshes using assimp
+ * 
+ * @warning changing these changes the key of cached imports, so they are re-imported on the next load
+ */
+static constexpr unsigned int ASSIMP_IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_OptimizeMeshes | aiProcess_ImproveCacheLocality;
+
+/**
+ * @brief the version of the produced mesh format (u16 major in the high, u16 minor in the low half)
+ * 
+ * This must be changed whenever the stored format or the import / LOD generation changes to invalidate cached imports
+ */
+static constexpr GLGE::u32 MESH_FORMAT_VERSION = (0u << 16) | 1u;
+
 /**
  * @brief a helper function to read a value from binary data
  * 
@@ -461,9 +478,22 @@ void GLGE::MeshAsset::import_from(AssetManager* manager, const std::filesystem::
         //load using the loading function
         load(nullptr, data);
     } else if (format == Format::ASSIMP) {
+        //the cooked result only depends on the file content, the import flags and the format version
+        u64 cacheKey = DerivedDataCache::computeKey(file, "GLGE::MeshAsset::ASSIMP", ASSIMP_IMPORT_FLAGS, MESH_FORMAT_VERSION);
+        //try to serve the import from the derived data cache
+        std::vector<u8> cached;
+        if (DerivedDataCache::fetch(cacheKey, cached)) {
+            try {
+                load(manager, cached);
+                return;
+            } catch (const Exception&) {
+                //a stale entry that can't be loaded anymore is just re-imported
+            }
+        }
+
         //load the file using assimp
         Assimp::Importer importer;
-        const aiScene* scene = importer.ReadFile(file.string(), aiProcess_Triangulate | aiProcess_OptimizeMeshes | aiProcess_ImproveCacheLocality);
+        const aiScene* scene = importer.ReadFile(file.string(), ASSIMP_IMPORT_FLAGS);
         //sanity check that there is a mesh to load
         if (!scene) {throw Exception(importer.GetErrorString(), "GLGE::Graphic::Asset::Mesh::import_from");}
         if (!scene->HasMeshes()) {throw Exception("Succeeded to load the scene, but no mesh was found", "GLGE::Graphic::Asset::Mesh::import_from");}
@@ -516,7 +546,7 @@ void GLGE::MeshAsset::import_from(AssetManager* manager, const std::filesystem::
             //check if normals exist
             if (mesh->HasNormals()) {
                 //load the normals
-                *curr->get<vec3, VertexAttribute::Normal>() = vec3(mesh->mNormals[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
+                *curr->get<vec3, VertexAttribute::Normal>() = vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
             }
             //check if tangents exist
             if (mesh->HasTangentsAndBitangents()) {
@@ -593,6 +623,11 @@ void GLGE::MeshAsset::import_from(AssetManager* manager, const std::filesystem::
             //compute the next target error
             newTargetErr *= staggering ? (4.f) : 2.f;
         }
+
+        //store the cooked mesh for later imports
+        std::vector<u8> cooked;
+        store(cooked);
+        DerivedDataCache::store(cacheKey, cooked);
     }
 }
 
@@ -0,0 +1,98 @@
+/**
+ * @file Prefab.cpp
+ * @author DM8AT
+ * @brief implement prefabs
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//add prefabs
+#include "Core/Prefab.h"
+//add the profiler
+#include "Core/Profiler.h"
+
+GLGE::Prefab::Prefab()
+ : m_reg(std::make_unique<Registry>())
+{}
+
+GLGE::Prefab::Prefab(World& world, Object root)
+ : Prefab()
+{capture(world, root);}
+
+void GLGE::Prefab::capture(World& world, Object root) {
+    GLGE_PROFILER_SCOPE();
+    if (!root.valid() || !world.m_reg.entityColumns(root))
+    {throw Exception("Can not capture an object that does not exist", "GLGE::Prefab::capture");}
+
+    //start from scratch, the old entities would never be used again
+    m_reg = std::make_unique<Registry>();
+    m_nodes.clear();
+
+    Registry::column_t nameCol = world.m_reg.registerComponent<Component::Name>();
+    Registry::column_t nodeCol = world.m_reg.registerComponent<Component::HierarchyNode>();
+
+    //walk the hierarchy depth first, so every parent is captured before its children
+    std::vector<std::pair<Tiny::ECS::Entity, size_t>> stack = {{root, SIZE_MAX}};
+    std::vector<Tiny::ECS::Entity> children;
+    std::vector<Tiny::ECS::Entity> ids;
+    while (!stack.empty()) {
+        auto [ent, parent] = stack.back();
+        stack.pop_back();
+
+        Node& node = m_nodes.emplace_back();
+        node.parent = parent;
+        node.name = world.getObjectName(Object(ent));
+        //names and hierarchy nodes are created for every copy, so they are not stored
+        for (Registry::column_t col : *world.m_reg.entityColumns(ent)) {
+            if ((col != nameCol) && (col != nodeCol))
+            {node.columns.push_back(m_reg->registerColumn(world.m_reg, col));}
+        }
+        ids.clear();
+        m_reg->bulkCreate(1, ids, node.columns);
+        node.entity = ids[0];
+        m_reg->copyComponents(world.m_reg, ent, ids);
+
+        //push the children in reverse, so they are captured in order
+        const Component::HierarchyNode* hierarchy = world.m_reg.read<Component::HierarchyNode>(ent);
+        if (!hierarchy) {continue;}
+        children.clear();
+        for (Tiny::ECS::Entity child = hierarchy->firstChild; !(child == Tiny::ECS::Entity::getInvalid()); child = world.m_reg.read<Component::HierarchyNode>(child)->nextSibling)
+        {children.push_back(child);}
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+        {stack.emplace_back(*it, m_nodes.size() - 1);}
+    }
+}
+
+std::vector<GLGE::Object> GLGE::Prefab::instantiate(World& world, size_t count, Object parent) {
+    GLGE_PROFILER_SCOPE();
+    if ((count == 0) || m_nodes.empty()) {return {};}
+
+    //create all copies of a captured object together, they share an archtype
+    std::vector<std::vector<Object>> objects(m_nodes.size());
+    std::vector<Tiny::ECS::Entity> ids;
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        const Node& node = m_nodes[i];
+        //the target world may not know the components yet
+        for (Registry::column_t col : node.columns) {world.m_reg.registerColumn(*m_reg, col);}
+        objects[i].reserve(count);
+        world.bulkCreate(count, node.name, node.columns, objects[i]);
+
+        ids.assign(objects[i].begin(), objects[i].end());
+        world.m_reg.copyComponents(*m_reg, node.entity, ids);
+    }
+
+    //link every copy in the same order the objects where captured in
+    std::vector<std::pair<Object, Object>> links;
+    links.reserve(count * m_nodes.size());
+    for (size_t copy = 0; copy < count; ++copy) {
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            const Node& node = m_nodes[i];
+            links.emplace_back(objects[i][copy], (node.parent == SIZE_MAX) ? parent : objects[node.parent][copy]);
+        }
+    }
+    world.bulkSetParent(links);
+
+    return std::move(objects[0]);
+}
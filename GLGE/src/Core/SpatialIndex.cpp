@@ -0,0 +1,293 @@
+/**
+ * @file SpatialIndex.cpp
+ * @author DM8AT
+ * @brief implement the spatial index
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//add spatial indices
+#include "Core/SpatialIndex.h"
+//add the profiler
+#include "Core/Profiler.h"
+#include <algorithm>
+
+//the cell key of all objects that are larger than a cell (no real cell uses the highest bit)
+#define LARGE_CELL UINT64_MAX
+//the amount of bits per axis of a cell key
+#define CELL_BITS 21
+//the largest cell coordinate that fits into a key
+#define CELL_LIMIT ((1 << (CELL_BITS - 1)) - 1)
+
+/**
+ * @brief compute the cell coordinate of a single axis
+ * 
+ * @param v the position on the axis
+ * @param cellSize the edge length of a cell
+ * @return `i32` the clamped cell coordinate
+ */
+static GLGE::i32 cellCoord(float v, float cellSize) noexcept {
+    float c = std::floor(v / cellSize);
+    //positions far outside the grid share the outermost cells
+    return GLGE::i32(std::clamp(c, -float(CELL_LIMIT), float(CELL_LIMIT)));
+}
+
+/**
+ * @brief pack the coordinates of a cell into a key
+ * 
+ * @param x the x coordinate of the cell
+ * @param y the y coordinate of the cell
+ * @param z the z coordinate of the cell
+ * @return `u64` the key of the cell
+ */
+static GLGE::u64 packCell(GLGE::i32 x, GLGE::i32 y, GLGE::i32 z) noexcept {
+    constexpr GLGE::u64 mask = (GLGE::u64(1) << CELL_BITS) - 1;
+    return ((GLGE::u64(GLGE::u32(x)) & mask) << (2 * CELL_BITS)) | ((GLGE::u64(GLGE::u32(y)) & mask) << CELL_BITS) | (GLGE::u64(GLGE::u32(z)) & mask);
+}
+
+/**
+ * @brief get the coordinates of a cell back from its key
+ * 
+ * @param key the key of the cell
+ * @return `ivec3` the coordinates of the cell
+ */
+static GLGE::ivec3 unpackCell(GLGE::u64 key) noexcept {
+    //shift the field to the top and back down to restore the sign
+    auto field = [key](GLGE::u32 shift) {return GLGE::i32(GLGE::i64(key << (64 - CELL_BITS - shift)) >> (64 - CELL_BITS));};
+    return GLGE::ivec3(field(2 * CELL_BITS), field(CELL_BITS), field(0));
+}
+
+/**
+ * @brief check if an archtype stores a specific column
+ * 
+ * @param reg the registry the archtype belongs to
+ * @param archtype the archtype to check
+ * @param column the column to search for
+ * @return `true` if the archtype stores the column, `false` otherwise
+ */
+static bool hasColumn(GLGE::Registry& reg, GLGE::Registry::archtype_t archtype, GLGE::Registry::column_t column) {
+    const auto& cols = reg.archtypeColumns(archtype);
+    return std::find(cols.begin(), cols.end(), column) != cols.end();
+}
+
+GLGE::Frustum::Frustum(const glm::mat4& viewProj) {
+    //extract the planes from the rows of the matrix (Gribb & Hartmann)
+    auto row = [&viewProj](int i) {return vec4(viewProj[0][i], viewProj[1][i], viewProj[2][i], viewProj[3][i]);};
+    planes[0] = row(3) + row(0);
+    planes[1] = row(3) - row(0);
+    planes[2] = row(3) + row(1);
+    planes[3] = row(3) - row(1);
+    planes[4] = row(3) + row(2);
+    planes[5] = row(3) - row(2);
+    for (vec4& plane : planes) {
+        float len = glm::length(vec3(plane));
+        if (len > 0.f) {plane /= len;}
+    }
+}
+
+bool GLGE::Frustum::intersects(const vec3& min, const vec3& max) const noexcept {
+    for (const vec4& plane : planes) {
+        //only the corner furthest along the normal needs to be checked
+        vec3 corner = glm::mix(min, max, glm::greaterThanEqual(vec3(plane), vec3(0)));
+        if (glm::dot(vec3(plane), corner) + plane.w < 0.f) {return false;}
+    }
+    return true;
+}
+
+GLGE::SpatialIndex::SpatialIndex(float cellSize)
+ : m_cellSize(cellSize)
+{
+    if (!(m_cellSize > 0.f))
+    {throw Exception("The cell size of a spatial index must be larger than 0", "GLGE::SpatialIndex::SpatialIndex");}
+}
+
+void GLGE::SpatialIndex::update(World& world) {
+    GLGE_PROFILER_SCOPE();
+    Registry& reg = world.m_reg;
+    const Registry::column_t worldCol = reg.registerComponent<WorldTransform>();
+    const Registry::column_t boundsCol = reg.registerComponent<Bounds>();
+
+    //a new world invalidates everything that was stored
+    bool full = (m_world != &world);
+    if (full) {
+        m_records.clear();
+        m_cells.clear();
+        m_large.clear();
+        m_snapshot.clear();
+        m_world = &world;
+    }
+    ++m_stamp;
+    m_updated = 0;
+
+    //objects that where stored in a changed chunk, they may have been removed
+    std::vector<u32> removed;
+    m_snapshot.resize(reg.archtypeCount());
+    for (size_t i = 0; i < reg.archtypeCount(); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        std::vector<Tiny::ECS::Entity>& snapshot = m_snapshot[i];
+        bool indexed = hasColumn(reg, arch, worldCol);
+        bool bounded = indexed && hasColumn(reg, arch, boundsCol);
+        std::span<const Tiny::ECS::Entity> ents = indexed ? reg.archtypeEntities(arch) : std::span<const Tiny::ECS::Entity>();
+        size_t oldSize = snapshot.size();
+        if (oldSize + ents.size() == 0) {continue;}
+
+        //every structural change writes to all columns of the affected chunks, so unchanged chunks hold the same objects
+        //only the chunks behind the old or new end need to be checked if the archtype grew or shrunk
+        size_t stable = (oldSize == ents.size()) ? SIZE_MAX : std::min(oldSize, ents.size());
+        snapshot.resize(std::max(oldSize, ents.size()), Tiny::ECS::Entity::getInvalid());
+        for (size_t first = 0; first < snapshot.size(); first += reg.chunkSize()) {
+            size_t chunk = first / reg.chunkSize();
+            bool changed = full || (first + reg.chunkSize() > stable) || (reg.chunkTick(worldCol, arch, chunk) > m_lastTick) ||
+                           (bounded && (reg.chunkTick(boundsCol, arch, chunk) > m_lastTick));
+            if (!changed) {continue;}
+
+            for (size_t j = first; j < std::min(oldSize, first + reg.chunkSize()); ++j)
+            {removed.push_back(snapshot[j].getBlob());}
+
+            size_t end = std::min(ents.size(), first + reg.chunkSize());
+            if (first >= end) {continue;}
+            //a chunk is contiguous, so the components are read through the pointer of its first element
+            const WorldTransform* transf = reg.read<WorldTransform>(ents[first]);
+            const Bounds* bounds = bounded ? reg.read<Bounds>(ents[first]) : nullptr;
+            for (size_t j = first; j < end; ++j) {
+                const WorldTransform& wt = transf[j - first];
+                vec3 center = wt.pos;
+                vec3 half = vec3(0);
+                if (bounds) {
+                    //rotate the local box and take the box around it
+                    const AABB& box = bounds[j - first].box;
+                    glm::mat3 rot = glm::toMat3(wt.rot);
+                    vec3 extent = glm::abs(wt.scale) * box.getExtent() * 0.5f;
+                    center = wt.pos + wt.rot * (wt.scale * box.getCenter());
+                    half = glm::abs(rot[0]) * extent.x + glm::abs(rot[1]) * extent.y + glm::abs(rot[2]) * extent.z;
+                }
+                __insert(ents[j], center - half, center + half);
+                snapshot[j] = ents[j];
+                ++m_updated;
+            }
+        }
+        snapshot.resize(ents.size(), Tiny::ECS::Entity::getInvalid());
+    }
+
+    //objects that where not re-inserted are gone or lost their world transform
+    for (u32 id : removed) {
+        auto it = m_records.find(id);
+        if ((it != m_records.end()) && (it->second.stamp != m_stamp)) {__erase(it);}
+    }
+
+    //everything written from now on belongs to the next update
+    m_lastTick = reg.currentTick();
+    reg.advanceTick();
+}
+
+void GLGE::SpatialIndex::queryRadius(const vec3& center, float radius, std::vector<Object>& out) const {
+    GLGE_PROFILER_SCOPE();
+    float sqr = radius * radius;
+    __visit(center - vec3(radius), center + vec3(radius), [&](const Record& rec) {
+        //the closest point of the box to the center
+        vec3 delta = glm::clamp(center, rec.min, rec.max) - center;
+        if (glm::dot(delta, delta) <= sqr) {out.push_back(Object(rec.entity));}
+    });
+}
+
+void GLGE::SpatialIndex::queryAABB(const AABB& box, std::vector<Object>& out) const {
+    GLGE_PROFILER_SCOPE();
+    vec3 min = box.getMin();
+    vec3 max = box.getMax();
+    __visit(min, max, [&](const Record& rec) {
+        if (glm::all(glm::lessThanEqual(rec.min, max)) && glm::all(glm::greaterThanEqual(rec.max, min)))
+        {out.push_back(Object(rec.entity));}
+    });
+}
+
+void GLGE::SpatialIndex::queryFrustum(const Frustum& frustum, std::vector<Object>& out) const {
+    GLGE_PROFILER_SCOPE();
+    auto test = [&](u32 id) {
+        const Record& rec = m_records.find(id)->second;
+        if (frustum.intersects(rec.min, rec.max)) {out.push_back(Object(rec.entity));}
+    };
+    //a frustum has no useful bounding box, so every cell is tested on its own
+    float half = m_cellSize * 0.5f;
+    for (const auto& [key, cell] : m_cells) {
+        vec3 min = vec3(unpackCell(key)) * m_cellSize;
+        if (!frustum.intersects(min - vec3(half), min + vec3(m_cellSize + half))) {continue;}
+        for (u32 id : cell) {test(id);}
+    }
+    for (u32 id : m_large) {test(id);}
+}
+
+GLGE::u64 GLGE::SpatialIndex::__cellKey(const vec3& pos) const noexcept
+{return packCell(cellCoord(pos.x, m_cellSize), cellCoord(pos.y, m_cellSize), cellCoord(pos.z, m_cellSize));}
+
+void GLGE::SpatialIndex::__insert(Tiny::ECS::Entity ent, const vec3& min, const vec3& max) {
+    //objects larger than a cell would not be found from the neighbouring cells
+    u64 key = glm::any(glm::greaterThan(max - min, vec3(m_cellSize))) ? LARGE_CELL : __cellKey((min + max) * 0.5f);
+    auto [it, inserted] = m_records.try_emplace(ent.getBlob());
+    if (!inserted && (it->second.cell != key)) {
+        __unlink(it->second);
+        inserted = true;
+    }
+    Record& rec = it->second;
+    if (inserted) {
+        std::vector<u32>& cell = (key == LARGE_CELL) ? m_large : m_cells[key];
+        rec.entity = ent;
+        rec.cell = key;
+        rec.slot = u32(cell.size());
+        cell.push_back(ent.getBlob());
+    }
+    rec.min = min;
+    rec.max = max;
+    rec.stamp = m_stamp;
+}
+
+void GLGE::SpatialIndex::__erase(std::unordered_map<u32, Record>::iterator it) {
+    __unlink(it->second);
+    m_records.erase(it);
+}
+
+void GLGE::SpatialIndex::__unlink(const Record& rec) {
+    auto it = m_cells.end();
+    std::vector<u32>* cell = &m_large;
+    if (rec.cell != LARGE_CELL) {
+        it = m_cells.find(rec.cell);
+        cell = &it->second;
+    }
+    //swap-remove, the moved object needs to know its new slot
+    u32 last = cell->back();
+    (*cell)[rec.slot] = last;
+    m_records.find(last)->second.slot = rec.slot;
+    cell->pop_back();
+    if (cell->empty() && (it != m_cells.end())) {m_cells.erase(it);}
+}
+
+template <typename Func>
+void GLGE::SpatialIndex::__visit(const vec3& min, const vec3& max, Func&& fn) const {
+    //objects stick out of their cell by at most half a cell
+    float half = m_cellSize * 0.5f;
+    ivec3 lo(cellCoord(min.x - half, m_cellSize), cellCoord(min.y - half, m_cellSize), cellCoord(min.z - half, m_cellSize));
+    ivec3 hi(cellCoord(max.x + half, m_cellSize), cellCoord(max.y + half, m_cellSize), cellCoord(max.z + half, m_cellSize));
+    u64 range = u64(hi.x - lo.x + 1) * u64(hi.y - lo.y + 1) * u64(hi.z - lo.z + 1);
+
+    if (range <= m_cells.size()) {
+        //small queries look up the cells they cover
+        for (i32 x = lo.x; x <= hi.x; ++x) {
+            for (i32 y = lo.y; y <= hi.y; ++y) {
+                for (i32 z = lo.z; z <= hi.z; ++z) {
+                    auto it = m_cells.find(packCell(x, y, z));
+                    if (it == m_cells.end()) {continue;}
+                    for (u32 id : it->second) {fn(m_records.find(id)->second);}
+                }
+            }
+        }
+    } else {
+        //large queries cover more cells than exist, so only the existing ones are checked
+        for (const auto& [key, cell] : m_cells) {
+            ivec3 c = unpackCell(key);
+            if (glm::any(glm::lessThan(c, lo)) || glm::any(glm::greaterThan(c, hi))) {continue;}
+            for (u32 id : cell) {fn(m_records.find(id)->second);}
+        }
+    }
+    for (u32 id : m_large) {fn(m_records.find(id)->second);}
+}
@@ -0,0 +1,199 @@
+/**
+ * @file SystemScheduler.cpp
+ * @author DM8AT
+ * @brief implement the system scheduler
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+//add the system scheduler
+#include "Core/SystemScheduler.h"
+//instances provide the job system
+#include "Core/Instance.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <chrono>
+#include <sstream>
+#include <iomanip>
+
+/**
+ * @brief check if two lists of type hashes share an element
+ * 
+ * @param a the first list
+ * @param b the second list
+ * @return `true` if at least one hash is in both lists, `false` otherwise
+ */
+static bool overlaps(const std::vector<GLGE::u64>& a, const std::vector<GLGE::u64>& b) noexcept {
+    //systems only access a handful of components, so a linear search is fastest
+    for (GLGE::u64 hash : a) {
+        if (std::find(b.begin(), b.end(), hash) != b.end())
+        {return true;}
+    }
+    return false;
+}
+
+bool GLGE::SystemAccess::conflicts(const SystemAccess& other) const noexcept {
+    if (m_exclusive || other.m_exclusive) {return true;}
+    //reading the same component is fine, everything involving a write is not
+    return overlaps(m_writes, other.m_writes) || overlaps(m_writes, other.m_reads) || overlaps(m_reads, other.m_writes);
+}
+
+GLGE::u64 GLGE::SystemScheduler::add(const std::string& name, const SystemAccess& access, const SystemFunc& func) {
+    if (!func)
+    {throw Exception("Can not add a system without a function", "GLGE::SystemScheduler::add");}
+    Entry& entry = m_systems.emplace_back();
+    entry.id = m_nextId++;
+    entry.access = access;
+    entry.func = func;
+    entry.timing.name = name;
+    return entry.id;
+}
+
+void GLGE::SystemScheduler::remove(u64 id) {
+    //keep the order, it defines the dependencies between the systems
+    Entry& entry = __find(id);
+    m_systems.erase(m_systems.begin() + (&entry - m_systems.data()));
+}
+
+void GLGE::SystemScheduler::setEnabled(u64 id, bool enabled)
+{__find(id).enabled = enabled;}
+
+void GLGE::SystemScheduler::run(World& world) {
+    GLGE_PROFILER_SCOPE();
+    auto start = std::chrono::steady_clock::now();
+
+    //collect the systems that run this time
+    std::vector<Entry*> active;
+    active.reserve(m_systems.size());
+    for (Entry& entry : m_systems) {
+        if (entry.enabled) {active.push_back(&entry);}
+    }
+
+    //build the conflict graph. A system must run after all earlier systems it conflicts with, so its level is one
+    //higher than the highest level of those. Systems on the same level never conflict.
+    std::vector<size_t> level(active.size(), 0);
+    size_t levelCount = active.empty() ? 0 : 1;
+    for (size_t i = 0; i < active.size(); ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            if ((level[j] >= level[i]) && active[i]->access.conflicts(active[j]->access))
+            {level[i] = level[j] + 1;}
+        }
+        levelCount = std::max(levelCount, level[i] + 1);
+    }
+    //sort the systems by level, the sort is stable to keep the order inside a level
+    std::vector<size_t> order(active.size());
+    for (size_t i = 0; i < order.size(); ++i) {order[i] = i;}
+    std::stable_sort(order.begin(), order.end(), [&level](size_t a, size_t b) {return level[a] < level[b];});
+
+    //a system that waits for its own parallel work blocks the worker it runs on. One worker is always kept free so
+    //that this work can be picked up, the calling thread runs systems as well.
+    Instance* instance = world.getInstance();
+    size_t helpers = 0;
+    if (instance) {
+        u32 workers = instance->employer().workerCount();
+        helpers = (workers > 1) ? (workers - 1) : 0;
+    }
+
+    for (size_t first = 0; first < order.size();) {
+        size_t end = first;
+        while ((end < order.size()) && (level[order[end]] == level[order[first]])) {++end;}
+        size_t count = end - first;
+
+        size_t taskCount = std::min(count - 1, helpers);
+        if (taskCount == 0) {
+            //nothing to run concurrently
+            for (size_t i = first; i < end; ++i) {__runSystem(*active[order[i]], world);}
+            first = end;
+            continue;
+        }
+
+        //the tasks and the calling thread all pull systems from the same counter until the level is done
+        std::atomic_size_t next{first};
+        std::atomic_size_t leftJobs{taskCount};
+        std::exception_ptr error;
+        std::mutex errorMtx;
+        auto work = [&]() {
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < end; i = next.fetch_add(1, std::memory_order_relaxed)) {
+                //exceptions can not leave a task, so the first one is stored and re-thrown
+                try {__runSystem(*active[order[i]], world);}
+                catch (...) {
+                    std::lock_guard lock(errorMtx);
+                    if (!error) {error = std::current_exception();}
+                }
+            }
+        };
+        Tiny::Jobs::BulkTask tasks(taskCount, [&](size_t) {work();});
+        instance->employer().add_bulk(tasks, leftJobs);
+        work();
+        //the next level depends on this one, so wait for all systems to finish
+        instance->employer().wait([&] {return leftJobs.load(std::memory_order_acquire) == 0;}, false);
+        if (error) {std::rethrow_exception(error);}
+
+        first = end;
+    }
+
+    m_levelCount = levelCount;
+    m_lastRun = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<GLGE::SystemScheduler::Timing> GLGE::SystemScheduler::getTimings() const {
+    std::vector<Timing> timings;
+    timings.reserve(m_systems.size());
+    for (const Entry& entry : m_systems) {
+        Timing& timing = timings.emplace_back(entry.timing);
+        timing.average = (timing.calls > 0) ? (entry.total / static_cast<double>(timing.calls)) : 0.;
+    }
+    return timings;
+}
+
+std::string GLGE::SystemScheduler::getTimingReport() const {
+    std::vector<Timing> timings = getTimings();
+    //align the columns to the longest name
+    size_t width = 6;
+    for (const Timing& timing : timings) {width = std::max(width, timing.name.size());}
+
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    stream << std::left << std::setw(static_cast<int>(width)) << "System" << std::right
+           << std::setw(12) << "last (ms)" << std::setw(12) << "avg (ms)" << std::setw(12) << "max (ms)" << std::setw(10) << "calls" << "\n";
+    for (const Timing& timing : timings) {
+        stream << std::left << std::setw(static_cast<int>(width)) << timing.name << std::right
+               << std::setw(12) << timing.last << std::setw(12) << timing.average << std::setw(12) << timing.max
+               << std::setw(10) << timing.calls << "\n";
+    }
+    stream << "Last run: " << m_lastRun << " ms in " << m_levelCount << " level(s)\n";
+    return stream.str();
+}
+
+void GLGE::SystemScheduler::resetTimings() noexcept {
+    for (Entry& entry : m_systems) {
+        entry.timing.last = 0.;
+        entry.timing.average = 0.;
+        entry.timing.max = 0.;
+        entry.timing.calls = 0;
+        entry.total = 0.;
+    }
+}
+
+GLGE::SystemScheduler::Entry& GLGE::SystemScheduler::__find(u64 id) {
+    //the identifiers are handed out in order and the order is kept, so a binary search works
+    auto it = std::lower_bound(m_systems.begin(), m_systems.end(), id, [](const Entry& entry, u64 id) {return entry.id < id;});
+    if ((it == m_systems.end()) || (it->id != id))
+    {throw Exception("No system with the identifier " + std::to_string(id) + " exists", "GLGE::SystemScheduler::__find");}
+    return *it;
+}
+
+void GLGE::SystemScheduler::__runSystem(Entry& entry, World& world) {
+    auto start = std::chrono::steady_clock::now();
+    entry.func(world);
+    //a system only runs once per level, so its timing is only written by one thread
+    double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    entry.timing.last = time;
+    entry.timing.max = std::max(entry.timing.max, time);
+    entry.total += time;
+    ++entry.timing.calls;
+}
@@ -10,6 +10,13 @@
  */
 //add transforms
 #include "Core/Transform.h"
+//instances provide the job system
+#include "Core/Instance.h"
+#include <algorithm>
+#include <atomic>
+
+//the amount of objects of a single hierarchy level that are processed by one task
+#define NODES_PER_TASK 512
 
 void GLGE::Transform::load(const std::span<const u8>& buffer) {
     //copy the data
@@ -28,7 +35,7 @@ void GLGE::Transform::store(std::vector<u8>& buffer) {
 void GLGE::Transform2D::load(const std::span<const u8>& buffer) {
     //copy the data
     memcpy(&pos, buffer.data(), sizeof(pos));
-    memcpy(&angle, buffer.data() + sizeof(angle), sizeof(angle));
+    memcpy(&angle, buffer.data() + sizeof(pos), sizeof(angle));
     memcpy(&scale, buffer.data() + sizeof(pos) + sizeof(angle), sizeof(scale));
 }
 
@@ -39,68 +46,218 @@ void GLGE::Transform2D::store(std::vector<u8>& buffer) {
     buffer.insert(buffer.end(), reinterpret_cast<u8*>(&scale), reinterpret_cast<u8*>(&scale) + sizeof(scale));
 }
 
-static void BakeChildren(GLGE::World& world, GLGE::Tiny::ECS::Entity entity, const GLGE::WorldTransform& parentGlobal) {
-    //entity sanity check is the caller's job
-    //this is OK because this is just a local function
-
-    //get the local transform
-    GLGE::Transform* lTransf = world.get<GLGE::Transform>(entity);
-    //if a world transform exists, reuse it. Else, add it
-    GLGE::WorldTransform* wTransf = world.get<GLGE::WorldTransform>(entity);
-    if (!wTransf) {
-        world.add<GLGE::WorldTransform>(entity);
-        wTransf = world.get<GLGE::WorldTransform>(entity);
+/**
+ * @brief run the objects of a single hierarchy level in batches on the employer of the instance of a world
+ * 
+ * Without an instance (or for small levels) the level is processed on the calling thread. 
+ * 
+ * @tparam Func the type of the function to run, called as `fn(start, end)`
+ * @param world the world that provides the instance
+ * @param first the index of the first node of the level
+ * @param end the index behind the last node of the level
+ * @param fn the function to run for each batch
+ */
+template<typename Func>
+static void runLevel(GLGE::World& world, size_t first, size_t end, Func&& fn) {
+    //small levels are not worth the scheduling
+    GLGE::Instance* instance = world.getInstance();
+    if (!instance || ((end - first) <= NODES_PER_TASK)) {
+        fn(first, end);
+        return;
     }
+    //the next level depends on this one, parallel_for only returns once all batches are done
+    instance->employer().parallel_for(first, end, NODES_PER_TASK, fn);
+}
 
-    //compute the world transform (scale -> rot -> pos)
-    //world Scale
-    wTransf->scale = parentGlobal.scale * lTransf->scale;
-    //world Rotation
-    wTransf->rot = parentGlobal.rot * lTransf->rot;
-    //world Position = ParentPos + (ParentRot * (ParentScale * LocalPos))
-    wTransf->pos = parentGlobal.pos + (parentGlobal.rot * (parentGlobal.scale * lTransf->pos));
-
-    //this must be copied, because the archtype may resize
-    GLGE::WorldTransform wTransfCpy = *wTransf;
-
-    //recurse to the children's children
-    GLGE::Component::HierarchyNode* node = world.get<GLGE::Component::HierarchyNode>(entity);
-    if (node->firstChild != GLGE::Tiny::ECS::Entity::getInvalid()) 
-    {BakeChildren(world, node->firstChild, wTransfCpy);}
-
-    //process next sibling
-    if (node->nextSibling != GLGE::Tiny::ECS::Entity::getInvalid())
-    {BakeChildren(world, node->nextSibling, wTransfCpy);}
+/**
+ * @brief check if an archtype stores a specific column
+ * 
+ * @param reg the registry the archtype belongs to
+ * @param archtype the archtype to check
+ * @param column the column to search for
+ * @return `true` if the archtype stores the column, `false` otherwise
+ */
+static bool hasColumn(GLGE::Registry& reg, GLGE::Registry::archtype_t archtype, GLGE::Registry::column_t column) {
+    const auto& cols = reg.archtypeColumns(archtype);
+    return std::find(cols.begin(), cols.end(), column) != cols.end();
 }
 
 void GLGE::System::BakeTransforms(World& world) {
-    //get all objects with a transform and without a parent
-    std::vector<Object> roots;
-    world.each<Transform, Component::HierarchyNode>([&roots](const Object& obj, const Transform&, const Component::HierarchyNode& node){
-        if (node.parent == Tiny::ECS::Entity::getInvalid())
-        {roots.push_back(obj);}
-    });
-
-    //iterate over all the objects
-    for (const auto& obj : roots) {
-        //if a world transform exists, reuse it. Else, add it
-        WorldTransform* wTransf = world.get<WorldTransform>(obj);
-        if (!wTransf) {
-            world.add<WorldTransform>(obj);
-            wTransf = world.get<WorldTransform>(obj);
+    //a fresh propagator has nothing cached, so everything is re-computed
+    TransformPropagator propagator;
+    propagator.update(world);
+}
+
+void GLGE::System::TransformPropagator::update(World& world) {
+    GLGE_PROFILER_SCOPE();
+    Registry& reg = world.m_reg;
+    //registering is not thread safe, so the columns must exist before the levels are processed
+    const Registry::column_t transfCol = reg.registerComponent<Transform>();
+    reg.registerComponent<WorldTransform>();
+
+    //structural changes first, they invalidate the cached hierarchy
+    __addMissing(world);
+    bool rebuilt = (m_world != &world) || __isStale(world);
+    if (rebuilt) {
+        __rebuild(world);
+        m_world = &world;
+    }
+
+    //static worlds don't need any work
+    bool changed = rebuilt;
+    for (size_t i = 0; !changed && (i < reg.archtypeCount()); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        if (!hasColumn(reg, arch, transfCol)) {continue;}
+        for (size_t chunk = 0; chunk * reg.chunkSize() < reg.archtypeEntities(arch).size(); ++chunk) {
+            if (reg.chunkTick(transfCol, arch, chunk) > m_lastTick) {changed = true; break;}
+        }
+    }
+
+    m_updated = 0;
+    if (changed) {
+        std::atomic_size_t updated{0};
+        //parents are always in an earlier level, so the levels are processed in order
+        for (size_t level = 0; level + 1 < m_levels.size(); ++level) {
+            runLevel(world, m_levels[level], m_levels[level + 1], [&](size_t start, size_t end) {
+                size_t count = 0;
+                for (size_t i = start; i < end; ++i) {
+                    const Node& node = m_nodes[i];
+                    //an object is out of date if its transform was written to or its parent changed
+                    bool dirty = rebuilt || (reg.chunkTick(transfCol, node.archtype, node.chunk) > m_lastTick) || 
+                                 ((node.parent != UINT32_MAX) && m_dirty[node.parent]);
+                    m_dirty[i] = dirty;
+                    if (!dirty) {continue;}
+
+                    const Transform& local = *node.local;
+                    WorldTransform& global = *node.global;
+                    if (node.parent == UINT32_MAX) {
+                        //this is a root object, so just copy the data over
+                        global.pos = local.pos;
+                        global.rot = local.rot;
+                        global.scale = local.scale;
+                    } else {
+                        //compute the world transform (scale -> rot -> pos)
+                        const WorldTransform& parent = *m_nodes[node.parent].global;
+                        global.scale = parent.scale * local.scale;
+                        global.rot = parent.rot * local.rot;
+                        //world Position = ParentPos + (ParentRot * (ParentScale * LocalPos))
+                        global.pos = parent.pos + (parent.rot * (parent.scale * local.pos));
+                    }
+                    //the world transform is written through a cached pointer, so mark it by hand
+                    reg.markChanged<WorldTransform>(node.entity);
+                    ++count;
+                }
+                updated.fetch_add(count, std::memory_order_relaxed);
+            });
+        }
+        m_updated = updated.load(std::memory_order_relaxed);
+    }
+
+    //everything written from now on belongs to the next update
+    m_lastTick = reg.currentTick();
+    reg.advanceTick();
+}
+
+void GLGE::System::TransformPropagator::__addMissing(World& world) {
+    Registry& reg = world.m_reg;
+    const Registry::column_t transfCol = reg.registerComponent<Transform>();
+    const Registry::column_t worldCol = reg.registerComponent<WorldTransform>();
+
+    //whole archtypes are either complete or not, so the objects don't need to be checked one by one
+    std::vector<Tiny::ECS::Entity> missing;
+    for (size_t i = 0; i < reg.archtypeCount(); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        if (hasColumn(reg, arch, transfCol) && !hasColumn(reg, arch, worldCol)) {
+            std::span<const Tiny::ECS::Entity> ents = reg.archtypeEntities(arch);
+            missing.insert(missing.end(), ents.begin(), ents.end());
         }
-        //get the local transform
-        Transform* lTransf = world.get<Transform>(obj);
-        //this is a root object, so just copy the data over
-        wTransf->pos = lTransf->pos;
-        wTransf->rot = lTransf->rot;
-        wTransf->scale = lTransf->scale;
-
-        //bake the children
-        Component::HierarchyNode* node = world.get<Component::HierarchyNode>(obj);
-        if (node->firstChild != Tiny::ECS::Entity::getInvalid()) {
-            WorldTransform wTransfCpy = *wTransf; //this must be copied, because the archtype may resize
-            BakeChildren(world, node->firstChild, wTransfCpy);
+    }
+    //adding moves the objects, so this is done from a copy
+    for (const Tiny::ECS::Entity& ent : missing) {reg.add<WorldTransform>(ent);}
+}
+
+bool GLGE::System::TransformPropagator::__isStale(World& world) const {
+    Registry& reg = world.m_reg;
+    const Registry::column_t nodeCol = reg.registerComponent<Component::HierarchyNode>();
+    if (reg.archtypeCount() != m_archSizes.size()) {return true;}
+    //the cached component pointers are invalid once a column moved its storage
+    if ((reg.columnVersion(reg.registerComponent<Transform>()) != m_columnVersions[0]) || 
+        (reg.columnVersion(reg.registerComponent<WorldTransform>()) != m_columnVersions[1])) {return true;}
+
+    //every structural change and every re-parenting writes to the hierarchy nodes of the affected chunks
+    for (size_t i = 0; i < reg.archtypeCount(); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        size_t size = reg.archtypeEntities(arch).size();
+        //objects where removed from the back
+        if (size != m_archSizes[i]) {return true;}
+        if (!hasColumn(reg, arch, nodeCol)) {continue;}
+        for (size_t chunk = 0; chunk * reg.chunkSize() < size; ++chunk) {
+            if (reg.chunkTick(nodeCol, arch, chunk) > m_lastTick) {return true;}
         }
     }
+    return false;
+}
+
+void GLGE::System::TransformPropagator::__rebuild(World& world) {
+    GLGE_PROFILER_SCOPE();
+    Registry& reg = world.m_reg;
+    const Registry::column_t transfCol = reg.registerComponent<Transform>();
+
+    //first, collect all objects with a transform in storage order
+    std::vector<Node> slots;
+    std::unordered_map<u32, u32> lookup;
+    m_archSizes.resize(reg.archtypeCount());
+    m_columnVersions[0] = reg.columnVersion(transfCol);
+    m_columnVersions[1] = reg.columnVersion(reg.registerComponent<WorldTransform>());
+    for (size_t i = 0; i < reg.archtypeCount(); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        std::span<const Tiny::ECS::Entity> ents = reg.archtypeEntities(arch);
+        m_archSizes[i] = ents.size();
+        if (!hasColumn(reg, arch, transfCol)) {continue;}
+        for (size_t local = 0; local < ents.size(); ++local) {
+            lookup.emplace(ents[local].getBlob(), u32(slots.size()));
+            slots.push_back(Node{
+                .entity = ents[local],
+                .parent = UINT32_MAX,
+                .archtype = arch,
+                .chunk = u32(local / reg.chunkSize()),
+                .local = reg.read<Transform>(ents[local]),
+                .global = reg.get<WorldTransform>(ents[local])
+            });
+        }
+    }
+
+    //then, scan the flattened hierarchy to find the closest transformed ancestor of each object
+    //objects without a transform are skipped, their children are relative to the next transformed ancestor
+    //parents always come before their children, so the ancestor of the parent is allways known
+    std::vector<u32> depth(slots.size(), 0);
+    std::span<const World::HierarchyEntry> order = world.getHierarchyOrder();
+    std::vector<u32> closest(order.size(), UINT32_MAX);
+    for (size_t i = 0; i < order.size(); ++i) {
+        u32 ancestor = (order[i].parent == UINT32_MAX) ? UINT32_MAX : closest[order[i].parent];
+        closest[i] = ancestor;
+        auto it = lookup.find(Tiny::ECS::Entity(order[i].object).getBlob());
+        if (it != lookup.end()) {
+            slots[it->second].parent = ancestor;
+            depth[it->second] = (ancestor == UINT32_MAX) ? 0 : depth[ancestor] + 1;
+            closest[i] = it->second;
+        }
+    }
+
+    //sort the objects by depth, the sort is stable so each level stays in storage order
+    u32 levelCount = 0;
+    for (u32 d : depth) {levelCount = std::max(levelCount, d + 1);}
+    m_levels.assign(levelCount + 1, 0);
+    for (u32 d : depth) {++m_levels[d + 1];}
+    for (size_t i = 1; i < m_levels.size(); ++i) {m_levels[i] += m_levels[i - 1];}
+    std::vector<size_t> fill(m_levels.begin(), m_levels.end() - 1);
+    std::vector<u32> remap(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {remap[i] = u32(fill[depth[i]]++);}
+    m_nodes.resize(slots.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        Node& node = m_nodes[remap[i]];
+        node = slots[i];
+        if (node.parent != UINT32_MAX) {node.parent = remap[node.parent];}
+    }
+    m_dirty.assign(m_nodes.size(), 0);
 }
\ No newline at end of file
@@ -10,15 +10,42 @@
  */
 //include the world asset
 #include "Core/WorldAsset.h"
+//add instances (for the employer)
+#include "Core/Instance.h"
 
 //add file stuff
 #include <fstream>
+//for grouping objects by their components
+#include <map>
+#include <algorithm>
+#include <unordered_set>
+//for parallel serialization
+#include <atomic>
+#include <mutex>
+#include <exception>
+
+//add memory mapping for the columnar format
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 /*
 Format description:
 1. Magic Number ("W_AS")
 2. Version ID
 3. Object count (u64)
+3.1. Snapshot ID (u64, since version 2)
 4. World name (size-prefixed string)
 5. Object list
     5.1. Object Size (size of this object) (u32)
@@ -27,10 +54,45 @@ Format description:
     5.4. Parent entity ID
     5.5. Amount of serialized components
     5.5. Additional serialized component + type ID + serialized component size combo
+
+
+Columnar format description:
+1. Magic Number ("W_CL")
+2. Version ID
+3. Object count (u64)
+3.1. Snapshot ID (u64, since version 2)
+4. World name (size-prefixed string)
+5. String table
+    5.1. Amount of strings (u32)
+    5.2. Size-prefixed strings
+6. Hierarchy order (u64 count + u32 entity IDs in pre-order, used to restore the sibling order)
+7. Archtype blocks
+    7.1. Amount of blocks (u32)
+    7.2. Per block: object count (u64), component count (u32)
+    7.3. Per block: entity IDs, name string indices, parent entity IDs (each an u32 array)
+    7.4. Per component: type ID (u64), stride (u32, 0 if the elements have different sizes), data size (u64), 
+         the size of each element (u32 array, only if the stride is 0), padding to 16 bytes, the data, padding to 16 bytes
+
+Delta format description:
+1. Magic Number ("W_DL")
+2. Version ID
+3. Base snapshot ID (u64), Snapshot ID (u64)
+4. Destroyed objects (u64 count + u32 entity IDs)
+5. Created objects (u64 count + objects like in the object list of the GLGE format)
+6. Changed objects (u64 count + objects like in the object list of the GLGE format, only changed components are stored)
+7. Objects whose component set changed (u64 count + u32 entity IDs). They store all components, others are removed. 
 */
 
 //store the current version
-#define CURRENT_VERSION 1
+#define CURRENT_VERSION 2
+//store the current version of the columnar format
+#define CURRENT_COLUMNAR_VERSION 2
+//store the current version of the delta format
+#define CURRENT_DELTA_VERSION 1
+//the alignment of the component data in the columnar format
+#define COLUMNAR_ALIGNMENT 16
+//the amount of objects serialized or parsed by a single task
+#define OBJECTS_PER_TASK 256
 
 /**
  * @brief a helper function to read a value from binary data
@@ -41,7 +103,7 @@ Format description:
  * @return `T` the read value
  */
 template<typename T>
-static T readFromBytes(const std::vector<GLGE::u8>& src, GLGE::u64& offset) {
+static T readFromBytes(std::span<const GLGE::u8> src, GLGE::u64& offset) {
     //check the size
     if (offset + sizeof(T) > src.size()) 
     {throw GLGE::Exception("Out of bounds archive layout read attempt", "CompoundAsset Binary Reader");}
@@ -73,10 +135,202 @@ static void appendToVector(std::vector<GLGE::u8>& dest, const T& value) {
     dest.insert(dest.end(), bytes, bytes + sizeof(T));
 }
 
+/**
+ * @brief a helper to append a whole array to a vector
+ * 
+ * @tparam T the type of the elements to append
+ * @param dest the vector to append to
+ * @param values the values to append
+ */
+template<typename T>
+static void appendArrayToVector(std::vector<GLGE::u8>& dest, std::span<const T> values) {
+    const GLGE::u8* bytes = reinterpret_cast<const GLGE::u8*>(values.data());
+    dest.insert(dest.end(), bytes, bytes + values.size_bytes());
+}
+
+/**
+ * @brief a helper to read a whole array from binary data
+ * 
+ * @tparam T the type of the elements to read
+ * @param src the source buffer to read from
+ * @param offset a REFERENCE to the offset. It is used to read from and then incremented by the size of the array
+ * @param count the amount of elements to read
+ * @return `std::vector<T>` the read values
+ */
+template<typename T>
+static std::vector<T> readArrayFromBytes(std::span<const GLGE::u8> src, GLGE::u64& offset, GLGE::u64 count) {
+    if ((count > src.size()) || (offset + count*sizeof(T) > src.size()))
+    {throw GLGE::Exception("Out of bounds archive layout read attempt", "CompoundAsset Binary Reader");}
+    std::vector<T> vals(count);
+    if (count == 0) {return vals;}
+    memcpy(vals.data(), src.data() + offset, count*sizeof(T));
+    offset += count*sizeof(T);
+    return vals;
+}
+
+/**
+ * @brief split work on objects into batches and run them on the employer of the instance of a world
+ * 
+ * Each batch only touches its own range, the function returns once all batches are done. Without an instance (or for 
+ * little work) the batches are run in order on the calling thread. 
+ * 
+ * @tparam Func the type of the function to run, called as `fn(batch, start, end)`
+ * @param world the world that provides the instance
+ * @param count the amount of objects to process
+ * @param fn the function to run for each batch
+ * @return `size_t` the amount of batches
+ */
+template<typename Func>
+static size_t runBatched(GLGE::World& world, size_t count, Func&& fn) {
+    size_t batches = (count + OBJECTS_PER_TASK - 1) / OBJECTS_PER_TASK;
+    auto run = [&fn, count](size_t batch) {fn(batch, batch * OBJECTS_PER_TASK, std::min(count, (batch + 1) * OBJECTS_PER_TASK));};
+
+    //small amounts of work are not worth the scheduling
+    GLGE::Instance* instance = world.getInstance();
+    if (!instance || (batches < 2)) {
+        for (size_t i = 0; i < batches; ++i) {run(i);}
+        return batches;
+    }
+
+    //exceptions can not leave a task, so the first one is stored and re-thrown
+    std::atomic_size_t leftJobs{batches};
+    std::exception_ptr error;
+    std::mutex errorMtx;
+    GLGE::Tiny::Jobs::BulkTask tasks(batches, [&](size_t batch) {
+        try {run(batch);}
+        catch (...) {
+            std::lock_guard lock(errorMtx);
+            if (!error) {error = std::current_exception();}
+        }
+    });
+    instance->employer().add_bulk(tasks, leftJobs);
+    //wait for all batches to finish
+    instance->employer().wait([&] {return leftJobs.load(std::memory_order_acquire) == 0;}, false);
+    if (error) {std::rethrow_exception(error);}
+    return batches;
+}
+
+/**
+ * @brief a read-only memory mapping of a whole file
+ */
+class MappedFile {
+public:
+
+    /**
+     * @brief map a file
+     * 
+     * @param file the path to the file to map
+     */
+    MappedFile(const std::filesystem::path& file) {
+        #if defined(_WIN32)
+        m_file = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER size;
+        if ((m_file == INVALID_HANDLE_VALUE) || !GetFileSizeEx(m_file, &size)) {__fail(file);}
+        m_size = static_cast<size_t>(size.QuadPart);
+        if (m_size == 0) {return;}
+        m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping) {__fail(file);}
+        m_data = static_cast<const GLGE::u8*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_data) {__fail(file);}
+        #else
+        m_file = open(file.c_str(), O_RDONLY);
+        struct stat info;
+        if ((m_file < 0) || (fstat(m_file, &info) != 0)) {__fail(file);}
+        m_size = static_cast<size_t>(info.st_size);
+        if (m_size == 0) {return;}
+        void* ptr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+        if (ptr == MAP_FAILED) {__fail(file);}
+        m_data = static_cast<const GLGE::u8*>(ptr);
+        //the file is read front to back
+        madvise(ptr, m_size, MADV_SEQUENTIAL);
+        #endif
+    }
+
+    /**
+     * @brief unmap the file
+     */
+    ~MappedFile() {__close();}
+
+    //the mapping is unique
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief access the content of the file
+     * 
+     * @return `std::span<const GLGE::u8>` the mapped bytes
+     */
+    inline std::span<const GLGE::u8> data() const noexcept
+    {return std::span<const GLGE::u8>(m_data, m_size);}
+
+protected:
+
+    /**
+     * @brief release everything and throw an error
+     * 
+     * @param file the path to the file that failed to map
+     */
+    [[noreturn]] void __fail(const std::filesystem::path& file) {
+        __close();
+        std::stringstream stream;
+        stream << "Failed to map file " << file << " during importing world asset";
+        throw GLGE::Exception(stream.str(), "GLGE::WorldAsset::import_from");
+    }
+
+    /**
+     * @brief release the mapping and the file
+     */
+    void __close() noexcept {
+        #if defined(_WIN32)
+        if (m_data) {UnmapViewOfFile(m_data);}
+        if (m_mapping) {CloseHandle(m_mapping);}
+        if (m_file != INVALID_HANDLE_VALUE) {CloseHandle(m_file);}
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+        #else
+        if (m_data) {munmap(const_cast<GLGE::u8*>(m_data), m_size);}
+        if (m_file >= 0) {close(m_file);}
+        m_file = -1;
+        #endif
+        m_data = nullptr;
+    }
+
+    #if defined(_WIN32)
+    /**
+     * @brief the handle of the file
+     */
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    /**
+     * @brief the handle of the file mapping
+     */
+    HANDLE m_mapping = nullptr;
+    #else
+    /**
+     * @brief the file descriptor
+     */
+    int m_file = -1;
+    #endif
+    /**
+     * @brief the start of the mapped data
+     */
+    const GLGE::u8* m_data = nullptr;
+    /**
+     * @brief the size of the mapped data
+     */
+    size_t m_size = 0;
+};
+
 GLGE::u64 GLGE::WorldAsset::load(AssetManager*, const std::vector<u8>& data) {
+    GLGE_PROFILER_SCOPE();
     //sanity check the size
     if (data.size() < 20)
     {throw GLGE::Exception("Failed to load the world asset: too small", "GLGE::WorldAsset::load");}
+    //the columnar format is loaded by its own function
+    if (data[0] == 'W' && data[1] == '_' && data[2] == 'C' && data[3] == 'L')
+    {return loadColumnar(data);}
+    //deltas are applied on top of the current world
+    if (data[0] == 'W' && data[1] == '_' && data[2] == 'D' && data[3] == 'L')
+    {return applyDelta(data);}
     //check the magic number
     if (data[0] != 'W' || data[1] != '_' || data[2] != 'A' || data[3] != 'S')
     {throw GLGE::Exception("Failed to load the world asset: wrong magic number", "GLGE::WorldAsset::load");}
@@ -88,98 +342,216 @@ GLGE::u64 GLGE::WorldAsset::load(AssetManager*, const std::vector<u8>& data) {
     {throw GLGE::Exception("Failed to load the world asset: too new version", "GLGE::WorldAsset::load");}
     //get the object count
     u64 objs = readFromBytes<u64>(data, offs);
-
-    //store an entity blob resolution map
-    //this is required since the entity IDs may not map in the same way
-    std::unordered_map<u32, Tiny::ECS::Entity> entityMap;
-    //store all created objects with the parent node
-    std::vector<std::pair<Object, u32>> created;
-    //prepare the storages
-    entityMap.reserve(objs);
-    created.reserve(objs);
+    //the snapshot ID only exists since version 2
+    u64 snapshot = (version >= 2) ? readFromBytes<u64>(data, offs) : 0;
 
     //read the name
     u32 nameLen = readFromBytes<u32>(data, offs);
-    std::string name;
-    name.reserve(nameLen);
-    for (size_t i = 0; i < nameLen; ++i)
-    {name += readFromBytes<char>(data, offs);}
-    //set the name
-    m_world.setName(name);
-
-    //iterate over all objects and create them
-    for (size_t objId = 0; objId < objs; ++objId) {
-        //store the offset at the start
+    if (offs + nameLen > data.size())
+    {throw Exception("Invalid size", "GLGE::WorldAsset::load");}
+    m_world.setName(std::string(reinterpret_cast<const char*>(data.data() + offs), nameLen));
+    offs += nameLen;
+
+    //parse all objects without touching the world
+    std::vector<ObjDeserializationData> scanned;
+    __parseObjects(data, offs, objs, scanned);
+
+    //create them, the stored IDs now map to a new set of local objects
+    m_storedEntities.clear();
+    std::vector<Object> created;
+    __createObjects(data, scanned, created);
+
+    //finally, link the whole hierarchy in one batch
+    std::vector<std::pair<Object, Object>> links;
+    links.reserve(scanned.size());
+    for (size_t i = 0; i < scanned.size(); ++i)
+    {links.emplace_back(created[i], __resolveStored(scanned[i].parent));}
+    m_world.bulkSetParent(links);
+    m_appliedSnapshot = snapshot;
+
+    //store how much was read
+    return offs;
+}
+
+void GLGE::WorldAsset::__parseObjects(std::span<const u8> data, u64& offs, u64 count, std::vector<ObjDeserializationData>& scanned) {
+    GLGE_PROFILER_SCOPE();
+    //first pass: find the start of all objects by only hopping over their sizes
+    std::vector<u64> objOffsets;
+    objOffsets.reserve(std::min<u64>(count, data.size()));
+    for (size_t objId = 0; objId < count; ++objId) {
         u64 startOffs = offs;
-        //get the size of the object
         u32 objSize = readFromBytes<u32>(data, offs);
         //sanity check
         if (startOffs + sizeof(objSize) + objSize > data.size())
         {throw Exception("Invalid size", "GLGE::WorldAsset::load");}
-        //get the old object ID
-        u32 id = readFromBytes<u32>(data, offs);
-        //get the name
-        u32 nameLen = readFromBytes<u32>(data, offs);
-        std::string name;
-        name.reserve(nameLen);
-        for (u32 i = 0; i < nameLen; ++i)
-        {name += readFromBytes<char>(data, offs);}
-        //get the parent
-        u32 parent = readFromBytes<u32>(data, offs);
-
-        //create the actual entity and store it
-        Object obj = m_world.create(name);
-        created.emplace_back(obj, parent);
-        //deserialize all stored components
-        u32 compCount = readFromBytes<u32>(data, offs);
-        for (size_t i = 0; i < compCount; ++i) {
-            //get the type
-            u64 typeHash = readFromBytes<u64>(data, offs);
-            //get the size
-            u32 compSize = readFromBytes<u32>(data, offs);
-            //deserialize the component
-            auto entry = ms_compReg.m_typeEntries.find(typeHash);
-            if (entry == ms_compReg.m_typeEntries.end()) {
-                //entry is unknown, skip it
-                std::cerr << "[GLGE WARNING] Failed to find the deserialization function for a serialized component of an object, skipping unknown component. Component hash: 0x"
-                          << std::hex << typeHash << std::dec << "\n";
+        objOffsets.push_back(startOffs);
+        offs = startOffs + objSize + sizeof(objSize);
+    }
+
+    //second pass: parse all objects in parallel
+    scanned.resize(objOffsets.size());
+    runBatched(m_world, scanned.size(), [&](size_t, size_t start, size_t end) {
+        for (size_t objId = start; objId < end; ++objId) {
+            u64 offs = objOffsets[objId] + sizeof(u32);
+            ObjDeserializationData& obj = scanned[objId];
+            //get the old object ID
+            obj.id = readFromBytes<u32>(data, offs);
+            //get the name
+            u32 nameLen = readFromBytes<u32>(data, offs);
+            if (offs + nameLen > data.size())
+            {throw Exception("Invalid size", "GLGE::WorldAsset::load");}
+            obj.name = std::string_view(reinterpret_cast<const char*>(data.data() + offs), nameLen);
+            offs += nameLen;
+            //get the parent
+            obj.parent = readFromBytes<u32>(data, offs);
+
+            //collect all stored components
+            u32 compCount = readFromBytes<u32>(data, offs);
+            obj.components.reserve(std::min<u64>(compCount, data.size()));
+            for (size_t i = 0; i < compCount; ++i) {
+                //get the type
+                u64 typeHash = readFromBytes<u64>(data, offs);
+                //get the size
+                u32 compSize = readFromBytes<u32>(data, offs);
+                if (offs + compSize > data.size())
+                {throw Exception("Invalid size", "GLGE::WorldAsset::load");}
+                //find the deserialization functions
+                auto entry = ms_compReg.m_typeEntries.find(typeHash);
+                if (entry != ms_compReg.m_typeEntries.end())
+                {obj.components.emplace_back(typeHash, ComponentSpan{&entry->second, offs, compSize});}
+                else {obj.components.emplace_back(typeHash, ComponentSpan{nullptr, offs, compSize});}
+                //step the offset
                 offs += compSize;
-                continue;
             }
-            //make the span so that out of bounds reads are discovered
-            std::span<const u8> subVec(data.begin() + offs, data.begin() + (offs + compSize));
-            entry->second.loadFn(obj, subVec, &m_world);
-            //step the offset
-            offs += compSize;
+            //the signature of an object does not depend on the order the components where stored in
+            std::sort(obj.components.begin(), obj.components.end(), [](const auto& a, const auto& b) {return a.first < b.first;});
         }
-        //also, add the object mapping
-        entityMap.insert_or_assign(id, static_cast<Tiny::ECS::Entity>(obj));
+    });
 
-        //regardless of how much was read, set the offset
-        offs = startOffs + objSize + sizeof(objSize);
+    //unknown components are reported once per type and skipped (serially, so the output is not interleaved)
+    std::unordered_set<u64> reported;
+    for (ObjDeserializationData& obj : scanned) {
+        std::erase_if(obj.components, [&reported](const auto& comp) {
+            if (comp.second.type) {return false;}
+            if (reported.insert(comp.first).second) {
+                std::cerr << "[GLGE WARNING] Failed to find the deserialization function for a serialized component of an object, skipping unknown component. Component hash: 0x"
+                          << std::hex << comp.first << std::dec << "\n";
+            }
+            return true;
+        });
     }
+}
 
-    //then, iterate over all created objects and correctly set the hierarchy
-    for (const auto& [obj, parent] : created) {
-        //check if root is the parent
-        if (parent == Tiny::ECS::Entity::getInvalid().getBlob())
-        {continue;}
-        //set the parent entity
-        m_world.setParent(obj, entityMap.at(parent));
+void GLGE::WorldAsset::__createObjects(std::span<const u8> data, const std::vector<ObjDeserializationData>& scanned, std::vector<Object>& created) {
+    GLGE_PROFILER_SCOPE();
+    //group the objects by their component signature, keep the order of first appearance for a deterministic creation order
+    std::map<std::vector<u64>, size_t> groupLookup;
+    std::vector<std::vector<size_t>> groups;
+    for (size_t i = 0; i < scanned.size(); ++i) {
+        std::vector<u64> signature;
+        signature.reserve(scanned[i].components.size());
+        for (const auto& [hash, _] : scanned[i].components) {signature.push_back(hash);}
+        auto it = groupLookup.find(signature);
+        if (it == groupLookup.end()) {
+            it = groupLookup.emplace(std::move(signature), groups.size()).first;
+            groups.emplace_back();
+        }
+        groups[it->second].push_back(i);
     }
 
-    //store how much was read
-    return offs;
+    //create each group directly in its final archtype (the ECS is not thread safe, so this is serial)
+    created.assign(scanned.size(), Object());
+    for (const std::vector<size_t>& group : groups) {
+        const ObjDeserializationData& first = scanned[group.front()];
+        std::vector<Registry::column_t> columns;
+        columns.reserve(first.components.size());
+        for (const auto& [_, comp] : first.components) {columns.push_back(comp.type->columnFn(&m_world));}
+        std::vector<std::string_view> names;
+        names.reserve(group.size());
+        for (size_t idx : group) {names.push_back(scanned[idx].name);}
+
+        //create all objects of the group at once
+        std::vector<Object> objects;
+        m_world.bulkCreate(names, std::move(columns), objects);
+        for (size_t i = 0; i < group.size(); ++i) {created[group[i]] = objects[i];}
+    }
+
+    //all components exist now, so their payloads can be deserialized in parallel
+    runBatched(m_world, scanned.size(), [&](size_t, size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            for (const auto& [_, comp] : scanned[i].components) {
+                //make the span so that out of bounds reads are discovered
+                comp.type->loadInPlaceFn(created[i], data.subspan(comp.offset, comp.size), &m_world);
+            }
+        }
+    });
+
+    //store an entity blob resolution map
+    //this is required since the entity IDs may not map in the same way
+    m_storedEntities.reserve(m_storedEntities.size() + scanned.size());
+    for (size_t i = 0; i < scanned.size(); ++i)
+    {m_storedEntities.insert_or_assign(scanned[i].id, static_cast<Tiny::ECS::Entity>(created[i]));}
+}
+
+GLGE::Object GLGE::WorldAsset::__resolveStored(u32 id) const noexcept {
+    //check if root is the parent
+    if (id == Tiny::ECS::Entity::getInvalid().getBlob()) {return World::getRoot();}
+    auto it = m_storedEntities.find(id);
+    return (it == m_storedEntities.end()) ? World::getRoot() : Object(it->second);
+}
+
+void GLGE::WorldAsset::__storeObject(std::vector<u8>& data, Tiny::ECS::Entity entity, const std::vector<std::pair<u64, ComponentRegistry::PFN_Serialize>>& components) {
+    //the size of the object is patched in once it is known
+    size_t objStart = data.size();
+    appendToVector<u32>(data, 0);
+    //add the entity ID
+    appendToVector<u32>(data, entity.getBlob());
+    //store the name
+    const std::string& name = m_world.getObjectName(Object(entity));
+    appendToVector<u32>(data, u32(name.size()));
+    data.insert(data.end(), name.begin(), name.end());
+    //store the parent node
+    appendToVector<u32>(data, u32(m_world.m_reg.read<Component::HierarchyNode>(entity)->parent.getBlob()));
+    //serialize the other elements
+    appendToVector<u32>(data, u32(components.size()));
+    for (const auto& comp : components) {
+        //add the type
+        appendToVector<u64>(data, comp.first);
+        //then serialize directly behind the size
+        size_t sizeOffs = data.size();
+        appendToVector<u32>(data, 0);
+        (*comp.second)(entity, data, &m_world);
+        u32 compSize = u32(data.size() - sizeOffs - sizeof(u32));
+        memcpy(data.data() + sizeOffs, &compSize, sizeof(compSize));
+    }
+    u32 objSize = u32(data.size() - objStart - sizeof(u32));
+    memcpy(data.data() + objStart, &objSize, sizeof(objSize));
+}
+
+GLGE::u64 GLGE::WorldAsset::__markSnapshot() {
+    Registry& reg = m_world.m_reg;
+    const Registry::column_t nameCol = reg.registerComponent<Component::Name>();
+    //remember where every object lives, a different archtype means different components
+    m_snapshotObjects.clear();
+    for (size_t i = 0; i < reg.archtypeCount(); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        const auto& cols = reg.archtypeColumns(arch);
+        if (std::find(cols.begin(), cols.end(), nameCol) == cols.end()) {continue;}
+        for (const Tiny::ECS::Entity& ent : reg.archtypeEntities(arch))
+        {m_snapshotObjects.emplace(ent.getBlob(), arch);}
+    }
+    //everything written from now on belongs to the next snapshot
+    m_snapshotTick = reg.currentTick();
+    reg.advanceTick();
+    return ++m_snapshotId;
 }
 
 void GLGE::WorldAsset::store(std::vector<u8>& data) {
+    GLGE_PROFILER_SCOPE();
     //first step: Discover all objects in the world
-    //also store the name and the position in the world structure
-    std::unordered_map<u32, ObjSerializationData> objs;
-    m_world.each<Component::Name, Component::HierarchyNode>([&objs](const Tiny::ECS::Entity& ent, const Component::Name& name, const Component::HierarchyNode& node) {
-        ObjSerializationData& entry = objs[ent.getBlob()];
-        entry.name = name;
-        entry.node = node;
+    std::unordered_map<u32, std::vector<std::pair<u64, ComponentRegistry::PFN_Serialize>>> objs;
+    m_world.each<Component::Name, Component::HierarchyNode>([&objs](const Tiny::ECS::Entity& ent, const Component::Name&, const Component::HierarchyNode&) {
+        objs[ent.getBlob()];
     });
     //then, discover all registered types
     for (const auto& [typeHash, funcs] : ms_compReg.m_typeEntries) {
@@ -188,58 +560,456 @@ void GLGE::WorldAsset::store(std::vector<u8>& data) {
         funcs.gatherFn(&m_world, &objList);
         //then, add the serialization function
         for (const Object& obj : objList)
-        {objs[static_cast<Tiny::ECS::Entity>(obj).getBlob()].compSerializers.emplace_back(typeHash, funcs.storeFn);}
+        {objs[static_cast<Tiny::ECS::Entity>(obj).getBlob()].emplace_back(typeHash, funcs.storeFn);}
     }
 
-    //now, all objects are known, the name and nodes for all objects are known and the serialization functions for it are known too. 
+    //now, all objects are known and the serialization functions for it are known too. 
+    //sort them so the output does not depend on the hash map layout
+    std::vector<std::pair<u32, const std::vector<std::pair<u64, ComponentRegistry::PFN_Serialize>>*>> sorted;
+    sorted.reserve(objs.size());
+    for (const auto& [obj, comps] : objs) {sorted.emplace_back(obj, &comps);}
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {return a.first < b.first;});
+
+    //deltas are computed against this state
+    u64 snapshot = __markSnapshot();
 
     //the serialization can begin
     //store the magic number and the amount of objects
-    std::vector<u8> serialized = {'W', '_', 'A', 'S'};
-    appendToVector<u32>(serialized, u32(CURRENT_VERSION));
-    appendToVector<u64>(serialized, u64(objs.size()));
+    data.insert(data.end(), {'W', '_', 'A', 'S'});
+    appendToVector<u32>(data, u32(CURRENT_VERSION));
+    appendToVector<u64>(data, u64(sorted.size()));
+    appendToVector<u64>(data, snapshot);
     //add the name
     const std::string& name = m_world.getName();
-    appendToVector<u32>(serialized, u32(name.size()));
-    for (const auto& c : name) {appendToVector<char>(serialized, c);}
-    //iterate over all objects and serialize them
-    for (const auto& [obj, objData] : objs) {
-        //store the serialized object
-        std::vector<u8> serializedObj;
-        //add the entity ID
-        appendToVector<u32>(serializedObj, obj);
-        //store the name
-        const std::string& name = m_world.getObjectName(Object(GLGE::Tiny::ECS::Entity(obj)));
-        appendToVector<u32>(serializedObj, u32(name.size()));
-        for (const auto& c : name)
-        {appendToVector<char>(serializedObj, static_cast<char>(c));}
-        //store the parent node
-        appendToVector<u32>(serializedObj, u32(objData.node.parent.getBlob()));
-        //serialize the other elements
-        appendToVector<u32>(serializedObj, u32(objData.compSerializers.size()));
-        for (const auto& comp : objData.compSerializers) {
-            //add the type
-            appendToVector<u64>(serializedObj, comp.first);
-            //then serialize
-            std::vector<u8> serializedComp;
-            (*comp.second)(Tiny::ECS::Entity(obj), serializedComp, &m_world);
-            //after serialization, store the size and data
-            appendToVector<u32>(serializedObj, serializedComp.size());
-            serializedObj.insert(serializedObj.end(), serializedComp.begin(), serializedComp.end());
+    appendToVector<u32>(data, u32(name.size()));
+    data.insert(data.end(), name.begin(), name.end());
+
+    //serialize the objects in parallel, each batch writes into its own buffer
+    std::vector<std::vector<u8>> buffers((sorted.size() + OBJECTS_PER_TASK - 1) / OBJECTS_PER_TASK);
+    runBatched(m_world, sorted.size(), [&](size_t batch, size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i)
+        {__storeObject(buffers[batch], Tiny::ECS::Entity(sorted[i].first), *sorted[i].second);}
+    });
+
+    //concatenate the batches in order, so the output does not depend on the scheduling
+    size_t total = data.size();
+    for (const std::vector<u8>& buffer : buffers) {total += buffer.size();}
+    data.reserve(total);
+    for (const std::vector<u8>& buffer : buffers) {data.insert(data.end(), buffer.begin(), buffer.end());}
+}
+
+void GLGE::WorldAsset::storeDelta(std::vector<u8>& data) {
+    GLGE_PROFILER_SCOPE();
+    Registry& reg = m_world.m_reg;
+    const Registry::column_t nameCol = reg.registerComponent<Component::Name>();
+    const Registry::column_t nodeCol = reg.registerComponent<Component::HierarchyNode>();
+
+    //resolve the columns of all registered types
+    std::unordered_map<Registry::column_t, std::pair<u64, const ComponentRegistry::TypeEntry*>> registered;
+    for (const auto& [typeHash, entry] : ms_compReg.m_typeEntries)
+    {registered.emplace(entry.columnFn(&m_world), std::make_pair(typeHash, &entry));}
+
+    //take the new snapshot, the old one is the base of the delta
+    u64 baseId = m_snapshotId;
+    Registry::tick_t baseTick = m_snapshotTick;
+    std::unordered_map<u32, Registry::archtype_t> previous = std::move(m_snapshotObjects);
+    u64 snapshot = __markSnapshot();
+
+    //objects that are gone
+    std::vector<u32> destroyed;
+    for (const auto& [id, _] : previous) {
+        if (!m_snapshotObjects.contains(id)) {destroyed.push_back(id);}
+    }
+    std::sort(destroyed.begin(), destroyed.end());
+
+    //visit all chunks that changed since the base snapshot
+    using Record = std::pair<Tiny::ECS::Entity, std::vector<std::pair<u64, ComponentRegistry::PFN_Serialize>>>;
+    std::vector<Record> created, changed;
+    std::vector<u32> reshaped;
+    std::vector<std::pair<u64, ComponentRegistry::PFN_Serialize>> all, dirty;
+    for (size_t i = 0; i < reg.archtypeCount(); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        const auto& cols = reg.archtypeColumns(arch);
+        if (std::find(cols.begin(), cols.end(), nameCol) == cols.end()) {continue;}
+        std::span<const Tiny::ECS::Entity> ents = reg.archtypeEntities(arch);
+
+        for (size_t chunk = 0; chunk * reg.chunkSize() < ents.size(); ++chunk) {
+            //find the components that changed in this chunk
+            bool touched = (reg.chunkTick(nameCol, arch, chunk) > baseTick) || (reg.chunkTick(nodeCol, arch, chunk) > baseTick);
+            all.clear(); dirty.clear();
+            for (Registry::column_t col : cols) {
+                auto it = registered.find(col);
+                if (it == registered.end()) {continue;}
+                all.emplace_back(it->second.first, it->second.second->storeFn);
+                if (reg.chunkTick(col, arch, chunk) > baseTick) {
+                    dirty.emplace_back(it->second.first, it->second.second->storeFn);
+                    touched = true;
+                }
+            }
+            if (!touched) {continue;}
+
+            size_t end = std::min(ents.size(), (chunk + 1) * reg.chunkSize());
+            for (size_t local = chunk * reg.chunkSize(); local < end; ++local) {
+                auto prev = previous.find(ents[local].getBlob());
+                if (prev == previous.end()) {created.emplace_back(ents[local], all);}
+                else if (prev->second != arch) {
+                    //the components changed, so all of them are stored
+                    changed.emplace_back(ents[local], all);
+                    reshaped.push_back(ents[local].getBlob());
+                }
+                else {changed.emplace_back(ents[local], dirty);}
+            }
+        }
+    }
+
+    //header
+    data.insert(data.end(), {'W', '_', 'D', 'L'});
+    appendToVector<u32>(data, u32(CURRENT_DELTA_VERSION));
+    appendToVector<u64>(data, baseId);
+    appendToVector<u64>(data, snapshot);
+    appendToVector<u64>(data, u64(destroyed.size()));
+    appendArrayToVector<u32>(data, destroyed);
+
+    //created and changed objects use the same layout as full snapshots and are serialized in parallel
+    for (const std::vector<Record>* records : {&created, &changed}) {
+        appendToVector<u64>(data, u64(records->size()));
+        std::vector<std::vector<u8>> buffers((records->size() + OBJECTS_PER_TASK - 1) / OBJECTS_PER_TASK);
+        runBatched(m_world, records->size(), [&](size_t batch, size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i)
+            {__storeObject(buffers[batch], (*records)[i].first, (*records)[i].second);}
+        });
+        for (const std::vector<u8>& buffer : buffers) {data.insert(data.end(), buffer.begin(), buffer.end());}
+    }
+
+    appendToVector<u64>(data, u64(reshaped.size()));
+    appendArrayToVector<u32>(data, reshaped);
+}
+
+GLGE::u64 GLGE::WorldAsset::applyDelta(std::span<const u8> data) {
+    GLGE_PROFILER_SCOPE();
+    //check the magic number
+    if (data.size() < 8 || data[0] != 'W' || data[1] != '_' || data[2] != 'D' || data[3] != 'L')
+    {throw GLGE::Exception("Failed to apply the world delta: wrong magic number", "GLGE::WorldAsset::applyDelta");}
+    u64 offs = 4;
+    u32 version = readFromBytes<u32>(data, offs);
+    if (version > CURRENT_DELTA_VERSION)
+    {throw GLGE::Exception("Failed to apply the world delta: too new version", "GLGE::WorldAsset::applyDelta");}
+    u64 baseId = readFromBytes<u64>(data, offs);
+    u64 snapshot = readFromBytes<u64>(data, offs);
+    if (baseId != m_appliedSnapshot) {
+        std::stringstream stream;
+        stream << "Failed to apply the world delta: it is based on snapshot " << baseId << ", but the world is at snapshot " << m_appliedSnapshot;
+        throw GLGE::Exception(stream.str(), "GLGE::WorldAsset::applyDelta");
+    }
+
+    //remove destroyed objects
+    u64 destroyedCount = readFromBytes<u64>(data, offs);
+    for (u32 id : readArrayFromBytes<u32>(data, offs, destroyedCount)) {
+        auto it = m_storedEntities.find(id);
+        if (it == m_storedEntities.end()) {continue;}
+        Object obj(it->second);
+        m_world.destroy(obj);
+        m_storedEntities.erase(it);
+    }
+
+    //create new objects like a full load does
+    u64 createdCount = readFromBytes<u64>(data, offs);
+    std::vector<ObjDeserializationData> scanned;
+    __parseObjects(data, offs, createdCount, scanned);
+    std::vector<Object> created;
+    __createObjects(data, scanned, created);
+    std::vector<std::pair<Object, Object>> links;
+    links.reserve(scanned.size());
+    for (size_t i = 0; i < scanned.size(); ++i)
+    {links.emplace_back(created[i], __resolveStored(scanned[i].parent));}
+    m_world.bulkSetParent(links);
+
+    //update changed objects
+    u64 changedCount = readFromBytes<u64>(data, offs);
+    std::vector<ObjDeserializationData> changed;
+    __parseObjects(data, offs, changedCount, changed);
+    std::unordered_map<u32, size_t> changedLookup;
+    changedLookup.reserve(changed.size());
+    for (const ObjDeserializationData& obj : changed) {
+        auto it = m_storedEntities.find(obj.id);
+        if (it == m_storedEntities.end()) {continue;}
+        Object local(it->second);
+        changedLookup.emplace(obj.id, &obj - changed.data());
+
+        //name and parent are cheap to compare
+        std::string name(obj.name);
+        const std::string& oldName = m_world.getObjectName(local);
+        if (oldName != name) {m_world.onRenamed(it->second, std::string(oldName), name);}
+        Object parent = __resolveStored(obj.parent);
+        if (!(static_cast<Tiny::ECS::Entity>(m_world.getParent(local)) == static_cast<Tiny::ECS::Entity>(parent)))
+        {m_world.setParent(local, parent);}
+
+        //load (or add) all stored components
+        for (const auto& [_, comp] : obj.components)
+        {comp.type->loadFn(it->second, data.subspan(comp.offset, comp.size), &m_world);}
+    }
+
+    //objects that changed their components only keep the stored ones
+    u64 reshapedCount = readFromBytes<u64>(data, offs);
+    for (u32 id : readArrayFromBytes<u32>(data, offs, reshapedCount)) {
+        auto it = m_storedEntities.find(id);
+        auto record = changedLookup.find(id);
+        if ((it == m_storedEntities.end()) || (record == changedLookup.end())) {continue;}
+        const auto& comps = changed[record->second].components;
+        for (const auto& [typeHash, entry] : ms_compReg.m_typeEntries) {
+            bool stored = std::any_of(comps.begin(), comps.end(), [typeHash](const auto& comp) {return comp.first == typeHash;});
+            if (!stored) {entry.removeFn(it->second, &m_world);}
+        }
+    }
+
+    m_appliedSnapshot = snapshot;
+    return offs;
+}
+
+void GLGE::WorldAsset::storeColumnar(std::vector<u8>& data) {
+    GLGE_PROFILER_SCOPE();
+    //alignment is relative to the start of the asset
+    const size_t base = data.size();
+    Registry& reg = m_world.m_reg;
+    const Registry::column_t nameCol = reg.registerComponent<Component::Name>();
+
+    //resolve the columns of all registered types
+    std::unordered_map<Registry::column_t, std::pair<u64, const ComponentRegistry::TypeEntry*>> registered;
+    for (const auto& [typeHash, entry] : ms_compReg.m_typeEntries)
+    {registered.emplace(entry.columnFn(&m_world), std::make_pair(typeHash, &entry));}
+
+    //collect all archtypes that hold objects
+    std::vector<Registry::archtype_t> archtypes;
+    u64 objCount = 0;
+    for (size_t i = 0; i < reg.archtypeCount(); ++i) {
+        Registry::archtype_t arch = static_cast<Registry::archtype_t>(i);
+        const auto& cols = reg.archtypeColumns(arch);
+        if (reg.archtypeEntities(arch).empty() || (std::find(cols.begin(), cols.end(), nameCol) == cols.end())) {continue;}
+        archtypes.push_back(arch);
+        objCount += reg.archtypeEntities(arch).size();
+    }
+
+    //deltas are computed against this state
+    u64 snapshot = __markSnapshot();
+
+    //header
+    data.insert(data.end(), {'W', '_', 'C', 'L'});
+    appendToVector<u32>(data, u32(CURRENT_COLUMNAR_VERSION));
+    appendToVector<u64>(data, objCount);
+    appendToVector<u64>(data, snapshot);
+    const std::string& name = m_world.getName();
+    appendToVector<u32>(data, u32(name.size()));
+    data.insert(data.end(), name.begin(), name.end());
+
+    //string table, every name is only stored once
+    std::unordered_map<u32, u32> nameToString;
+    std::vector<u32> stringIds;
+    for (Registry::archtype_t arch : archtypes) {
+        for (const Tiny::ECS::Entity& ent : reg.archtypeEntities(arch)) {
+            u32 nameId = reg.read<Component::Name>(ent)->name;
+            if (nameToString.emplace(nameId, u32(stringIds.size())).second) {stringIds.push_back(nameId);}
+        }
+    }
+    appendToVector<u32>(data, u32(stringIds.size()));
+    for (u32 nameId : stringIds) {
+        const std::string& str = m_world.m_nameIdMap.at(nameId);
+        appendToVector<u32>(data, u32(str.size()));
+        data.insert(data.end(), str.begin(), str.end());
+    }
+
+    //hierarchy order (pre-order, so parents come before their children and siblings keep their order)
+    std::vector<u32> order;
+    order.reserve(objCount);
+    std::vector<Tiny::ECS::Entity> stack;
+    if (!(m_world.m_root.firstChild == Tiny::ECS::Entity::getInvalid())) {stack.push_back(m_world.m_root.firstChild);}
+    while (!stack.empty()) {
+        Tiny::ECS::Entity ent = stack.back();
+        stack.pop_back();
+        order.push_back(ent.getBlob());
+        const Component::HierarchyNode* node = reg.read<Component::HierarchyNode>(ent);
+        //the sibling is visited after the whole sub tree
+        if (!(node->nextSibling == Tiny::ECS::Entity::getInvalid())) {stack.push_back(node->nextSibling);}
+        if (!(node->firstChild == Tiny::ECS::Entity::getInvalid())) {stack.push_back(node->firstChild);}
+    }
+    appendToVector<u64>(data, u64(order.size()));
+    appendArrayToVector<u32>(data, order);
+
+    //archtype blocks
+    appendToVector<u32>(data, u32(archtypes.size()));
+    std::vector<u32> ids, names, parents, sizes;
+    for (Registry::archtype_t arch : archtypes) {
+        std::span<const Tiny::ECS::Entity> ents = reg.archtypeEntities(arch);
+        //only registered components are stored
+        std::vector<std::pair<u64, const ComponentRegistry::TypeEntry*>> comps;
+        for (Registry::column_t col : reg.archtypeColumns(arch)) {
+            auto it = registered.find(col);
+            if (it != registered.end()) {comps.push_back(it->second);}
+        }
+        appendToVector<u64>(data, u64(ents.size()));
+        appendToVector<u32>(data, u32(comps.size()));
+
+        //per object data
+        ids.clear(); names.clear(); parents.clear();
+        for (const Tiny::ECS::Entity& ent : ents) {
+            ids.push_back(ent.getBlob());
+            names.push_back(nameToString.at(reg.read<Component::Name>(ent)->name));
+            parents.push_back(reg.read<Component::HierarchyNode>(ent)->parent.getBlob());
+        }
+        appendArrayToVector<u32>(data, ids);
+        appendArrayToVector<u32>(data, names);
+        appendArrayToVector<u32>(data, parents);
+
+        //the columns
+        for (const auto& [typeHash, entry] : comps) {
+            std::vector<u8> column;
+            sizes.clear();
+            entry->storeColumnFn(&m_world, ents, column, sizes);
+            //if all elements have the same size the size table is not needed
+            u32 stride = ents.empty() ? 0 : u32(column.size() / ents.size());
+            if (!sizes.empty() && !std::all_of(sizes.begin(), sizes.end(), [&sizes](u32 s) {return s == sizes.front();})) {stride = 0;}
+
+            appendToVector<u64>(data, typeHash);
+            appendToVector<u32>(data, stride);
+            appendToVector<u64>(data, u64(column.size()));
+            if (stride == 0) {appendArrayToVector<u32>(data, sizes);}
+            data.resize(base + (((data.size() - base) + COLUMNAR_ALIGNMENT - 1) & ~size_t(COLUMNAR_ALIGNMENT - 1)), 0);
+            data.insert(data.end(), column.begin(), column.end());
+            data.resize(base + (((data.size() - base) + COLUMNAR_ALIGNMENT - 1) & ~size_t(COLUMNAR_ALIGNMENT - 1)), 0);
         }
-        //append the object
-        appendToVector<u32>(serialized, u32(serializedObj.size()));
-        serialized.insert(serialized.end(), serializedObj.begin(), serializedObj.end());
     }
+}
+
+GLGE::u64 GLGE::WorldAsset::loadColumnar(std::span<const u8> data) {
+    GLGE_PROFILER_SCOPE();
+    //sanity check the size
+    if (data.size() < 20)
+    {throw GLGE::Exception("Failed to load the world asset: too small", "GLGE::WorldAsset::loadColumnar");}
+    //check the magic number
+    if (data[0] != 'W' || data[1] != '_' || data[2] != 'C' || data[3] != 'L')
+    {throw GLGE::Exception("Failed to load the world asset: wrong magic number", "GLGE::WorldAsset::loadColumnar");}
+    u64 offs = 4;
+    u32 version = readFromBytes<u32>(data, offs);
+    if (version > CURRENT_COLUMNAR_VERSION)
+    {throw GLGE::Exception("Failed to load the world asset: too new version", "GLGE::WorldAsset::loadColumnar");}
+    u64 objCount = readFromBytes<u64>(data, offs);
+    //the snapshot ID only exists since version 2
+    u64 snapshot = (version >= 2) ? readFromBytes<u64>(data, offs) : 0;
+
+    //read the name
+    u32 nameLen = readFromBytes<u32>(data, offs);
+    if (offs + nameLen > data.size())
+    {throw Exception("Invalid size", "GLGE::WorldAsset::loadColumnar");}
+    m_world.setName(std::string(reinterpret_cast<const char*>(data.data() + offs), nameLen));
+    offs += nameLen;
+
+    //read the string table as views into the data
+    u32 stringCount = readFromBytes<u32>(data, offs);
+    std::vector<std::string_view> strings;
+    strings.reserve(std::min<u64>(stringCount, data.size()));
+    for (u32 i = 0; i < stringCount; ++i) {
+        u32 len = readFromBytes<u32>(data, offs);
+        if (offs + len > data.size())
+        {throw Exception("Invalid size", "GLGE::WorldAsset::loadColumnar");}
+        strings.emplace_back(reinterpret_cast<const char*>(data.data() + offs), len);
+        offs += len;
+    }
+
+    //read the hierarchy order
+    u64 orderCount = readFromBytes<u64>(data, offs);
+    std::vector<u32> order = readArrayFromBytes<u32>(data, offs, orderCount);
+
+    //create the objects block by block
+    std::unordered_map<u32, std::pair<Object, u32>> created;
+    created.reserve(std::min<u64>(objCount, data.size()));
+    u32 blockCount = readFromBytes<u32>(data, offs);
+    std::vector<std::string_view> names;
+    std::vector<Object> objects;
+    for (u32 block = 0; block < blockCount; ++block) {
+        u64 count = readFromBytes<u64>(data, offs);
+        u32 compCount = readFromBytes<u32>(data, offs);
+        std::vector<u32> ids = readArrayFromBytes<u32>(data, offs, count);
+        std::vector<u32> nameIdx = readArrayFromBytes<u32>(data, offs, count);
+        std::vector<u32> parents = readArrayFromBytes<u32>(data, offs, count);
+
+        //locate all columns before creating anything
+        std::vector<std::tuple<const ComponentRegistry::TypeEntry*, std::span<const u8>, std::vector<u32>>> columns;
+        columns.reserve(compCount);
+        for (u32 i = 0; i < compCount; ++i) {
+            u64 typeHash = readFromBytes<u64>(data, offs);
+            u32 stride = readFromBytes<u32>(data, offs);
+            u64 size = readFromBytes<u64>(data, offs);
+            std::vector<u32> sizes;
+            if (stride == 0) {sizes = readArrayFromBytes<u32>(data, offs, count);}
+            offs = (offs + COLUMNAR_ALIGNMENT - 1) & ~u64(COLUMNAR_ALIGNMENT - 1);
+            if ((size > data.size()) || (offs + size > data.size()))
+            {throw Exception("Invalid size", "GLGE::WorldAsset::loadColumnar");}
+            std::span<const u8> column = data.subspan(offs, size);
+            offs = (offs + size + COLUMNAR_ALIGNMENT - 1) & ~u64(COLUMNAR_ALIGNMENT - 1);
 
-    //store the serialized data
-    data.insert(data.end(), serialized.begin(), serialized.end());
+            auto entry = ms_compReg.m_typeEntries.find(typeHash);
+            if (entry == ms_compReg.m_typeEntries.end()) {
+                //entry is unknown, skip it
+                std::cerr << "[GLGE WARNING] Failed to find the deserialization function for a serialized component column, skipping unknown component. Component hash: 0x"
+                          << std::hex << typeHash << std::dec << "\n";
+                continue;
+            }
+            columns.emplace_back(&entry->second, column, std::move(sizes));
+        }
+
+        //create the whole block in its archtype
+        names.clear();
+        names.reserve(count);
+        for (u32 idx : nameIdx) {
+            if (idx >= strings.size())
+            {throw Exception("Invalid name index", "GLGE::WorldAsset::loadColumnar");}
+            names.push_back(strings[idx]);
+        }
+        std::vector<Registry::column_t> colIds;
+        colIds.reserve(columns.size());
+        for (const auto& [entry, _, __] : columns) {colIds.push_back(entry->columnFn(&m_world));}
+        objects.clear();
+        m_world.bulkCreate(names, std::move(colIds), objects);
+
+        //fill the columns
+        for (const auto& [entry, column, sizes] : columns)
+        {entry->loadColumnFn(&m_world, objects, column, sizes);}
+        for (size_t i = 0; i < count; ++i)
+        {created.insert_or_assign(ids[i], std::make_pair(objects[i], parents[i]));}
+    }
+
+    //link the hierarchy in the stored order, parents are always linked before their children
+    std::vector<std::pair<Object, Object>> links;
+    links.reserve(created.size());
+    std::unordered_set<u32> linked;
+    linked.reserve(created.size());
+    for (u32 id : order) {
+        auto it = created.find(id);
+        if ((it == created.end()) || !linked.insert(id).second) {continue;}
+        auto parentIt = created.find(it->second.second);
+        links.emplace_back(it->second.first, (parentIt == created.end()) ? World::getRoot() : parentIt->second.first);
+    }
+    m_world.bulkSetParent(links);
+
+    //remember the stored IDs so deltas can be applied
+    m_storedEntities.clear();
+    m_storedEntities.reserve(created.size());
+    for (const auto& [id, obj] : created) {m_storedEntities.emplace(id, static_cast<Tiny::ECS::Entity>(obj.first));}
+    m_appliedSnapshot = snapshot;
+
+    return offs;
 }
 
 void GLGE::WorldAsset::import_from(AssetManager* manager, const std::filesystem::path& file, u32 format) noexcept(false) {
     //empty path ("") means to just stop
     if (file == "") {return;}
 
+    //the columnar format is read directly from the mapped file
+    if (format == Format::COLUMNAR) {
+        MappedFile mapped(file);
+        loadColumnar(mapped.data());
+        return;
+    }
+
     //some data is needed to be handled specially
     if (format == Format::GLGE) {
         //open the file in a binary data stream, create a vector from it and just use the GLGE load function
@@ -283,6 +1053,15 @@ void GLGE::WorldAsset::export_as(const std::filesystem::path& file, u32 format)
         }
         break;
 
+    //export as columnar format
+    case Format::COLUMNAR: {
+            std::vector<u8> blob;
+            storeColumnar(blob);
+            std::ofstream f(file, std::fstream::binary);
+            f.write((char*)blob.data(), blob.size());
+        }
+        break;
+
     default:
         //unknown format
         throw GLGE::Exception("Unknown format for a compound asset", "GLGE::WorldAsset::import_from");
@@ -21,6 +21,11 @@
 #include <fstream>
 //add miniz (for zip compression / decompression)
 #include "miniz/miniz.h"
+//add the derived data cache
+#include "Core/DerivedDataCache.h"
+
+//the version of the stored image format (part of the derived data cache key)
+static constexpr GLGE::u32 IMAGE_FORMAT_VERSION = 1;
 
 GLGE::u64 GLGE::Graphic::Asset::ImageCPU::load(AssetManager*, const std::vector<u8>& inp) {
     //grab the uncompressed size
@@ -28,7 +33,7 @@ GLGE::u64 GLGE::Graphic::Asset::ImageCPU::load(AssetManager*, const std::vector<
     memcpy((u8*)&expectedSize, inp.data(), 8);
     //store the final data
     std::vector<u8> data;
-    data.reserve(expectedSize);
+    data.resize(expectedSize);
     //decompress everything
     mz_ulong out_len = expectedSize;
     int status = mz_uncompress(data.data(), &out_len, inp.data()+8, inp.size()-8);
@@ -110,11 +115,38 @@ void GLGE::Graphic::Asset::ImageCPU::import_from(AssetManager*, const std::files
 
         //parse the GLGE data
         load(nullptr, data);
-    } else if (format == Format::HDR) {
+    } else {
+        //stb imports are served from the derived data cache if the same file was imported before
+        //the format is part of the key as it decides between float and RGBA8 decoding
+        u64 cacheKey = DerivedDataCache::computeKey(file, "GLGE::Graphic::Asset::ImageCPU::STB", format, IMAGE_FORMAT_VERSION);
+        std::vector<u8> cached;
+        if (DerivedDataCache::fetch(cacheKey, cached)) {
+            try {
+                load(nullptr, cached);
+                return;
+            } catch (const Exception&) {
+                //a stale entry that can't be loaded anymore is just re-imported
+            }
+        }
+
+        //decode the file using stb
+        importSTB(file, format);
+
+        //store the cooked image for later imports
+        std::vector<u8> cooked;
+        store(cooked);
+        DerivedDataCache::store(cacheKey, cooked);
+    }
+}
+
+void GLGE::Graphic::Asset::ImageCPU::importSTB(const std::filesystem::path& file, u32 format) noexcept(false) {
+    if (format == Format::HDR) {
         //hdr loads as floats
         ivec2 size;
         int channels;
         float* data = stbi_loadf(reinterpret_cast<const char*>(file.u8string().c_str()), &size.x, &size.y, &channels, 0);
+        //a failed decode must not end up in the derived data cache
+        if (!data) {throw Exception(stbi_failure_reason(), "GLGE::Graphic::Asset::ImageCPU::importSTB");}
 
         //construct the image format
         GLGE::Graphic::PixelFormat form = (channels == 1) ? GLGE::Graphic::PIXEL_FORMAT_R_32_FLOAT : 
@@ -130,6 +162,7 @@ void GLGE::Graphic::Asset::ImageCPU::import_from(AssetManager*, const std::files
         ivec2 size;
         int channels;
         void* data = stbi_load(reinterpret_cast<const char*>(file.u8string().c_str()), &size.x, &size.y, &channels, 4);
+        if (!data) {throw Exception(stbi_failure_reason(), "GLGE::Graphic::Asset::ImageCPU::importSTB");}
         //format fixed as RGBA8_UNORM
         //load the data to the local image
         m_img = GLGE::Graphic::ImageCPU(data, GLGE::Graphic::PIXEL_FORMAT_RGBA_8_UNORM, uvec2{size.x, size.y});
@@ -44,12 +44,17 @@
 #include <fstream>
 //add mini-z for zip compression
 #include "miniz/miniz.h"
+//add the derived data cache
+#include "Core/DerivedDataCache.h"
 
 //store the current version constants
 static const constexpr GLGE::u8 VERSION_MAJOR = 1;
 static const constexpr GLGE::u8 VERSION_MINOR = 0;
 static const constexpr GLGE::u8 VERSION_PATCH = 0;
 
+//the post processing flags used for assimp imports (part of the derived data cache key)
+static const constexpr unsigned int ASSIMP_IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_OptimizeMeshes | aiProcess_ImproveCacheLocality;
+
 /**
  * @brief define the structure for the imported vertices
  * 
@@ -277,7 +282,7 @@ void GLGE::Graphic::Asset::Mesh::store(std::vector<u8>& out) {
     out.insert(out.end(), data.begin(), data.end());
 }
 
-void GLGE::Graphic::Asset::Mesh::import_from(AssetManager*, const std::filesystem::path& file, u32 format) {
+void GLGE::Graphic::Asset::Mesh::import_from(AssetManager* manager, const std::filesystem::path& file, u32 format) {
     //check if the file exists
     if (!std::filesystem::is_regular_file(file)) {
         std::stringstream stream;
@@ -297,9 +302,21 @@ void GLGE::Graphic::Asset::Mesh::import_from(AssetManager*, const std::filesyste
         //load using the loading function
         load(nullptr, data);
     } else if (format == Format::ASSIMP) {
+        //try to serve the import from the derived data cache
+        u64 cacheKey = DerivedDataCache::computeKey(file, "GLGE::Graphic::Asset::Mesh::ASSIMP", ASSIMP_IMPORT_FLAGS, GLGE_VERSION_COMBINE(VERSION_MAJOR, VERSION_MINOR, VERSION_PATCH));
+        std::vector<u8> cached;
+        if (DerivedDataCache::fetch(cacheKey, cached)) {
+            try {
+                load(manager, cached);
+                return;
+            } catch (const Exception&) {
+                //a stale entry that can't be loaded anymore is just re-imported
+            }
+        }
+
         //load the file using assimp
         Assimp::Importer importer;
-        const aiScene* scene = importer.ReadFile(file.string(), aiProcess_Triangulate | aiProcess_OptimizeMeshes | aiProcess_ImproveCacheLocality);
+        const aiScene* scene = importer.ReadFile(file.string(), ASSIMP_IMPORT_FLAGS);
         //sanity check that there is a mesh to load
         if (!scene) {throw Exception(importer.GetErrorString(), "GLGE::Graphic::Asset::Mesh::import_from");}
         if (!scene->HasMeshes()) {throw Exception("Succeeded to load the scene, but no mesh was found", "GLGE::Graphic::Asset::Mesh::import_from");}
@@ -381,6 +398,11 @@ void GLGE::Graphic::Asset::Mesh::import_from(AssetManager*, const std::filesyste
         };
         //construct the final mesh
         m_mesh.set(vertices.data(), sizeof(Vertex), vertices.size(), indices.data(), indices.size(), &info, 1, defaultAttributes, sizeof(defaultAttributes)/sizeof(*defaultAttributes));
+
+        //store the cooked mesh for later imports
+        std::vector<u8> cooked;
+        store(cooked);
+        DerivedDataCache::store(cacheKey, cooked);
     }
 }
 
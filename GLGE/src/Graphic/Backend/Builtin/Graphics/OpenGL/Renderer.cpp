@@ -223,7 +223,7 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
         data.projection = glm::perspective(data.fov, aspect, data.proj_near, data.proj_far);
 
         //get the position (this can be Transform, Transform2D or none)
-        WorldTransform* transf = m_world->get<WorldTransform>(*m_camera);
+        const WorldTransform* transf = m_world->read<WorldTransform>(*m_camera);
 
         if (transf) {
             //transform in use
@@ -240,7 +240,7 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
             data.compressedQuaternion_k_w = *(reinterpret_cast<GLGE::u32*>(&quat)+1);
         } else {
             //check transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(*m_camera);
+            const Transform2D* transf2d = m_world->read<Transform2D>(*m_camera);
             if (transf2d) {
                 //use transform 2d
                 data.position.x = transf2d->pos.x;
@@ -282,7 +282,7 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
         };
 
         //try to get the transform
-        WorldTransform* transf = m_world->get<WorldTransform>(m_entities[i]);
+        const WorldTransform* transf = m_world->read<WorldTransform>(m_entities[i]);
 
         //check if a transform was found
         if (transf) {
@@ -294,7 +294,7 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
             data.compressedQuaternion_k_w = *(reinterpret_cast<const GLGE::u32*>(&quat)+1);
         } else {
             //try to load a 2D transform
-            Transform2D* transf2d = m_world->get<Transform2D>(m_entities[i]);
+            const Transform2D* transf2d = m_world->read<Transform2D>(m_entities[i]);
 
             //if a 2D transform was found, use it
             if (transf2d) {
@@ -357,13 +357,13 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
         data.cullDistance = cullDistance;
 
         //fill in the position
-        WorldTransform* transf = m_world->get<WorldTransform>(obj);
+        const WorldTransform* transf = m_world->read<WorldTransform>(obj);
         if (transf) {
             //copy the position
             data.pos = transf->pos;
         } else {
             //try to use a transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(obj);
+            const Transform2D* transf2d = m_world->read<Transform2D>(obj);
             if (transf2d) {
                 //copy and upcast
                 data.pos = vec3(transf2d->pos, 0);
@@ -415,7 +415,7 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
         data.cullDistance = cullDistance;
 
         //fill in the position
-        WorldTransform* transf = m_world->get<WorldTransform>(obj);
+        const WorldTransform* transf = m_world->read<WorldTransform>(obj);
         if (transf) {
             //copy the position
             data.pos = transf->pos;
@@ -423,7 +423,7 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
             data.dir = vec3(0,0,-1) * transf->rot;
         } else {
             //try to use a transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(obj);
+            const Transform2D* transf2d = m_world->read<Transform2D>(obj);
             if (transf2d) {
                 //copy and upcast
                 data.pos = vec3(transf2d->pos, 0);
@@ -460,13 +460,13 @@ void GLGE::Graphic::Backend::Graphic::OpenGL::Renderer::update() {
         data.intensity = light->intensity;
 
         //fill in the position
-        WorldTransform* transf = m_world->get<WorldTransform>(obj);
+        const WorldTransform* transf = m_world->read<WorldTransform>(obj);
         if (transf) {
             //compute the direction vector
             data.dir = vec3(0,1,0) * transf->rot;
         } else {
             //try to use a transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(obj);
+            const Transform2D* transf2d = m_world->read<Transform2D>(obj);
             if (transf2d) {
                 //store the direction vector
                 data.dir = vec3(0,1,0) * Quaternion(vec3(0,0,transf2d->angle));
@@ -247,7 +247,7 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
         data.projection[1][1] *= -1.f;
 
         //get the position (this can be Transform, Transform2D or none)
-        WorldTransform* transf = m_world->get<WorldTransform>(*m_camera);
+        const WorldTransform* transf = m_world->read<WorldTransform>(*m_camera);
 
         if (transf) {
             //transform in use
@@ -264,7 +264,7 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
             data.compressedQuaternion_k_w = *(reinterpret_cast<GLGE::u32*>(&quat)+1);
         } else {
             //check transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(*m_camera);
+            const Transform2D* transf2d = m_world->read<Transform2D>(*m_camera);
             if (transf2d) {
                 //use transform 2d
                 data.position.x = transf2d->pos.x;
@@ -306,7 +306,7 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
         };
 
         //try to get the transform
-        WorldTransform* transf = m_world->get<WorldTransform>(m_entities[i]);
+        const WorldTransform* transf = m_world->read<WorldTransform>(m_entities[i]);
 
         //check if a transform was found
         if (transf) {
@@ -318,7 +318,7 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
             data.compressedQuaternion_k_w = *(reinterpret_cast<const GLGE::u32*>(&quat)+1);
         } else {
             //try to load a 2D transform
-            Transform2D* transf2d = m_world->get<Transform2D>(m_entities[i]);
+            const Transform2D* transf2d = m_world->read<Transform2D>(m_entities[i]);
 
             //if a 2D transform was found, use it
             if (transf2d) {
@@ -381,13 +381,13 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
         data.cullDistance = cullDistance;
 
         //fill in the position
-        WorldTransform* transf = m_world->get<WorldTransform>(obj);
+        const WorldTransform* transf = m_world->read<WorldTransform>(obj);
         if (transf) {
             //copy the position
             data.pos = transf->pos;
         } else {
             //try to use a transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(obj);
+            const Transform2D* transf2d = m_world->read<Transform2D>(obj);
             if (transf2d) {
                 //copy and upcast
                 data.pos = vec3(transf2d->pos, 0);
@@ -439,7 +439,7 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
         data.cullDistance = cullDistance;
 
         //fill in the position
-        WorldTransform* transf = m_world->get<WorldTransform>(obj);
+        const WorldTransform* transf = m_world->read<WorldTransform>(obj);
         if (transf) {
             //copy the position
             data.pos = transf->pos;
@@ -447,7 +447,7 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
             data.dir = vec3(0,0,-1) * transf->rot;
         } else {
             //try to use a transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(obj);
+            const Transform2D* transf2d = m_world->read<Transform2D>(obj);
             if (transf2d) {
                 //copy and upcast
                 data.pos = vec3(transf2d->pos, 0);
@@ -484,13 +484,13 @@ void GLGE::Graphic::Backend::Graphic::Vulkan::Renderer::update() {
         data.intensity = light->intensity;
 
         //fill in the position
-        WorldTransform* transf = m_world->get<WorldTransform>(obj);
+        const WorldTransform* transf = m_world->read<WorldTransform>(obj);
         if (transf) {
             //compute the direction vector
             data.dir = vec3(0,1,0) * transf->rot;
         } else {
             //try to use a transform 2D
-            Transform2D* transf2d = m_world->get<Transform2D>(obj);
+            const Transform2D* transf2d = m_world->read<Transform2D>(obj);
             if (transf2d) {
                 //store the direction vector
                 data.dir = vec3(0,1,0) * Quaternion(vec3(0,0,transf2d->angle));
@@ -13,6 +13,10 @@
 
 //include exceptions
 #include "Core/Exception.h"
+//add the job system for parallel conversions
+#define TINY_JOBS_NO_FIBERS
+#define TINY_JOBS_NO_LOCKFREE
+#include "Core/dependencies/TinyJobs.h"
 
 //use the graphic namespace
 using namespace GLGE::Graphic;
@@ -652,6 +656,46 @@ ImageCPU& ImageCPU::operator=(ImageCPU&& other) {
     return *this;
 }
 
+/**
+ * @brief create an empty image with the size of another image and a different format
+ * 
+ * @param size the size of the image
+ * @param format the format of the new image
+ * @param bytesPerPixel set to the amount of bytes a single pixel of the new image uses
+ * @return `u8*` the allocated pixel data
+ */
+static GLGE::u8* allocateConverted(const GLGE::uvec2& size, const PixelFormat& format, GLGE::u64& bytesPerPixel) {
+    bytesPerPixel = std::ceil((format.r_Bitcount + format.g_Bitcount + format.b_Bitcount + format.a_Bitcount) / 8.);
+    return new GLGE::u8[bytesPerPixel * size.x * size.y];
+}
+
+/**
+ * @brief convert a range of pixels to another format
+ * 
+ * @param from the pixel data of the source image
+ * @param fromFormat the format of the source image
+ * @param fromBytes the amount of bytes a source pixel uses
+ * @param to the pixel data of the target image
+ * @param toFormat the format of the target image
+ * @param toBytes the amount of bytes a target pixel uses
+ * @param start the first pixel to convert
+ * @param end the pixel behind the last one to convert
+ */
+static void convertPixels(const GLGE::u8* from, const PixelFormat& fromFormat, size_t fromBytes, GLGE::u8* to, const PixelFormat& toFormat, size_t toBytes, 
+                          size_t start, size_t end) {
+    from += start * fromBytes;
+    to += start * toBytes;
+    for (size_t i = start; i < end; ++i) {
+        //convert the pixel to the correct color space
+        GeneralColor col = convertPixelLayout(from, fromFormat, toFormat);
+        //write the color
+        memcpy(to, &col.blob, toBytes);
+        //advance the iterators
+        from += fromBytes;
+        to += toBytes;
+    }
+}
+
 ImageCPU ImageCPU::toFormat(const PixelFormat& format) {
     GLGE_PROFILER_SCOPE_NAMED("GLGE::Graphic::ImageCPU::toFormat")
 
@@ -663,30 +707,34 @@ ImageCPU ImageCPU::toFormat(const PixelFormat& format) {
 
     //create the output image
     ImageCPU out;
-    //copy over the size, format and bytes per pixel
+    //copy over the size and format
     out.m_size = m_size;
     out.m_format = format;
-    out.m_bytesPerPixel = std::ceil((format.r_Bitcount + format.g_Bitcount + format.b_Bitcount + format.a_Bitcount) / 8.);
-    //compute the size of the data
-    size_t s = out.m_bytesPerPixel * m_size.x * m_size.y;
-    //allocate the image buffer
-    out.m_data = new u8[s];
-    
-    //compute the amount of pixels to write
-    size_t todo = m_size.x * m_size.y;
-    //store iteration pointers
-    u8* from = m_data;
-    u8* to = out.m_data;
+    out.m_data = allocateConverted(m_size, format, out.m_bytesPerPixel);
     //iterate over all pixels and copy them over with the correct format
-    for (size_t i = 0; i < todo; ++i) {
-        //convert the pixel to the correct color space
-        GeneralColor col = convertPixelLayout(from, m_format, format);
-        //write the color
-        memcpy(to, &col.blob, out.m_bytesPerPixel);
-        //advance the iterators
-        from += m_bytesPerPixel;
-        to += out.m_bytesPerPixel;
-    }
+    convertPixels(m_data, m_format, m_bytesPerPixel, out.m_data, format, out.m_bytesPerPixel, 0, size_t(m_size.x) * m_size.y);
+
+    //return the finalized image
+    return out;
+}
+
+ImageCPU ImageCPU::toFormat(const PixelFormat& format, Tiny::Jobs::Employer& employer) {
+    GLGE_PROFILER_SCOPE_NAMED("GLGE::Graphic::ImageCPU::toFormat")
+
+    //in debug sanity check the format
+    #if GLGE_DEBUG
+    if ((m_format.r_Bitcount + m_format.g_Bitcount + m_format.b_Bitcount + m_format.a_Bitcount) % 8 != 0)
+    {throw GLGE::Exception("Tried to create a CPU Image using an invalid format", "GLGE::Graphic::ImageCPU::ImageCPU");}
+    #endif
+
+    //create the output image
+    ImageCPU out;
+    out.m_size = m_size;
+    out.m_format = format;
+    out.m_data = allocateConverted(m_size, format, out.m_bytesPerPixel);
+    //every pixel is independent, so the image is split into chunks of a few rows
+    employer.parallel_for(0, size_t(m_size.x) * m_size.y, std::max<size_t>(4096, m_size.x), [&](size_t start, size_t end) 
+    {convertPixels(m_data, m_format, m_bytesPerPixel, out.m_data, format, out.m_bytesPerPixel, start, end);});
 
     //return the finalized image
     return out;
@@ -142,7 +142,7 @@ void GLGE::Physic::Backend::Bullet::World::update() {
                 .scale = vec3(1.f)
             };
             if(node.parent != Tiny::ECS::Entity::getInvalid()) {
-                if(auto* pWorld = m_world->get<WorldTransform>(node.parent))
+                if(auto* pWorld = m_world->read<WorldTransform>(node.parent))
                 {parentWorld = *pWorld;}
             }
 
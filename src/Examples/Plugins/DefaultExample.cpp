@@ -150,6 +150,8 @@ unsigned char defaultExample(const char* graphicBackendName, const char* videoBa
     GLGE::Graphic::RenderTarget HDR_MultiSampleTarget(&multiSample_fbuff);
 
     GLGE::World world("Scene 1");
+    //only re-computes the world transforms of objects that moved
+    GLGE::System::TransformPropagator transforms;
     GLGE::Object camera = world.create<GLGE::Graphic::Component::Camera, GLGE::Transform, FirstPersonController>(
         "Camera", 
         GLGE::Graphic::Component::Camera{90,0.1,1000, GLGE::vec3(0,0,0)}, 
@@ -291,7 +293,7 @@ unsigned char defaultExample(const char* graphicBackendName, const char* videoBa
         world.get<GLGE::Transform>(suzanne2)->pos.y = 1.f - glm::sin(std::chrono::system_clock::now().time_since_epoch().count() * 1E-9);
         world.get<GLGE::Graphic::Component::PointLight>(light)->intensity = (glm::sin(std::chrono::system_clock::now().time_since_epoch().count() * 1E-9 / 2.333) * 0.5 + 0.5) * 50;
         //bake the transforms
-        GLGE::System::BakeTransforms(world);
+        transforms.update(world);
         //update the renderer (update transformation state)
         renderer.update();
 
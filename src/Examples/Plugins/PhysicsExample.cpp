@@ -114,6 +114,8 @@ GLGE::u8 physicExample(const char *graphicBackendName, const char *videoBackendN
 
     //create the new ECS world
     GLGE::World world("World");
+    //only re-computes the world transforms of objects that moved
+    GLGE::System::TransformPropagator transforms;
 
     GLGE::Physic::SphereCollider sphere = 0.5;
     GLGE::Physic::BoxCollider    plane = GLGE::vec3{200, 10, 200};
@@ -201,7 +203,7 @@ GLGE::u8 physicExample(const char *graphicBackendName, const char *videoBackendN
     );
 
     //update transforms
-    GLGE::System::BakeTransforms(world);
+    transforms.update(world);
     //define how a frame is structured
     GLGE::Graphic::RenderPipeline pipe = GLGE::Graphic::RenderPipeline::create(&win,
         std::pair{"Clear", GLGE::Graphic::Command(GLGE::Graphic::COMMAND_CLEAR, target, GLGE::u8(0), GLGE::vec4(0.5,0.5,0.5,1), 1.f, GLGE::u32(0))},
@@ -223,7 +225,7 @@ GLGE::u8 physicExample(const char *graphicBackendName, const char *videoBackendN
         //camera movement
         world.each<GLGE::Transform, GLGE::Graphic::Component::Camera, FirstPersonController>(updateFirstPersonController);
         //update transforms
-        GLGE::System::BakeTransforms(world);
+        transforms.update(world);
         //update physics
         physicsWorld.update();
         //update the renderer
@@ -16,6 +16,17 @@
 
 //add stringstreams
 #include <sstream>
+//add timing for the benchmarks
+#include <chrono>
+#include <ctime>
+//add deques
+#include <deque>
+//add std::plus for reductions
+#include <functional>
+//add file streams for the asset tests
+#include <fstream>
+//add the manifest of the asset cooker
+#include "../../Tools/CookManifest.h"
 
 static void assertHelper(const std::string& expected, const std::string& actual, bool passed, const TestFunctions* fn) {
     TestAssertion ass;
@@ -25,6 +36,26 @@ static void assertHelper(const std::string& expected, const std::string& actual,
     (*(fn->assertion))(&ass);
 }
 
+//a coroutine that does not suspend at all
+static GLGE::Tiny::Jobs::Coroutine<uint64_t> doubleValue(uint64_t v)
+{co_return v * 2;}
+
+//a coroutine that waits for a task, a nested coroutine and a job
+static GLGE::Tiny::Jobs::Coroutine<uint64_t> loadValue(GLGE::Tiny::Jobs::Employer& emp, GLGE::Tiny::Jobs::Job& job, std::atomic_uint64_t& runs) {
+    uint64_t read = (co_await emp.async([]() {return uint64_t(20);})).get<uint64_t>();
+    uint64_t decoded = co_await doubleValue(read + 1);
+    co_await job;
+    co_return decoded + runs.load(std::memory_order_acquire);
+}
+
+//a coroutine that catches the failure of a nested coroutine
+static GLGE::Tiny::Jobs::Coroutine<bool> catchFailure() {
+    try {
+        co_await []() -> GLGE::Tiny::Jobs::Coroutine<> {throw std::runtime_error("expected failure"); co_return;}();
+    } catch (const std::runtime_error&) {co_return true;}
+    co_return false;
+}
+
 void jobSystemTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
     //initialize as controlled fail
     report->result = TEST_CONTROLLED_FAIL;
@@ -128,6 +159,213 @@ void jobSystemTest(const TestContext* ctx, TestReport* report, const TestFunctio
         );
     }
 
+    msg.msg = "[INFO] Testing if nested parallel loops and reductions work";
+    (*(fn->log))(&msg);
+
+    //every inner loop sums its own indices, the outer reduction adds the inner sums
+    constexpr uint64_t outer = 64;
+    constexpr uint64_t inner = 1000;
+    uint64_t sum = emp.parallel_reduce(0, outer, 1, uint64_t(0), [&](size_t) {
+        return emp.parallel_reduce(0, inner, 16, uint64_t(0), [](size_t i) {return uint64_t(i);}, std::plus<uint64_t>());
+    }, std::plus<uint64_t>());
+    assertHelper(
+        "Expected the sum of all nested loops to be " + std::to_string(outer * (inner * (inner - 1) / 2)),
+        "The sum was " + std::to_string(sum),
+        sum == outer * (inner * (inner - 1) / 2), fn
+    );
+
+    msg.msg = "[INFO] Testing if continuations work";
+    (*(fn->log))(&msg);
+
+    //a small pipeline: every stage consumes the result of the previous one without waiting
+    GLGE::Tiny::Jobs::SharedTask read = emp.async([]() {return uint64_t(21);});
+    GLGE::Tiny::Jobs::SharedTask decode = emp.then(read, [](GLGE::Tiny::Jobs::Future& in) {return in.get<uint64_t>() * 2;});
+    //join the pipeline with a job, the continuation runs once both are done
+    std::atomic_uint64_t jobRuns = 0;
+    GLGE::Tiny::Jobs::Task first([&jobRuns]() {jobRuns.fetch_add(1, std::memory_order_acq_rel);});
+    GLGE::Tiny::Jobs::Task second([&jobRuns]() {jobRuns.fetch_add(1, std::memory_order_acq_rel);});
+    GLGE::Tiny::Jobs::Job pipelineJob;
+    auto firstId = pipelineJob.add(first, 0);
+    pipelineJob.add(second, 0, {firstId});
+    pipelineJob.finalize();
+    GLGE::Tiny::Jobs::SharedTask joined = emp.when_all({decode, emp.when_done(pipelineJob)});
+    GLGE::Tiny::Jobs::SharedTask upload = emp.then(joined, [&]() {return decode.result().get<uint64_t>() + jobRuns.load(std::memory_order_acquire);});
+    emp.add(&pipelineJob);
+    uint64_t uploaded = upload.get<uint64_t>();
+    assertHelper(
+        "Expected the pipeline to produce 44",
+        "The pipeline produced " + std::to_string(uploaded),
+        uploaded == 44, fn
+    );
+
+    //the first finished input wins, failures skip the continuation and are passed on
+    std::atomic_bool gate = false;
+    GLGE::Tiny::Jobs::SharedTask slow = emp.async([&gate]() {while (!gate.load(std::memory_order_acquire)) {std::this_thread::yield();}});
+    size_t winner = emp.when_any({slow, read}).get<size_t>();
+    gate.store(true, std::memory_order_release);
+    std::atomic_bool skipped = true;
+    GLGE::Tiny::Jobs::SharedTask failed = emp.then(emp.async([]() {throw std::runtime_error("expected failure");}), [&skipped]() {skipped = false;});
+    failed.await();
+    assertHelper(
+        "Expected the second input to win and the failure to skip the continuation",
+        "Input " + std::to_string(winner) + " won, the continuation " + (skipped ? "was skipped" : "ran") + (failed.failed() ? " and the failure was passed on" : " and the failure was lost"),
+        (winner == 1) && skipped && failed.failed(), fn
+    );
+    slow.await();
+
+    msg.msg = "[INFO] Testing if coroutines work";
+    (*(fn->log))(&msg);
+
+    //the coroutine suspends on the job before it is queued
+    std::atomic_uint64_t coRuns = 0;
+    GLGE::Tiny::Jobs::Task coFirst([&coRuns]() {coRuns.fetch_add(1, std::memory_order_acq_rel);});
+    GLGE::Tiny::Jobs::Task coSecond([&coRuns]() {coRuns.fetch_add(1, std::memory_order_acq_rel);});
+    GLGE::Tiny::Jobs::Job coJob;
+    auto coFirstId = coJob.add(coFirst, 0);
+    coJob.add(coSecond, 0, {coFirstId});
+    coJob.finalize();
+    GLGE::Tiny::Jobs::SharedTask loaded = emp.spawn(loadValue(emp, coJob, coRuns));
+    emp.add(&coJob);
+    uint64_t loadedValue = loaded.get<uint64_t>();
+    bool caught = emp.spawn(catchFailure()).get<bool>();
+    assertHelper(
+        "Expected the coroutine to produce 44 and the nested failure to be caught",
+        "The coroutine produced " + std::to_string(loadedValue) + (caught ? " and the failure was caught" : " and the failure was lost"),
+        (loadedValue == 44) && caught, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//burn some time without the compiler removing the work
+static uint64_t spinWork(uint64_t iterations) {
+    volatile uint64_t acc = 0;
+    for (uint64_t i = 0; i < iterations; ++i) {acc = acc + i;}
+    return acc;
+}
+
+void jobStealingBenchmark(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    std::string text;
+    GLGE::Tiny::Jobs::Employer emp = 4;
+
+    msg.msg = "[INFO] Benchmarking a bulk task where a few tasks are a lot more expensive than the others";
+    (*(fn->log))(&msg);
+
+    //all expensive tasks end up in the queue of the first worker, the others have to steal them
+    constexpr size_t bulkCount = 4096;
+    std::atomic_uint64_t count = 0;
+    GLGE::Tiny::Jobs::BulkTask skewed(bulkCount, [](size_t i, std::atomic_uint64_t& count) {
+        spinWork((i < bulkCount / 16) ? 20000 : 200);
+        count.fetch_add(1, std::memory_order_acq_rel);
+    }, std::ref(count));
+    auto start = std::chrono::steady_clock::now();
+    emp.add_bulk(skewed);
+    emp.waitIdle();
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    text = "[INFO] Skewed bulk task took " + std::to_string(ms) + "ms";
+    msg.msg = text.c_str();
+    (*(fn->log))(&msg);
+    assertHelper(
+        "Expected every task of the skewed bulk task to run once",
+        (count.load(std::memory_order_acquire) == bulkCount) ? "Every task ran once" : "The count does not match the task count",
+        count.load(std::memory_order_acquire) == bulkCount, fn
+    );
+
+    msg.msg = "[INFO] Benchmarking a job where every task releases a lot of tasks";
+    (*(fn->log))(&msg);
+
+    //a tree of cheap tasks that release the expensive leaves. The leaves stay with the worker that released them, 
+    //the others have to steal them. 
+    constexpr size_t fanOut = GLGE::Tiny::Jobs::Job::MAX_DIRECT_CHILD_COUNT;
+    constexpr size_t taskCount = 1 + fanOut + fanOut * fanOut;
+    count = 0;
+    //tasks can't be moved, so they are stored in a deque
+    std::deque<GLGE::Tiny::Jobs::Task> tree;
+    GLGE::Tiny::Jobs::Job job;
+    tree.emplace_back([](std::atomic_uint64_t& count) {count.fetch_add(1, std::memory_order_acq_rel);}, std::ref(count));
+    auto rootId = job.add(tree.back(), 0);
+    for (size_t i = 0; i < fanOut; ++i) {
+        tree.emplace_back([](std::atomic_uint64_t& count) {count.fetch_add(1, std::memory_order_acq_rel);}, std::ref(count));
+        auto branchId = job.add(tree.back(), 0, {rootId});
+        for (size_t j = 0; j < fanOut; ++j) {
+            tree.emplace_back([](std::atomic_uint64_t& count) {
+                spinWork(20000);
+                count.fetch_add(1, std::memory_order_acq_rel);
+            }, std::ref(count));
+            job.add(tree.back(), 0, {branchId});
+        }
+    }
+    job.finalize();
+    start = std::chrono::steady_clock::now();
+    emp.add(&job);
+    emp.waitIdle();
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    text = "[INFO] Task tree took " + std::to_string(ms) + "ms";
+    msg.msg = text.c_str();
+    (*(fn->log))(&msg);
+    assertHelper(
+        "Expected every task of the tree to run once",
+        (count.load(std::memory_order_acquire) == taskCount) ? "Every task ran once" : "The count does not match the task count",
+        count.load(std::memory_order_acquire) == taskCount, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void jobWaitPolicyBenchmark(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    std::string text;
+    const std::pair<const char*, GLGE::Tiny::Jobs::WaitPolicy> policies[] = {
+        {"latency", GLGE::Tiny::Jobs::WaitPolicy::latency()},
+        {"default", GLGE::Tiny::Jobs::WaitPolicy()},
+        {"power", GLGE::Tiny::Jobs::WaitPolicy::power()}
+    };
+    for (const auto& [name, policy] : policies) {
+        text = std::string("[INFO] Benchmarking the ") + name + " wait policy";
+        msg.msg = text.c_str();
+        (*(fn->log))(&msg);
+
+        GLGE::Tiny::Jobs::Employer emp(4, true, 0, policy);
+
+        //latency: the time from queuing a single task to the task running, the workers idle in between
+        constexpr size_t rounds = 200;
+        double latency = 0;
+        size_t ran = 0;
+        for (size_t i = 0; i < rounds; ++i) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            std::chrono::steady_clock::time_point started;
+            GLGE::Tiny::Jobs::Task task([&]() {started = std::chrono::steady_clock::now(); ++ran;});
+            GLGE::Tiny::Jobs::Job::TaskNode node(&task);
+            auto queued = std::chrono::steady_clock::now();
+            emp.add(&node);
+            emp.waitIdle();
+            latency += std::chrono::duration<double, std::micro>(started - queued).count();
+        }
+
+        //power: the CPU time the process uses while the workers have nothing to do
+        std::clock_t cpuStart = std::clock();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        double idleCpu = 1000.0 * double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+        text = "[INFO] Average wake up latency: " + std::to_string(latency / rounds) + "us, CPU time while idle for 100ms: " + std::to_string(idleCpu) + "ms";
+        msg.msg = text.c_str();
+        (*(fn->log))(&msg);
+        assertHelper(
+            "Expected every queued task to run once",
+            (ran == rounds) ? "Every task ran once" : "The amount of runs does not match the amount of tasks",
+            ran == rounds, fn
+        );
+    }
+
     //success
     report->result = TEST_SUCCESS;
 }
@@ -462,96 +700,2237 @@ void taskTest(const TestContext* ctx, TestReport* report, const TestFunctions* f
     report->result = TEST_SUCCESS;
 }
 
-std::vector<Test> tests {
-    Test{
-        .header = {
-            .sType = TEST_TEST,
-            .pNext = nullptr
-        },
-        .entry = {
-            .header = {
-                .sType = TEST_ENTRY,
-                .pNext = nullptr
-            },
-            .name = "Job system test",
-            .tags = "job async core",
-            .description = "Test the functionality of the job system",
-            .timeout = uint64_t(1E4),
-            .requirements = TEST_REQUIREMENT_ASYNC_BIT
-        },
-        .invoker = &jobSystemTest
-    },
-    Test{
-        .header = {
-            .sType = TEST_TEST,
-            .pNext = nullptr
-        },
-        .entry = {
-            .header = {
-                .sType = TEST_ENTRY,
-                .pNext = nullptr
-            },
-            .name = "Intrinsic reference counting test",
-            .tags = "reference_counting core",
-            .description = "Test the functionality of the intrinsic reference counting system",
-            .timeout = uint64_t(1E4),
-            .requirements = 0
-        },
-        .invoker = &referenceCountingTest
-    },
-    Test{
-        .header = {
-            .sType = TEST_TEST,
-            .pNext = nullptr
-        },
-        .entry = {
-            .header = {
-                .sType = TEST_ENTRY,
-                .pNext = nullptr
-            },
-            .name = "Event system test",
-            .tags = "events core",
-            .description = "Test that the event system works",
-            .timeout = uint64_t(1E4),
-            .requirements = 0
-        },
-        .invoker = &eventSystemTest
-    },
-    Test{
-        .header = {
-            .sType = TEST_TEST,
-            .pNext = nullptr
-        },
-        .entry = {
-            .header = {
-                .sType = TEST_ENTRY,
-                .pNext = nullptr
-            },
-            .name = "Keyboard and mouse test",
-            .tags = "keyboard mouse core",
-            .description = "Test that the abstract keyboard and mouse classes work",
-            .timeout = uint64_t(1E4),
-            .requirements = 0
-        },
-        .invoker = &ioTest
-    },
-    Test{
-        .header = {
-            .sType = TEST_TEST,
-            .pNext = nullptr
-        },
-        .entry = {
-            .header = {
-                .sType = TEST_ENTRY,
-                .pNext = nullptr
-            },
-            .name = "Task queue test",
-            .tags = "tasks async core",
-            .description = "Test if tasks can be executed through task queues",
-            .timeout = uint64_t(1E4),
-            .requirements = TEST_REQUIREMENT_ASYNC_BIT
-        },
-        .invoker = &taskTest
+void derivedDataCacheTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    //use an own directory, so the cache of other programs is left alone
+    std::filesystem::path oldDirectory = GLGE::DerivedDataCache::getDirectory();
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "GLGE_derived_data_cache_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    GLGE::DerivedDataCache::setDirectory(root / "cache");
+    GLGE::DerivedDataCache::clear();
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if the keys only depend on the content and the settings";
+    (*(fn->log))(&msg);
+
+    //two files with the same content at different paths and one with different content
+    auto writeFile = [](const std::filesystem::path& path, const std::string& content) {
+        std::ofstream f(path, std::ofstream::binary);
+        f << content;
+    };
+    writeFile(root / "a.obj", "v 0 0 0");
+    writeFile(root / "b.obj", "v 0 0 0");
+    writeFile(root / "c.obj", "v 1 0 0");
+    GLGE::u64 keyA = GLGE::DerivedDataCache::computeKey(root / "a.obj", "Test", 0, 1);
+    GLGE::u64 keyB = GLGE::DerivedDataCache::computeKey(root / "b.obj", "Test", 0, 1);
+    GLGE::u64 keyC = GLGE::DerivedDataCache::computeKey(root / "c.obj", "Test", 0, 1);
+    GLGE::u64 keySettings = GLGE::DerivedDataCache::computeKey(root / "a.obj", "Test", 1, 1);
+    GLGE::u64 keyVersion = GLGE::DerivedDataCache::computeKey(root / "a.obj", "Test", 0, 2);
+    assertHelper(
+        "Expected equal content to share a key and other content, settings or versions to change it",
+        std::string((keyA == keyB) ? "Equal content shared a key" : "Equal content had different keys") + 
+        (((keyA != keyC) && (keyA != keySettings) && (keyA != keyVersion)) ? ", all changes changed the key" : ", a change did not change the key"),
+        (keyA == keyB) && (keyA != keyC) && (keyA != keySettings) && (keyA != keyVersion), fn
+    );
+
+    msg.msg = "[INFO] Testing if stored data is fetched again";
+    (*(fn->log))(&msg);
+
+    std::vector<GLGE::u8> cooked = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<GLGE::u8> fetched;
+    GLGE::u64 hits = GLGE::DerivedDataCache::getHitCount();
+    bool missed = !GLGE::DerivedDataCache::fetch(keyA, fetched);
+    GLGE::DerivedDataCache::store(keyA, cooked);
+    bool hit = GLGE::DerivedDataCache::fetch(keyA, fetched);
+    assertHelper(
+        "Expected a miss before storing and a hit with the same data afterwards",
+        std::string(missed ? "Missed before storing" : "Hit before storing") + (hit ? ", hit afterwards" : ", missed afterwards") + 
+        ((fetched == cooked) ? " with the same data" : " with different data"),
+        missed && hit && (fetched == cooked) && (GLGE::DerivedDataCache::getHitCount() == hits + 1), fn
+    );
+
+    msg.msg = "[INFO] Testing if corrupted entries are treated as a miss";
+    (*(fn->log))(&msg);
+
+    //flip the last byte of the only entry
+    for (const auto& entry : std::filesystem::directory_iterator(root / "cache")) {
+        std::fstream f(entry.path(), std::fstream::binary | std::fstream::in | std::fstream::out | std::fstream::ate);
+        std::streamoff size = f.tellg();
+        f.seekg(size - 1);
+        char last = char(f.get());
+        f.seekp(size - 1);
+        f.put(char(last ^ 0xff));
+    }
+    fetched.clear();
+    bool corruptHit = GLGE::DerivedDataCache::fetch(keyA, fetched);
+    assertHelper(
+        "Expected a corrupted entry to miss without touching the output",
+        std::string(corruptHit ? "The corrupted entry was fetched" : "The corrupted entry missed") + (fetched.empty() ? "" : " and the output was changed"),
+        !corruptHit && fetched.empty(), fn
+    );
+
+    //clean up
+    GLGE::DerivedDataCache::setDirectory(oldDirectory);
+    std::filesystem::remove_all(root);
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//the dependencies of the assets of the dependency test, mapped from the path of the asset
+static std::unordered_map<std::string, std::vector<std::string>> s_testDependencies;
+//how long every test asset takes to load
+static std::chrono::milliseconds s_testLoadTime{0};
+
+//an asset that only loads its dependencies
+class DependencyTestAsset : public GLGE::Asset {
+public:
+    virtual GLGE::u64 load(GLGE::AssetManager*, const std::vector<GLGE::u8>&) override {return 0;}
+    virtual void store(std::vector<GLGE::u8>&) override {}
+    virtual void export_as(const std::filesystem::path&, GLGE::u32) override {}
+
+    virtual void import_from(GLGE::AssetManager* manager, const std::filesystem::path& file, GLGE::u32) override {
+        const std::vector<std::string>& deps = s_testDependencies[file.generic_string()];
+        //declare first, so the dependencies load while this asset "works"
+        for (const std::string& dep : deps) {manager->declareDependency<DependencyTestAsset>(dep);}
+        std::this_thread::sleep_for(s_testLoadTime);
+        for (const std::string& dep : deps) {manager->require<DependencyTestAsset>(dep);}
+    }
+};
+
+void assetDependencyTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    GLGE::Tiny::Jobs::Employer emp = 4;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if the dependency closure of an asset is loaded";
+    (*(fn->log))(&msg);
+
+    {
+        GLGE::AssetManager manager;
+        manager.setEmployer(&emp);
+        s_testDependencies = {{"root", {"a", "b"}}, {"a", {"c", "d"}}, {"b", {"d"}}, {"c", {}}, {"d", {}}};
+        s_testLoadTime = std::chrono::milliseconds(1);
+        bool valid = manager.loadWithDependencies<DependencyTestAsset>("root").isValid();
+        GLGE::AssetManager::DependencyReport deps = manager.getDependencyReport<DependencyTestAsset>("root");
+        assertHelper(
+            "Expected the root to load with a closure of 5 assets",
+            std::string(valid ? "The root loaded" : "The root did not load") + " with a closure of " + std::to_string(deps.assetCount) + " assets",
+            valid && (deps.assetCount == 5), fn
+        );
+
+        //queued loads may still be in flight when the prefetched assets are released
+        for (size_t i = 0; i < 100; ++i) {
+            manager.releasePrefetchedAssets();
+            manager.prefetch<DependencyTestAsset>("root");
+            valid &= manager.loadWithDependencies<DependencyTestAsset>("root").isValid();
+        }
+        emp.waitIdle();
+        assertHelper(
+            "Expected the root to load again after its prefetched assets where released",
+            valid ? "The root loaded every time" : "The root failed to load",
+            valid, fn
+        );
+    }
+
+    msg.msg = "[INFO] Testing if cyclic dependencies loaded by different threads are detected";
+    (*(fn->log))(&msg);
+
+    {
+        GLGE::AssetManager manager;
+        manager.setEmployer(&emp);
+        s_testDependencies = {{"A", {"B"}}, {"B", {"A"}}};
+        //both assets have to be loading at the same time
+        s_testLoadTime = std::chrono::milliseconds(50);
+        std::atomic_uint32_t failed = 0;
+        auto load = [&manager, &failed](const char* path) {
+            try {manager.loadWithDependencies<DependencyTestAsset>(path);}
+            catch (const GLGE::Exception&) {failed.fetch_add(1, std::memory_order_acq_rel);}
+        };
+        std::thread first(load, "A");
+        std::thread second(load, "B");
+        first.join();
+        second.join();
+        emp.waitIdle();
+        assertHelper(
+            "Expected both loads of the cycle to fail",
+            std::to_string(failed.load()) + " of the loads failed",
+            failed.load() == 2, fn
+        );
+    }
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//an asset that stores the path it was imported from
+class PayloadTestAsset : public GLGE::Asset {
+public:
+    virtual GLGE::u64 load(GLGE::AssetManager*, const std::vector<GLGE::u8>& data) override 
+    {payload.assign(data.begin(), data.end()); return data.size();}
+    virtual void store(std::vector<GLGE::u8>& data) override 
+    {data.insert(data.end(), payload.begin(), payload.end());}
+    virtual void export_as(const std::filesystem::path&, GLGE::u32) override {}
+    virtual void import_from(GLGE::AssetManager*, const std::filesystem::path& file, GLGE::u32) override 
+    {payload = file.generic_string();}
+
+    std::string payload;
+};
+
+void compoundAssetIndexTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if nested entries are found through the path index";
+    (*(fn->log))(&msg);
+
+    GLGE::AssetManager manager;
+    GLGE::AssetHandle<GLGE::CompoundAsset> root = manager.load<GLGE::CompoundAsset>(std::filesystem::path(""));
+    GLGE::AssetHandle<GLGE::CompoundAsset> models = manager.load<GLGE::CompoundAsset>(std::filesystem::path(""));
+    models.reference()->write<PayloadTestAsset>("truck", manager.load<PayloadTestAsset>("truck payload"));
+    root.reference()->write<GLGE::CompoundAsset>("models", models);
+    root.reference()->write<PayloadTestAsset>("readme", manager.load<PayloadTestAsset>("readme payload"));
+
+    GLGE::AssetHandle<PayloadTestAsset> truck = root.reference()->open<PayloadTestAsset>("models/truck");
+    GLGE::AssetHandle<PayloadTestAsset> readme = root.reference()->open<PayloadTestAsset>(GLGE::CompoundAsset::hashPath("readme"));
+    bool found = truck.isValid() && (truck.reference()->payload == "truck payload") && 
+                 readme.isValid() && (readme.reference()->payload == "readme payload");
+    assertHelper(
+        "Expected the nested and the top level entry to be opened by path and by hash",
+        found ? "Both entries where opened with their payload" : "An entry was not found or had the wrong payload",
+        found, fn
+    );
+
+    msg.msg = "[INFO] Testing if missing paths are not found and new entries are";
+    (*(fn->log))(&msg);
+
+    bool missing = !root.reference()->hasEntry("models/car") && !root.reference()->hasEntry("truck") && 
+                   !root.reference()->open<PayloadTestAsset>("models/car").isValid();
+    root.reference()->write<PayloadTestAsset>("license", manager.load<PayloadTestAsset>("license payload"));
+    bool added = root.reference()->hasEntry("license") && root.reference()->hasEntry(GLGE::CompoundAsset::hashPath("models/truck"));
+    assertHelper(
+        "Expected missing paths to be reported as missing and a new entry to be found",
+        std::string(missing ? "Missing paths where not found" : "A missing path was found") + (added ? ", the new entry was found" : ", the new entry was not found"),
+        missing && added, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void compoundAssetDependencyTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    GLGE::Tiny::Jobs::Employer emp = 4;
+
+    //write a pack with nested compound assets
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "GLGE_compound_dependency_test.gcmp";
+    {
+        GLGE::AssetManager manager;
+        GLGE::AssetHandle<GLGE::CompoundAsset> root = manager.load<GLGE::CompoundAsset>(std::filesystem::path(""));
+        GLGE::AssetHandle<GLGE::CompoundAsset> models = manager.load<GLGE::CompoundAsset>(std::filesystem::path(""));
+        GLGE::AssetHandle<GLGE::CompoundAsset> cars = manager.load<GLGE::CompoundAsset>(std::filesystem::path(""));
+        GLGE::AssetHandle<GLGE::CompoundAsset> textures = manager.load<GLGE::CompoundAsset>(std::filesystem::path(""));
+        cars.reference()->write<PayloadTestAsset>("truck", manager.load<PayloadTestAsset>("truck payload"));
+        models.reference()->write<GLGE::CompoundAsset>("cars", cars);
+        textures.reference()->write<PayloadTestAsset>("brick", manager.load<PayloadTestAsset>("brick payload"));
+        root.reference()->write<GLGE::CompoundAsset>("models", models);
+        root.reference()->write<GLGE::CompoundAsset>("textures", textures);
+        root.reference()->write<PayloadTestAsset>("readme", manager.load<PayloadTestAsset>("readme payload"));
+        root.reference()->export_as(file, GLGE::CompoundAsset::GLGE);
+    }
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if nested compound assets are part of the dependency closure";
+    (*(fn->log))(&msg);
+
+    {
+        GLGE::AssetManager manager;
+        manager.setEmployer(&emp);
+        GLGE::AssetHandle<GLGE::CompoundAsset> pack = manager.loadWithDependencies<GLGE::CompoundAsset>(file);
+        GLGE::AssetManager::DependencyReport deps = manager.getDependencyReport<GLGE::CompoundAsset>(file);
+        GLGE::AssetHandle<PayloadTestAsset> truck = pack.reference()->open<PayloadTestAsset>("models/cars/truck");
+        GLGE::AssetHandle<PayloadTestAsset> brick = pack.reference()->open<PayloadTestAsset>(GLGE::CompoundAsset::hashPath("textures/brick"));
+        bool opened = truck.isValid() && (truck.reference()->payload == "truck payload") && 
+                      brick.isValid() && (brick.reference()->payload == "brick payload");
+        assertHelper(
+            "Expected a closure of 4 assets and the nested entries to be opened",
+            "A closure of " + std::to_string(deps.assetCount) + " assets" + (opened ? " and the nested entries where opened" : " and a nested entry was not opened"),
+            (deps.assetCount == 4) && opened, fn
+        );
+
+        //a prefetch of the recorded closure must not run the nested assets before the pack declared their data
+        bool valid = true;
+        for (size_t i = 0; i < 20; ++i) {
+            manager.releasePrefetchedAssets();
+            manager.prefetch<GLGE::CompoundAsset>(file);
+            GLGE::AssetHandle<GLGE::CompoundAsset> again = manager.loadWithDependencies<GLGE::CompoundAsset>(file);
+            valid &= again.isValid() && again.reference()->open<PayloadTestAsset>("models/cars/truck").isValid();
+        }
+        emp.waitIdle();
+        assertHelper(
+            "Expected the pack to load again after its prefetched assets where released",
+            valid ? "The pack loaded every time" : "The pack failed to load",
+            valid, fn
+        );
+    }
+
+    msg.msg = "[INFO] Testing if an asset manager can be destroyed while prefetches are in flight";
+    (*(fn->log))(&msg);
+
+    {
+        //the manager has to wait for the queued loads, as they point into it
+        size_t destroyed = 0;
+        for (size_t i = 0; i < 50; ++i) {
+            {
+                GLGE::AssetManager manager;
+                manager.setEmployer(&emp);
+                manager.prefetch<GLGE::CompoundAsset>(file);
+            }
+            ++destroyed;
+        }
+        emp.waitIdle();
+        assertHelper("50 managers where destroyed", std::to_string(destroyed) + " managers where destroyed", destroyed == 50, fn);
+    }
+
+    std::filesystem::remove(file);
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//a trivially copyable component used to test raw component serialization
+struct TestHealth {
+    GLGE::u32 value = 0;
+};
+
+//fill a world with a small hierarchy and a batch of objects that share their components
+static void fillTestWorld(GLGE::World& world, size_t crates) {
+    GLGE::WorldAsset::getComponentRegistry().addType<TestHealth>();
+
+    GLGE::Object player = world.create<GLGE::Transform, TestHealth>("player", GLGE::Transform(GLGE::vec3(1,2,3)), TestHealth{7});
+    world.create<GLGE::Transform>("weapon", player, GLGE::Transform(GLGE::vec3(0,1,0)));
+    world.create<GLGE::Transform2D>("sun", GLGE::Transform2D(GLGE::vec2(5,5)));
+    GLGE::Object stack = world.create<GLGE::Transform>("stack", GLGE::Transform(GLGE::vec3(0,0,-1)));
+    for (size_t i = 0; i < crates; ++i)
+    {world.create<GLGE::Transform>("crate_" + std::to_string(i), stack, GLGE::Transform(GLGE::vec3(float(i),0,0)));}
+}
+
+//find the first object with a specific name
+static GLGE::Object findTestObject(GLGE::World& world, const std::string& name) {
+    GLGE::Object found;
+    world.each<GLGE::Component::Name>([&](const GLGE::Tiny::ECS::Entity& ent, const GLGE::Component::Name&) {
+        if (!found && world.getObjectName(ent) == name) {found = GLGE::Object(ent);}
+    });
+    return found;
+}
+
+//check if a world contains exactly what `fillTestWorld` created
+static bool matchesTestWorld(GLGE::World& world, size_t crates) {
+    //store the x position and the parent name of every transformed object
+    std::unordered_map<std::string, std::pair<float, std::string>> found;
+    world.each<GLGE::Transform>([&](const GLGE::Tiny::ECS::Entity& ent, const GLGE::Transform& transform) {
+        found[world.getObjectName(ent)] = {transform.pos.x, world.getObjectName(world.getParent(ent))};
+    });
+    if (found.size() != crates + 3) {return false;}
+
+    GLGE::Object player = findTestObject(world, "player");
+    GLGE::Object sun = findTestObject(world, "sun");
+    if (!player || !sun) {return false;}
+    const GLGE::Transform* transform = world.read<GLGE::Transform>(player);
+    const TestHealth* health = world.read<TestHealth>(player);
+    const GLGE::Transform2D* transform2D = world.read<GLGE::Transform2D>(sun);
+    if (!transform || transform->pos.y != 2 || transform->pos.z != 3 || !health || health->value != 7) {return false;}
+    if (!transform2D || transform2D->pos.x != 5 || world.getParent(sun).valid()) {return false;}
+    if (found["player"].second != world.getName() || found["weapon"].second != "player" || found["stack"].first != 0) {return false;}
+
+    for (size_t i = 0; i < crates; ++i) {
+        auto it = found.find("crate_" + std::to_string(i));
+        if (it == found.end() || it->second.first != float(i) || it->second.second != "stack") {return false;}
+    }
+    return true;
+}
+
+void worldBulkLoadTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if a stored world is loaded with all objects, components and parents";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("World bulk load test", GLGE::Version(0,1,0));
+
+    GLGE::WorldAsset source;
+    fillTestWorld(source.world(), 100);
+    std::vector<GLGE::u8> blob;
+    source.store(blob);
+
+    GLGE::WorldAsset loaded;
+    loaded.load(nullptr, blob);
+    bool matches = matchesTestWorld(loaded.world(), 100);
+    assertHelper(
+        "Expected the loaded world to match the stored world",
+        matches ? "The loaded world matched" : "The loaded world differed from the stored world",
+        matches, fn
+    );
+
+    msg.msg = "[INFO] Testing if a loaded world can be stored and loaded again";
+    (*(fn->log))(&msg);
+
+    std::vector<GLGE::u8> second;
+    loaded.store(second);
+    GLGE::WorldAsset reloaded;
+    reloaded.load(nullptr, second);
+    matches = matchesTestWorld(reloaded.world(), 100);
+    assertHelper(
+        "Expected the world to survive a second round trip",
+        matches ? "The reloaded world matched" : "The reloaded world differed from the stored world",
+        matches, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//get the names of all children of an object in sibling order
+static std::vector<std::string> testChildNames(GLGE::World& world, GLGE::Object parent) {
+    std::vector<std::string> names;
+    for (GLGE::Object child : world.children(parent))
+    {names.push_back(world.getObjectName(child));}
+    return names;
+}
+
+void worldColumnarTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if a world stored in the columnar format is loaded with all objects, components and parents";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("World columnar test", GLGE::Version(0,1,0));
+
+    GLGE::WorldAsset source;
+    fillTestWorld(source.world(), 100);
+    std::vector<GLGE::u8> blob;
+    source.storeColumnar(blob);
+    bool magic = (blob.size() >= 4) && (blob[0] == 'W') && (blob[1] == '_') && (blob[2] == 'C') && (blob[3] == 'L');
+
+    GLGE::WorldAsset loaded;
+    loaded.loadColumnar(blob);
+    bool matches = matchesTestWorld(loaded.world(), 100);
+    assertHelper(
+        "Expected a columnar blob that loads into the same world",
+        std::string(magic ? "The blob started with W_CL" : "The blob had no W_CL magic") + (matches ? " and the loaded world matched" : " and the loaded world differed"),
+        magic && matches, fn
+    );
+
+    msg.msg = "[INFO] Testing if the sibling order survives the columnar round trip";
+    (*(fn->log))(&msg);
+
+    std::vector<std::string> order = testChildNames(source.world(), findTestObject(source.world(), "stack"));
+    bool ordered = (order.size() == 100) && (order == testChildNames(loaded.world(), findTestObject(loaded.world(), "stack")));
+    assertHelper(
+        "Expected the children to keep their order",
+        ordered ? "The children kept their order" : "The children where reordered",
+        ordered, fn
+    );
+
+    msg.msg = "[INFO] Testing if a columnar file is imported through the memory mapping and by the generic load";
+    (*(fn->log))(&msg);
+
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "GLGE_world_columnar_test.gwd";
+    source.export_as(file, GLGE::WorldAsset::Format::COLUMNAR);
+    GLGE::WorldAsset imported;
+    imported.import_from(nullptr, file, GLGE::WorldAsset::Format::COLUMNAR);
+    std::filesystem::remove(file);
+    GLGE::WorldAsset generic;
+    generic.load(nullptr, blob);
+    matches = matchesTestWorld(imported.world(), 100) && matchesTestWorld(generic.world(), 100);
+    assertHelper(
+        "Expected the imported and the generically loaded world to match",
+        matches ? "Both worlds matched" : "A world differed from the stored world",
+        matches, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void worldParallelSerializationTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if storing a world spread over many batches gives the same data every time";
+    (*(fn->log))(&msg);
+
+    //the batches run on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("World parallel serialization test", GLGE::Version(0,1,0));
+
+    GLGE::WorldAsset source;
+    fillTestWorld(source.world(), 2000);
+    std::vector<GLGE::u8> first;
+    std::vector<GLGE::u8> second;
+    source.store(first);
+    source.store(second);
+    //only the snapshot IDs (behind the magic, version and object count) may differ
+    bool same = (first.size() == second.size()) && (first.size() > 24);
+    if (same) {
+        std::copy(first.begin() + 16, first.begin() + 24, second.begin() + 16);
+        same = (first == second);
+    }
+    assertHelper(
+        "Expected two stores of the same world to give the same objects",
+        same ? "Both stores gave the same objects" : "The stores differed",
+        same, fn
+    );
+
+    msg.msg = "[INFO] Testing if a world spread over many batches is parsed completely";
+    (*(fn->log))(&msg);
+
+    GLGE::WorldAsset loaded;
+    loaded.load(nullptr, first);
+    bool matches = matchesTestWorld(loaded.world(), 2000);
+    assertHelper(
+        "Expected the loaded world to match the stored world",
+        matches ? "The loaded world matched" : "The loaded world differed from the stored world",
+        matches, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void worldDeltaTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if a delta replays moved, destroyed, created and reshaped objects";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("World delta test", GLGE::Version(0,1,0));
+
+    GLGE::WorldAsset source;
+    fillTestWorld(source.world(), 50);
+    std::vector<GLGE::u8> base;
+    source.store(base);
+    GLGE::WorldAsset loaded;
+    loaded.load(nullptr, base);
+
+    GLGE::World& world = source.world();
+    world.get<GLGE::Transform>(findTestObject(world, "player"))->pos.x = 9;
+    GLGE::Object crate = findTestObject(world, "crate_3");
+    world.destroy(crate);
+    world.create<GLGE::Transform>("crate_new", findTestObject(world, "stack"), GLGE::Transform(GLGE::vec3(50,0,0)));
+    world.add<TestHealth>(findTestObject(world, "weapon"), TestHealth{4});
+    std::vector<GLGE::u8> delta;
+    source.storeDelta(delta);
+    loaded.applyDelta(delta);
+
+    GLGE::World& result = loaded.world();
+    GLGE::Object player = findTestObject(result, "player");
+    GLGE::Object created = findTestObject(result, "crate_new");
+    const TestHealth* health = result.read<TestHealth>(findTestObject(result, "weapon"));
+    size_t transforms = 0;
+    result.each<GLGE::Transform>([&transforms](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform&) {++transforms;});
+    bool applied = player && (result.read<GLGE::Transform>(player)->pos.x == 9) && !findTestObject(result, "crate_3") && 
+                   created && (result.getObjectName(result.getParent(created)) == "stack") && health && (health->value == 4) && 
+                   (transforms == 53) && (loaded.getAppliedSnapshotId() == source.getSnapshotId());
+    assertHelper(
+        "Expected the delta to move, destroy, create and reshape the objects",
+        applied ? "All changes where applied" : "The world did not match the changed world",
+        applied, fn
+    );
+
+    msg.msg = "[INFO] Testing if a delta only holds the changes and only applies to its base";
+    (*(fn->log))(&msg);
+
+    world.get<GLGE::Transform2D>(findTestObject(world, "sun"))->pos.x = 6;
+    std::vector<GLGE::u8> small;
+    source.storeDelta(small);
+    bool rejected = false;
+    try {loaded.applyDelta(delta);}
+    catch (const GLGE::Exception&) {rejected = true;}
+    loaded.applyDelta(small);
+    bool moved = (result.read<GLGE::Transform2D>(findTestObject(result, "sun"))->pos.x == 6) && (result.read<GLGE::Transform>(player)->pos.x == 9);
+    bool compact = small.size() < base.size() / 10;
+    assertHelper(
+        "Expected a small delta, an old delta to be rejected and the new delta to be applied",
+        std::string(compact ? "The delta was small" : "The delta was large") + (rejected ? ", the old delta was rejected" : ", the old delta was applied again") + 
+            (moved ? " and the change was applied" : " and the change was not applied"),
+        compact && rejected && moved, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//check if a world transform is at a specific position
+static bool isTestWorldPos(GLGE::World& world, GLGE::Object obj, const GLGE::vec3& pos) {
+    const GLGE::WorldTransform* transform = obj ? world.read<GLGE::WorldTransform>(obj) : nullptr;
+    return transform && (std::abs(transform->pos.x - pos.x) < 1E-4f) && (std::abs(transform->pos.y - pos.y) < 1E-4f) && 
+           (std::abs(transform->pos.z - pos.z) < 1E-4f);
+}
+
+void transformPropagationTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if the first update computes all world transforms relative to their parents";
+    (*(fn->log))(&msg);
+
+    //the levels are processed on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Transform propagation test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Transform propagation test");
+    fillTestWorld(world, 500);
+    GLGE::System::TransformPropagator propagator;
+    propagator.update(world);
+    bool baked = (propagator.getUpdatedCount() == 503) && isTestWorldPos(world, findTestObject(world, "weapon"), GLGE::vec3(1,3,3)) && 
+                 isTestWorldPos(world, findTestObject(world, "crate_42"), GLGE::vec3(42,0,-1));
+    assertHelper(
+        "Expected all 503 world transforms to be computed from their parents",
+        baked ? "All world transforms where correct" : "A world transform was missing or wrong",
+        baked, fn
+    );
+
+    msg.msg = "[INFO] Testing if unchanged objects are skipped and children follow their moved parent";
+    (*(fn->log))(&msg);
+
+    propagator.update(world);
+    size_t idle = propagator.getUpdatedCount();
+    world.get<GLGE::Transform>(findTestObject(world, "player"))->pos.x = 5;
+    propagator.update(world);
+    size_t moved = propagator.getUpdatedCount();
+    bool followed = isTestWorldPos(world, findTestObject(world, "player"), GLGE::vec3(5,2,3)) && 
+                    isTestWorldPos(world, findTestObject(world, "weapon"), GLGE::vec3(5,3,3));
+    assertHelper(
+        "Expected no work for a static world and only the moved subtree to be updated",
+        std::to_string(idle) + " transforms where updated while idle, " + std::to_string(moved) + " after the move" + 
+            (followed ? ", the child followed its parent" : ", the child did not follow its parent"),
+        (idle == 0) && (moved >= 2) && (moved < 503) && followed, fn
+    );
+
+    msg.msg = "[INFO] Testing if reparenting is picked up by the next update";
+    (*(fn->log))(&msg);
+
+    world.setParent(findTestObject(world, "weapon"), findTestObject(world, "stack"));
+    propagator.update(world);
+    bool reparented = isTestWorldPos(world, findTestObject(world, "weapon"), GLGE::vec3(0,1,-1));
+    assertHelper(
+        "Expected the world transform to follow the new parent",
+        reparented ? "The world transform followed the new parent" : "The world transform was not updated",
+        reparented, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void changedQueryTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if changed-only queries only visit the chunk that was written to";
+    (*(fn->log))(&msg);
+
+    //the parallel query runs on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Changed query test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Changed query test");
+    fillTestWorld(world, GLGE::Registry::chunkSize() * 4);
+    GLGE::Object target = findTestObject(world, "crate_100");
+    GLGE::Registry::tick_t since = world.currentTick();
+    world.advanceTick();
+    //reading must not mark anything
+    float x = world.read<GLGE::Transform>(findTestObject(world, "crate_2000"))->pos.x;
+    world.get<GLGE::Transform>(target)->pos.y = x;
+
+    size_t visited = 0;
+    bool found = false;
+    world.each_changed<GLGE::Transform>(since, [&](const GLGE::Tiny::ECS::Entity& ent, const GLGE::Transform&) {
+        ++visited;
+        found |= (GLGE::Object(ent) == target);
+    });
+    std::atomic_size_t parallelVisited = 0;
+    world.parallel_each_changed<GLGE::Transform>(since, [&parallelVisited](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform&) {
+        parallelVisited.fetch_add(1, std::memory_order_relaxed);
+    });
+    bool single = found && (visited == GLGE::Registry::chunkSize()) && (parallelVisited.load() == visited);
+    assertHelper(
+        "Expected a single chunk containing the written object to be visited",
+        std::to_string(visited) + " objects where visited, " + std::to_string(parallelVisited.load()) + " in parallel" + 
+            (found ? ", the written object was visited" : ", the written object was not visited"),
+        single, fn
+    );
+
+    msg.msg = "[INFO] Testing if nothing is visited after the changes where processed";
+    (*(fn->log))(&msg);
+
+    since = world.currentTick();
+    world.advanceTick();
+    size_t idle = 0;
+    world.each_changed<GLGE::Transform>(since, [&idle](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform&) {++idle;});
+    assertHelper(
+        "Expected no object to be visited",
+        std::to_string(idle) + " objects where visited",
+        idle == 0, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void systemSchedulerTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if conflicting systems run in order and independent ones share a level";
+    (*(fn->log))(&msg);
+
+    //the systems run on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("System scheduler test", GLGE::Version(0,1,0));
+
+    GLGE::World world("System scheduler test");
+    fillTestWorld(world, 100);
+    std::atomic<float> seenSum = 0.f;
+    std::atomic_size_t suns = 0;
+    std::atomic_bool exclusiveAlone = true;
+    std::atomic_int running = 0;
+
+    GLGE::SystemScheduler scheduler;
+    scheduler.add("move", GLGE::SystemAccess().write<GLGE::Transform>(), [&running](GLGE::World& w) {
+        running.fetch_add(1);
+        w.each<GLGE::Transform>([](const GLGE::Tiny::ECS::Entity&, GLGE::Transform& transform) {transform.pos.x += 1;});
+        running.fetch_sub(1);
+    });
+    GLGE::u64 sun = scheduler.add("sun", GLGE::SystemAccess().read<GLGE::Transform2D>(), [&](GLGE::World& w) {
+        running.fetch_add(1);
+        w.each<GLGE::Transform2D>([&suns](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform2D&) {suns.fetch_add(1);});
+        running.fetch_sub(1);
+    });
+    scheduler.add("sum", GLGE::SystemAccess().read<GLGE::Transform>().write<TestHealth>(), [&](GLGE::World& w) {
+        running.fetch_add(1);
+        float sum = 0.f;
+        w.each<GLGE::Transform>([&sum](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform& transform) {sum += transform.pos.x;});
+        seenSum.store(sum);
+        running.fetch_sub(1);
+    });
+    GLGE::u64 exclusive = scheduler.add("exclusive", GLGE::SystemAccess().exclusive(), [&](GLGE::World&) {
+        if (running.load() != 0) {exclusiveAlone = false;}
+    });
+    scheduler.run(world);
+
+    //the crates are at 0 to 99, the player at 1 and the weapon and stack at 0. All of them moved by 1. 
+    float expected = 4950.f + 1.f + 103.f;
+    bool ordered = (seenSum.load() == expected) && (suns.load() == 1) && exclusiveAlone.load() && (scheduler.getLevelCount() == 3);
+    assertHelper(
+        "Expected the reader to see the writes, one sun and 3 levels",
+        "The reader saw a sum of " + std::to_string(seenSum.load()) + " (expected " + std::to_string(expected) + "), " + 
+            std::to_string(suns.load()) + " sun(s) and " + std::to_string(scheduler.getLevelCount()) + " level(s)",
+        ordered, fn
+    );
+
+    msg.msg = "[INFO] Testing if disabled and removed systems are skipped and timed correctly";
+    (*(fn->log))(&msg);
+
+    scheduler.setEnabled(sun, false);
+    scheduler.remove(exclusive);
+    scheduler.run(world);
+    std::vector<GLGE::SystemScheduler::Timing> timings = scheduler.getTimings();
+    bool skipped = (timings.size() == 3) && (timings[0].calls == 2) && (timings[1].name == "sun") && (timings[1].calls == 1) && 
+                   (timings[2].calls == 2) && (suns.load() == 1) && (scheduler.getLevelCount() == 2);
+    assertHelper(
+        "Expected the disabled system to keep one call and the removed one to be gone",
+        skipped ? "The timings and levels where correct" : "The timings or levels where wrong",
+        skipped, fn
+    );
+
+    msg.msg = "[INFO] Testing if an exception of a system is passed to the caller";
+    (*(fn->log))(&msg);
+
+    scheduler.add("throw", GLGE::SystemAccess().read<TestHealth>(), [](GLGE::World&) {
+        throw GLGE::Exception("Test exception", "systemSchedulerTest");
+    });
+    bool thrown = false;
+    try {scheduler.run(world);}
+    catch (const GLGE::Exception&) {thrown = true;}
+    assertHelper(
+        "Expected the exception to be re-thrown",
+        thrown ? "The exception was re-thrown" : "The exception was lost",
+        thrown, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void commandBufferTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if a flush applies creations, component changes, parents and destructions in order";
+    (*(fn->log))(&msg);
+
+    //the parallel recording runs on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Command buffer test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Command buffer test");
+    fillTestWorld(world, 100);
+    GLGE::Object stack = findTestObject(world, "stack");
+    GLGE::Object crate0 = findTestObject(world, "crate_0");
+    GLGE::Object crate1 = findTestObject(world, "crate_1");
+    GLGE::Object crate5 = findTestObject(world, "crate_5");
+
+    GLGE::CommandBuffer commands(world);
+    GLGE::CommandBuffer::Pending spawned = commands.create("spawned", stack, GLGE::Transform(GLGE::vec3(7,0,0)));
+    //components and parents may target objects that only exist after the flush
+    commands.add<TestHealth>(spawned, TestHealth{3});
+    commands.setParent(crate1, spawned);
+    commands.remove<GLGE::Transform>(crate0);
+    commands.add<TestHealth>(crate0, TestHealth{1});
+    //the last parent wins
+    commands.setParent(crate5, findTestObject(world, "player"));
+    commands.setParent(crate5, findTestObject(world, "weapon"));
+    commands.destroy(findTestObject(world, "crate_2"));
+    //destruction happens last, so changes to a destroyed object are harmless
+    GLGE::CommandBuffer::Pending temp = commands.create("temp", GLGE::Transform());
+    commands.add<TestHealth>(temp, TestHealth{2});
+    commands.destroy(temp);
+    bool deferred = !findTestObject(world, "spawned") && findTestObject(world, "crate_2") && world.read<GLGE::Transform>(crate0);
+    commands.flush();
+
+    GLGE::Object created = commands.resolve(spawned);
+    const TestHealth* health = created ? world.read<TestHealth>(created) : nullptr;
+    const TestHealth* crateHealth = world.read<TestHealth>(crate0);
+    bool applied = deferred && created && (world.getObjectName(created) == "spawned") && (world.getParent(created) == stack) && 
+                   health && (health->value == 3) && world.read<GLGE::Transform>(created) && 
+                   !world.read<GLGE::Transform>(crate0) && crateHealth && (crateHealth->value == 1) && 
+                   (world.getParent(crate1) == created) && (world.getObjectName(world.getParent(crate5)) == "weapon") && 
+                   !findTestObject(world, "crate_2") && !findTestObject(world, "temp");
+    assertHelper(
+        "Expected nothing to change before the flush and all commands to be applied by it",
+        applied ? "All commands where applied in order" : "A command was applied early, wrong or not at all",
+        applied, fn
+    );
+
+    msg.msg = "[INFO] Testing if commands recorded from a parallel iteration are all applied";
+    (*(fn->log))(&msg);
+
+    world.parallel_each<GLGE::Transform>([&commands](const GLGE::Tiny::ECS::Entity& ent, const GLGE::Transform& transform) {
+        commands.add<TestHealth>(GLGE::Object(ent), TestHealth{GLGE::u32(transform.pos.x)});
+    });
+    commands.flush();
+    size_t tagged = 0;
+    bool values = true;
+    world.each<GLGE::Transform, TestHealth>([&](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform& transform, const TestHealth& h) {
+        ++tagged;
+        values &= (h.value == GLGE::u32(transform.pos.x));
+    });
+    //all crates but the removed and destroyed one, the player, the weapon, the stack and the spawned object. Existing
+    //components are overwritten.
+    assertHelper(
+        "Expected 102 objects with the recorded values",
+        std::to_string(tagged) + " objects where found" + (values ? " with the recorded values" : " with wrong values"),
+        (tagged == 102) && values, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void persistentQueryTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if a persistent query matches the existing archtypes";
+    (*(fn->log))(&msg);
+
+    //the parallel iteration runs on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Persistent query test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Persistent query test");
+    fillTestWorld(world, 100);
+    GLGE::Query<GLGE::Transform> transforms(world);
+    GLGE::Query<GLGE::Transform, TestHealth> healthy(world);
+    bool initial = (transforms.count() == 103) && (transforms.getArchtypeCount() == 2) && (healthy.count() == 1);
+    assertHelper(
+        "Expected 103 transforms in 2 archtypes and a single object with health",
+        std::to_string(transforms.count()) + " transforms in " + std::to_string(transforms.getArchtypeCount()) + " archtypes and " + 
+            std::to_string(healthy.count()) + " object(s) with health",
+        initial, fn
+    );
+
+    msg.msg = "[INFO] Testing if the query picks up archtypes created and objects moved after it was created";
+    (*(fn->log))(&msg);
+
+    world.create<GLGE::Transform, GLGE::WorldTransform>("late", GLGE::Transform(GLGE::vec3(1000,0,0)), GLGE::WorldTransform());
+    world.add<TestHealth>(findTestObject(world, "weapon"), TestHealth{1});
+    GLGE::Object crate = findTestObject(world, "crate_9");
+    world.destroy(crate);
+    float sum = 0.f;
+    size_t visited = 0;
+    transforms.each([&](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform& transform) {sum += transform.pos.x; ++visited;});
+    std::atomic_size_t parallelVisited = 0;
+    transforms.parallel_each([&parallelVisited](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform&) {parallelVisited.fetch_add(1);});
+    //the crates are at 0 to 99 without 9, the player is at 1 and the late object at 1000
+    bool updated = (visited == 103) && (parallelVisited.load() == 103) && (sum == 4950.f - 9.f + 1.f + 1000.f) && 
+                   (transforms.getArchtypeCount() == 3) && (healthy.count() == 2);
+    assertHelper(
+        "Expected 103 transforms in 3 archtypes and two objects with health",
+        std::to_string(visited) + " transforms where visited (" + std::to_string(parallelVisited.load()) + " in parallel) in " + 
+            std::to_string(transforms.getArchtypeCount()) + " archtypes, " + std::to_string(healthy.count()) + " object(s) with health",
+        updated, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//a tag that is toggled often and stored in a sparse set
+struct TestSelected {
+    GLGE::u32 marker = 0;
+};
+template <>
+struct GLGE::Tiny::ECS::sparse_storage<TestSelected> : std::true_type {};
+
+//count the objects a query visits
+template <typename Q>
+static size_t countTestQuery(Q& query) {
+    size_t visited = 0;
+    query.each([&visited](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform&) {++visited;});
+    return visited;
+}
+
+void sparseComponentTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if sparse components are added without moving objects and filter queries";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Sparse component test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Sparse component test");
+    fillTestWorld(world, 100);
+    GLGE::Query<GLGE::Transform> all(world);
+    size_t archtypes = all.getArchtypeCount();
+    for (GLGE::u32 i = 0; i < 10; ++i)
+    {world.add<TestSelected>(findTestObject(world, "crate_" + std::to_string(i)), TestSelected{i});}
+    GLGE::Query<GLGE::Transform> selected(world);
+    selected.with<TestSelected>();
+    GLGE::Query<GLGE::Transform> unselected(world);
+    unselected.without<TestSelected>();
+    const TestSelected* marker = world.read<TestSelected>(findTestObject(world, "crate_3"));
+    bool filtered = (all.getArchtypeCount() == archtypes) && (countTestQuery(selected) == 10) && (countTestQuery(unselected) == 93) && 
+                    marker && (marker->marker == 3) && !world.read<TestSelected>(findTestObject(world, "crate_10"));
+    assertHelper(
+        "Expected no new archtype, 10 selected and 93 unselected objects",
+        std::to_string(all.getArchtypeCount() - archtypes) + " new archtype(s), " + std::to_string(countTestQuery(selected)) + " selected and " + 
+            std::to_string(countTestQuery(unselected)) + " unselected objects",
+        filtered, fn
+    );
+
+    msg.msg = "[INFO] Testing if removed sparse components and destroyed objects leave the sparse set";
+    (*(fn->log))(&msg);
+
+    world.remove<TestSelected>(findTestObject(world, "crate_0"));
+    world.remove<TestSelected>(findTestObject(world, "crate_0"));
+    GLGE::Object crate = findTestObject(world, "crate_1");
+    world.destroy(crate);
+    //a new object may reuse the slot of the destroyed one
+    GLGE::Object fresh = world.create<GLGE::Transform>("fresh", GLGE::Transform());
+    size_t sparse = 0;
+    bool markers = true;
+    world.each_sparse<TestSelected>([&](const GLGE::Tiny::ECS::Entity& ent, const TestSelected& tag) {
+        ++sparse;
+        markers &= (world.getObjectName(ent) == "crate_" + std::to_string(tag.marker));
+    });
+    bool cleaned = (sparse == 8) && markers && !world.read<TestSelected>(fresh) && (countTestQuery(selected) == 8) && 
+                   (countTestQuery(unselected) == 95);
+    assertHelper(
+        "Expected 8 selected objects with their own markers and 95 unselected objects",
+        std::to_string(sparse) + " sparse components" + (markers ? "" : " with wrong markers") + ", " + std::to_string(countTestQuery(selected)) + 
+            " selected and " + std::to_string(countTestQuery(unselected)) + " unselected objects",
+        cleaned, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void chunkArenaTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if the arena hands out aligned memory and tracks it";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Chunk arena test", GLGE::Version(0,1,0));
+
+    GLGE::ChunkArena arena;
+    void* first = arena.allocate(100);
+    void* second = arena.allocate(1000);
+    bool aligned = ((reinterpret_cast<uintptr_t>(first) % 64) == 0) && ((reinterpret_cast<uintptr_t>(second) % 64) == 0) && 
+                   (arena.getUsedBytes() >= 1100) && (arena.getReservedBytes() >= arena.getUsedBytes());
+    arena.deallocate(first, 100);
+    arena.deallocate(second, 1000);
+    aligned &= (arena.getUsedBytes() == 0);
+    assertHelper(
+        "Expected cache line aligned allocations that are tracked and given back",
+        aligned ? "The allocations where aligned and tracked" : "An allocation was misaligned or not tracked",
+        aligned, fn
+    );
+
+    msg.msg = "[INFO] Testing if a world allocates its chunks from the arena and reports them per archtype";
+    (*(fn->log))(&msg);
+
+    bool reported = false;
+    std::string actual;
+    {
+        GLGE::World world("Chunk arena test", &arena);
+        fillTestWorld(world, 3000);
+        std::vector<GLGE::World::ArchtypeMemory> memory = world.getChunkMemory();
+        size_t sum = 0;
+        bool sorted = true;
+        for (size_t i = 0; i < memory.size(); ++i) {
+            sum += memory[i].bytes;
+            if (i > 0) {sorted &= (memory[i - 1].bytes >= memory[i].bytes);}
+        }
+        reported = (world.getChunkArena() == &arena) && (world.getTotalChunkMemory() > 0) && 
+                   (arena.getUsedBytes() >= world.getTotalChunkMemory()) && sorted && !memory.empty() && 
+                   (memory.front().objectCount == 3002) && (sum == world.getTotalChunkMemory());
+        actual = std::to_string(memory.size()) + " archtypes with " + std::to_string(sum) + " of " + std::to_string(world.getTotalChunkMemory()) + 
+                 " bytes, " + std::to_string(arena.getUsedBytes()) + " bytes used in the arena" + (sorted ? "" : ", not sorted");
+    }
+    reported &= (arena.getUsedBytes() == 0);
+    assertHelper(
+        "Expected the chunks to come from the arena, a sorted report and all memory to be given back",
+        actual + ", " + std::to_string(arena.getUsedBytes()) + " bytes left after the world was destroyed",
+        reported, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void worldCompactionTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if destroying most objects leaves empty chunks";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("World compaction test", GLGE::Version(0,1,0));
+
+    GLGE::World world("World compaction test");
+    fillTestWorld(world, 5000);
+    std::vector<GLGE::Object> crates;
+    for (GLGE::Object crate : world.children(findTestObject(world, "stack")))
+    {crates.push_back(crate);}
+    //keep every 50th crate, so the survivors are moved around by the removals
+    std::vector<std::pair<GLGE::Object, std::string>> kept;
+    for (GLGE::Object& crate : crates) {
+        if (GLGE::u32(world.read<GLGE::Transform>(crate)->pos.x) % 50 == 0) {kept.push_back({crate, world.getObjectName(crate)});}
+        else {world.destroy(crate);}
+    }
+    size_t before = world.getTotalChunkMemory();
+    size_t empty = world.getEmptyChunkCount();
+    assertHelper(
+        "Expected empty chunks after destroying 4900 objects",
+        std::to_string(empty) + " empty chunks",
+        empty > 0, fn
+    );
+
+    msg.msg = "[INFO] Testing if time-sliced compaction releases all empty chunks and keeps all handles valid";
+    (*(fn->log))(&msg);
+
+    size_t calls = 0;
+    while (!world.compact(std::chrono::microseconds(1)) && (calls < 100000)) {++calls;}
+    bool valid = (kept.size() == 100);
+    for (const auto& [crate, name] : kept) {
+        const GLGE::Transform* transform = world.read<GLGE::Transform>(crate);
+        valid &= transform && (world.getObjectName(crate) == name) && (name == "crate_" + std::to_string(GLGE::u32(transform->pos.x)));
+    }
+    bool compacted = (world.getEmptyChunkCount() == 0) && (world.getTotalChunkMemory() < before) && valid;
+    assertHelper(
+        "Expected no empty chunks, less memory and valid handles",
+        std::to_string(world.getEmptyChunkCount()) + " empty chunks after " + std::to_string(calls + 1) + " calls, " + 
+            std::to_string(world.getTotalChunkMemory()) + " of " + std::to_string(before) + " bytes" + (valid ? "" : ", a handle was invalid"),
+        compacted, fn
+    );
+
+    msg.msg = "[INFO] Testing if a compacted world can grow again";
+    (*(fn->log))(&msg);
+
+    world.create<GLGE::Transform>("crate_late", findTestObject(world, "stack"), GLGE::Transform(GLGE::vec3(6000,0,0)));
+    size_t count = 0;
+    world.each<GLGE::Transform>([&count](const GLGE::Tiny::ECS::Entity&, const GLGE::Transform&) {++count;});
+    assertHelper(
+        "Expected 104 objects with a transform",
+        std::to_string(count) + " objects with a transform",
+        count == 104, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//check if an object is a correctly linked copy of the player, the weapon and the scope
+static bool isTestPrefabCopy(GLGE::World& world, GLGE::Object root, GLGE::Object parent, std::unordered_set<GLGE::u64>& seen) {
+    const TestHealth* health = world.read<TestHealth>(root);
+    if ((world.getObjectName(root) != "player") || !(world.getParent(root) == parent) || !health || (health->value != 7)) {return false;}
+    std::vector<std::string> path = {"weapon", "scope"};
+    GLGE::Object current = root;
+    for (const std::string& name : path) {
+        std::vector<GLGE::Object> children;
+        for (GLGE::Object child : world.children(current)) {children.push_back(child);}
+        if ((children.size() != 1) || (world.getObjectName(children.front()) != name) || !world.read<GLGE::Transform>(children.front())) {return false;}
+        current = children.front();
+    }
+    //no object may be shared between two copies
+    for (GLGE::Object obj : world.descendants(root)) {
+        if (!seen.insert(GLGE::Tiny::ECS::Entity(obj).getBlob()).second) {return false;}
+    }
+    return seen.insert(GLGE::Tiny::ECS::Entity(root).getBlob()).second;
+}
+
+void prefabTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if a prefab captures an object with all of its children";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Prefab test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Prefab test");
+    fillTestWorld(world, 10);
+    world.create<GLGE::Transform>("scope", findTestObject(world, "weapon"), GLGE::Transform(GLGE::vec3(0,0,1)));
+    GLGE::Prefab prefab(world, findTestObject(world, "player"));
+    assertHelper(
+        "Expected 3 captured objects",
+        std::to_string(prefab.getObjectCount()) + " captured objects",
+        prefab.getObjectCount() == 3, fn
+    );
+
+    msg.msg = "[INFO] Testing if instantiating creates N separate, correctly linked subtrees";
+    (*(fn->log))(&msg);
+
+    GLGE::World target("Prefab target");
+    GLGE::Object army = target.create<GLGE::Transform>("army", GLGE::Transform());
+    std::vector<GLGE::Object> copies = prefab.instantiate(target, 50, army);
+    std::unordered_set<GLGE::u64> seen;
+    bool linked = (copies.size() == 50);
+    for (GLGE::Object copy : copies) {linked &= isTestPrefabCopy(target, copy, army, seen);}
+    size_t children = 0;
+    for (GLGE::Object child : target.children(army)) {++children; (void)child;}
+    size_t objects = 0;
+    target.each<GLGE::Component::Name>([&objects](const GLGE::Tiny::ECS::Entity&, const GLGE::Component::Name&) {++objects;});
+    linked &= (children == 50) && (objects == 151);
+    assertHelper(
+        "Expected 50 copies with 3 objects each below the army",
+        std::to_string(copies.size()) + " copies, " + std::to_string(children) + " children of the army and " + std::to_string(objects) + 
+            " objects" + (linked ? "" : ", a copy was linked wrong"),
+        linked, fn
+    );
+
+    msg.msg = "[INFO] Testing if the copies are independent and can be spawned in the source world";
+    (*(fn->log))(&msg);
+
+    target.get<TestHealth>(copies[0])->value = 1;
+    std::vector<GLGE::Object> local = prefab.instantiate(world, 5);
+    seen.clear();
+    bool independent = (target.read<TestHealth>(copies[1])->value == 7) && (local.size() == 5);
+    for (GLGE::Object copy : local) {independent &= isTestPrefabCopy(world, copy, GLGE::World::getRoot(), seen);}
+    assertHelper(
+        "Expected independent copies and 5 copies at the root of the source world",
+        independent ? "The copies where independent and linked correctly" : "A copy was shared or linked wrong",
+        independent, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//get the sorted names of a list of objects
+static std::vector<std::string> testObjectNames(GLGE::World& world, const std::vector<GLGE::Object>& objects) {
+    std::vector<std::string> names;
+    for (GLGE::Object obj : objects) {names.push_back(world.getObjectName(obj));}
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+//print a list of names for an assertion
+static std::string testJoinNames(const std::vector<std::string>& names) {
+    std::stringstream stream;
+    stream << names.size() << " object(s):";
+    for (const std::string& name : names) {stream << " " << name;}
+    return stream.str();
+}
+
+void spatialIndexTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if radius and box queries find exactly the objects in the region";
+    (*(fn->log))(&msg);
+
+    //the transforms are propagated on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Spatial index test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Spatial index test");
+    fillTestWorld(world, 1000);
+    GLGE::System::TransformPropagator propagator;
+    GLGE::SpatialIndex index(16.f);
+    propagator.update(world);
+    index.update(world);
+
+    //the crates are at (i, 0, -1)
+    std::vector<std::string> radius = testObjectNames(world, index.queryRadius(GLGE::vec3(100,0,-1), 2.5f));
+    std::vector<std::string> box = testObjectNames(world, index.queryAABB(GLGE::AABB(GLGE::vec3(9.5f,-1,-2), GLGE::vec3(19.5f,1,0))));
+    std::vector<std::string> expectedRadius = {"crate_100", "crate_101", "crate_102", "crate_98", "crate_99"};
+    std::vector<std::string> expectedBox;
+    for (size_t i = 10; i < 20; ++i) {expectedBox.push_back("crate_" + std::to_string(i));}
+    std::sort(expectedBox.begin(), expectedBox.end());
+    assertHelper(
+        "Expected 1003 indexed objects, 5 in the radius and 10 in the box",
+        std::to_string(index.getObjectCount()) + " indexed objects, radius: " + testJoinNames(radius) + ", box: " + testJoinNames(box),
+        (index.getObjectCount() == 1003) && (radius == expectedRadius) && (box == expectedBox), fn
+    );
+
+    msg.msg = "[INFO] Testing if moved objects are found at their new position only";
+    (*(fn->log))(&msg);
+
+    world.get<GLGE::Transform>(findTestObject(world, "crate_100"))->pos.x = 500.25f;
+    propagator.update(world);
+    index.update(world);
+    size_t updated = index.getUpdatedCount();
+    radius = testObjectNames(world, index.queryRadius(GLGE::vec3(100,0,-1), 2.5f));
+    std::vector<std::string> moved = testObjectNames(world, index.queryRadius(GLGE::vec3(500.25f,0,-1), 0.5f));
+    bool followed = (radius == std::vector<std::string>{"crate_101", "crate_102", "crate_98", "crate_99"}) && 
+                    (moved == std::vector<std::string>{"crate_100", "crate_500"}) && (updated < 1003);
+    assertHelper(
+        "Expected the moved object to leave the old region and join the new one",
+        std::to_string(updated) + " re-inserted objects, old region: " + testJoinNames(radius) + ", new region: " + testJoinNames(moved),
+        followed, fn
+    );
+
+    msg.msg = "[INFO] Testing if removed objects are dropped and large bounds are found";
+    (*(fn->log))(&msg);
+
+    GLGE::Object crate = findTestObject(world, "crate_500");
+    world.destroy(crate);
+    world.add<GLGE::Bounds>(findTestObject(world, "crate_300"), GLGE::Bounds(GLGE::AABB(GLGE::vec3(-60), GLGE::vec3(60))));
+    propagator.update(world);
+    index.update(world);
+    moved = testObjectNames(world, index.queryRadius(GLGE::vec3(500.25f,0,-1), 0.5f));
+    std::vector<std::string> large = testObjectNames(world, index.queryAABB(GLGE::AABB(GLGE::vec3(349.5f,-1,-2), GLGE::vec3(350.5f,1,0))));
+    bool removed = (index.getObjectCount() == 1002) && (moved == std::vector<std::string>{"crate_100"}) && 
+                   (large == std::vector<std::string>{"crate_300", "crate_350"});
+    assertHelper(
+        "Expected 1002 indexed objects, only the moved object in the new region and the large object in the box",
+        std::to_string(index.getObjectCount()) + " indexed objects, new region: " + testJoinNames(moved) + ", box: " + testJoinNames(large),
+        removed, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+//check the flattened hierarchy of a world against its sibling links, returns an empty string if it is valid
+static std::string checkTestHierarchyOrder(GLGE::World& world, size_t expected) {
+    std::span<const GLGE::World::HierarchyEntry> order = world.getHierarchyOrder();
+    std::span<const size_t> levels = world.getHierarchyLevels();
+    if (order.size() != expected) {return std::to_string(order.size()) + " objects instead of " + std::to_string(expected);}
+    if (levels.empty() || (levels.back() != order.size())) {return "the levels do not end at the last object";}
+
+    std::unordered_map<GLGE::u64, size_t> indices;
+    for (size_t i = 0; i < order.size(); ++i) {
+        const GLGE::World::HierarchyEntry& entry = order[i];
+        indices[GLGE::Tiny::ECS::Entity(entry.object).getBlob()] = i;
+        //the entry must be inside the range of its level
+        if ((entry.depth + 1 >= levels.size()) || (i < levels[entry.depth]) || (i >= levels[entry.depth + 1]))
+        {return world.getObjectName(entry.object) + " is outside of its level";}
+        GLGE::Object parent = world.getParent(entry.object);
+        if (entry.parent == UINT32_MAX) {
+            if (parent.valid() || (entry.depth != 0)) {return world.getObjectName(entry.object) + " is no top level object";}
+            continue;
+        }
+        if ((entry.parent >= i) || !(order[entry.parent].object == parent) || (entry.depth != order[entry.parent].depth + 1))
+        {return world.getObjectName(entry.object) + " does not follow its parent " + world.getObjectName(parent);}
+    }
+
+    //the children of every parent are stored next to each other in sibling order
+    for (size_t i = 0; i < order.size(); ++i) {
+        size_t next = SIZE_MAX;
+        for (GLGE::Object child : world.children(order[i].object)) {
+            auto it = indices.find(GLGE::Tiny::ECS::Entity(child).getBlob());
+            if (it == indices.end()) {return world.getObjectName(child) + " is missing";}
+            if ((next != SIZE_MAX) && (it->second != next)) {return "the children of " + world.getObjectName(order[i].object) + " are not in order";}
+            next = it->second + 1;
+        }
+    }
+    return "";
+}
+
+void hierarchyOrderTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if the flattened hierarchy lists parents before their children, grouped by depth";
+    (*(fn->log))(&msg);
+
+    //worlds belong to the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Hierarchy order test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Hierarchy order test");
+    fillTestWorld(world, 20);
+    std::string error = checkTestHierarchyOrder(world, 24);
+    bool depth = (world.getHierarchyLevels().size() == 3);
+    assertHelper(
+        "Expected a valid order with 2 levels",
+        error.empty() ? std::to_string(world.getHierarchyLevels().size() - 1) + " levels" : error,
+        error.empty() && depth, fn
+    );
+
+    msg.msg = "[INFO] Testing if the flattened hierarchy follows re-parenting";
+    (*(fn->log))(&msg);
+
+    GLGE::Object stack = findTestObject(world, "stack");
+    GLGE::Object weapon = findTestObject(world, "weapon");
+    world.setParent(stack, weapon);
+    error = checkTestHierarchyOrder(world, 24);
+    size_t levels = world.getHierarchyLevels().size() - 1;
+    world.setParent(weapon, GLGE::World::getRoot());
+    world.setParent(findTestObject(world, "crate_3"), findTestObject(world, "player"));
+    if (error.empty()) {error = checkTestHierarchyOrder(world, 24);}
+    size_t descendants = 0;
+    for (GLGE::Object obj : world.descendants(weapon)) {++descendants; (void)obj;}
+    assertHelper(
+        "Expected a valid order with 4 levels after moving the stack below the weapon and 20 descendants of the weapon after moving it to the root",
+        error.empty() ? std::to_string(levels) + " levels, " + std::to_string(descendants) + " descendants" : error,
+        error.empty() && (levels == 4) && (descendants == 20), fn
+    );
+
+    msg.msg = "[INFO] Testing if the flattened hierarchy follows creation and destruction";
+    (*(fn->log))(&msg);
+
+    GLGE::Object crate = findTestObject(world, "crate_0");
+    world.destroy(crate);
+    world.create<GLGE::Transform>("lid", findTestObject(world, "crate_5"), GLGE::Transform());
+    world.create<GLGE::Transform>("tree", GLGE::Transform());
+    error = checkTestHierarchyOrder(world, 25);
+    assertHelper(
+        "Expected a valid order with 25 objects",
+        error.empty() ? "The order was valid" : error,
+        error.empty(), fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void transformCompactionTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if the transform propagator follows the storage moved by a compaction";
+    (*(fn->log))(&msg);
+
+    //the levels are processed on the employer of the bound instance
+    GLGE::Instance::init();
+    GLGE::Instance instance("Transform compaction test", GLGE::Version(0,1,0));
+
+    GLGE::World world("Transform compaction test");
+    fillTestWorld(world, 3000);
+    GLGE::System::TransformPropagator propagator;
+    propagator.update(world);
+
+    //despawn most crates, update, then release the empty chunks
+    std::vector<GLGE::Object> crates;
+    for (GLGE::Object crate : world.children(findTestObject(world, "stack")))
+    {crates.push_back(crate);}
+    for (GLGE::Object& crate : crates) {
+        if (GLGE::u32(world.read<GLGE::Transform>(crate)->pos.x) >= 100) {world.destroy(crate);}
+    }
+    propagator.update(world);
+    size_t calls = 0;
+    while (!world.compact(std::chrono::microseconds(1)) && (calls < 100000)) {++calls;}
+    bool released = (world.getEmptyChunkCount() == 0);
+
+    //write through the new storage and update again
+    world.get<GLGE::Transform>(findTestObject(world, "stack"))->pos.y = 2;
+    world.get<GLGE::Transform>(findTestObject(world, "player"))->pos.x = 4;
+    propagator.update(world);
+    bool valid = released && isTestWorldPos(world, findTestObject(world, "player"), GLGE::vec3(4,2,3)) && 
+                 isTestWorldPos(world, findTestObject(world, "weapon"), GLGE::vec3(4,3,3));
+    for (size_t i = 0; i < 100; i += 7)
+    {valid &= isTestWorldPos(world, findTestObject(world, "crate_" + std::to_string(i)), GLGE::vec3(float(i),2,-1));}
+    assertHelper(
+        "Expected all world transforms to follow the writes made after the compaction",
+        std::string(released ? "The empty chunks where released" : "Empty chunks where left") + 
+            (valid ? " and all world transforms where correct" : " and a world transform was wrong"),
+        valid, fn
+    );
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+/**
+ * @brief store what the test extensions did during their updates
+ */
+struct TestUpdateLog {
+    /**
+     * @brief protect the log against extensions updating in parallel
+     */
+    std::mutex mtx;
+    /**
+     * @brief the names of the extensions in the order their updates finished
+     */
+    std::vector<std::string_view> order;
+    /**
+     * @brief the start and end of the last update of each extension
+     */
+    std::unordered_map<std::string_view, std::pair<std::chrono::steady_clock::time_point, std::chrono::steady_clock::time_point>> spans;
+};
+
+/**
+ * @brief an extension that writes its updates to a test log
+ * 
+ * @tparam ID a unique identifier, as an instance only accepts a single extension of each type
+ */
+template <int ID>
+class TestOrderExtension : public GLGE::InstanceExtension {
+public:
+
+    /**
+     * @brief Construct a new Test Order Extension
+     * 
+     * @param name the name to write to the log
+     * @param log the log to write the updates to
+     * @param sleep the amount of milliseconds an update takes
+     * @param children the child extensions of the extension
+     */
+    TestOrderExtension(std::string_view name, TestUpdateLog* log, GLGE::u32 sleep, const GLGE::OrderedMap<std::string_view, GLGE::InstanceExtension*>& children = {})
+     : GLGE::InstanceExtension(children), m_name(name), m_log(log), m_sleep(sleep)
+    {}
+
+    virtual void onStart() override {}
+    virtual void onUpdate() override {
+        auto start = std::chrono::steady_clock::now();
+        if (m_sleep) {std::this_thread::sleep_for(std::chrono::milliseconds(m_sleep));}
+        auto end = std::chrono::steady_clock::now();
+        std::lock_guard lock(m_log->mtx);
+        m_log->order.push_back(m_name);
+        m_log->spans.insert_or_assign(m_name, std::pair{start, end});
+    }
+    virtual void onShutdown() override {}
+    virtual void onInstanceSetting() override {}
+    virtual void onBind() override {}
+    virtual void onUnbind() override {}
+
+protected:
+
+    /**
+     * @brief the name written to the log
+     */
+    std::string_view m_name;
+    /**
+     * @brief the log to write the updates to
+     */
+    TestUpdateLog* m_log;
+    /**
+     * @brief the amount of milliseconds an update takes
+     */
+    GLGE::u32 m_sleep;
+};
+
+/**
+ * @brief run the update thread of an instance until the log contains a specific amount of updates
+ * 
+ * @param instance the instance to run
+ * @param log the log the extensions of the instance write to
+ * @param count the amount of updates to wait for
+ * @return `true` if enough updates happened, `false` if the wait timed out
+ */
+static bool runTestUpdates(GLGE::Instance& instance, TestUpdateLog& log, size_t count) {
+    instance.start();
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    bool done = false;
+    while (!done && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard lock(log.mtx);
+        done = log.order.size() >= count;
+    }
+    instance.shutdown();
+    return done;
+}
+
+/**
+ * @brief describe the update order of the ticks in a log
+ * 
+ * @param log the log to describe
+ * @param extensions the amount of extensions updated each tick
+ * @return `std::string` the order of the first tick, or a note that the ticks differ or are missing
+ */
+static std::string testUpdateOrder(TestUpdateLog& log, size_t extensions) {
+    std::lock_guard lock(log.mtx);
+    size_t ticks = log.order.size() / extensions;
+    if (ticks == 0) {return "No full tick";}
+    for (size_t i = extensions; i < ticks * extensions; ++i) {
+        if (log.order[i] != log.order[i % extensions]) {return "The ticks used different orders";}
+    }
+    std::string order;
+    for (size_t i = 0; i < extensions; ++i) {order += (i ? " " : "") + std::string(log.order[i]);}
+    return order;
+}
+
+void instanceExtensionGraphTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if the extensions update in attach order by default";
+    (*(fn->log))(&msg);
+
+    GLGE::Instance::init();
+    {
+        TestUpdateLog log;
+        TestOrderExtension<1> b1("B1", &log, 0);
+        TestOrderExtension<0> a("A", &log, 0);
+        TestOrderExtension<2> b("B", &log, 0, {{"B1", &b1}});
+        TestOrderExtension<3> c("C", &log, 0);
+        GLGE::Instance instance("Instance extension graph test", GLGE::Version(0,1,0));
+        instance.addExtension("A", &a);
+        instance.addExtension("B", &b);
+        instance.addExtension("C", &c);
+        bool serial = !instance.isParallelUpdate();
+        bool ran = runTestUpdates(instance, log, 8);
+        std::string order = testUpdateOrder(log, 4);
+        assertHelper(
+            "Serial updates by default in the order A B B1 C",
+            std::string(serial ? "Serial" : "Parallel") + " updates " + (ran ? "" : "timed out ") + "by default in the order " + order,
+            serial && ran && (order == "A B B1 C"), fn
+        );
+    }
+
+    msg.msg = "[INFO] Testing if an extension that runs after a sibling is moved behind it";
+    (*(fn->log))(&msg);
+    {
+        TestUpdateLog log;
+        TestOrderExtension<1> b1("B1", &log, 0);
+        TestOrderExtension<0> a("A", &log, 0);
+        TestOrderExtension<2> b("B", &log, 0, {{"B1", &b1}});
+        TestOrderExtension<3> c("C", &log, 0);
+        a.runAfter("C");
+        GLGE::Instance instance("Instance extension graph test", GLGE::Version(0,1,0));
+        instance.addExtension("A", &a);
+        instance.addExtension("B", &b);
+        instance.addExtension("C", &c);
+        bool ran = runTestUpdates(instance, log, 8);
+        std::string order = testUpdateOrder(log, 4);
+        assertHelper("B B1 C A", order, ran && (order == "B B1 C A"), fn);
+    }
+
+    msg.msg = "[INFO] Testing if parallel updates keep the dependencies and report the critical path";
+    (*(fn->log))(&msg);
+    {
+        TestUpdateLog log;
+        TestOrderExtension<1> b1("B1", &log, 5);
+        TestOrderExtension<0> a("A", &log, 5);
+        TestOrderExtension<2> b("B", &log, 5, {{"B1", &b1}});
+        TestOrderExtension<3> c("C", &log, 20);
+        a.runAfter("C");
+        GLGE::Instance instance("Instance extension graph test", GLGE::Version(0,1,0));
+        instance.addExtension("A", &a);
+        instance.addExtension("B", &b);
+        instance.addExtension("C", &c);
+        instance.setParallelUpdate(true);
+        bool parallel = instance.isParallelUpdate();
+        bool ran = runTestUpdates(instance, log, 8);
+
+        //the spans of the last update have to respect the dependencies
+        bool ordered = false;
+        {
+            std::lock_guard lock(log.mtx);
+            ordered = (log.spans["C"].second <= log.spans["A"].first) && (log.spans["B"].second <= log.spans["B1"].first);
+        }
+        assertHelper(
+            "Parallel updates where every extension starts after its dependencies",
+            std::string(parallel ? "Parallel" : "Serial") + " updates " + (ran ? "" : "timed out ") + 
+            (ordered ? "where every extension starts after its dependencies" : "where an extension started before a dependency finished"),
+            parallel && ran && ordered, fn
+        );
+
+        std::vector<std::string_view> path = instance.getCriticalPath();
+        std::string names;
+        for (std::string_view name : path) {names += (names.empty() ? "" : " ") + std::string(name);}
+        double time = instance.getCriticalPathTime();
+        assertHelper(
+            "The critical path C A took at least 25 ms",
+            "The critical path " + names + " took " + std::to_string(time) + " ms",
+            (names == "C A") && (time >= 25.0), fn
+        );
+    }
+
+    msg.msg = "[INFO] Testing if unknown siblings and cycles are rejected when the instance starts";
+    (*(fn->log))(&msg);
+    for (bool cycle : {false, true}) {
+        TestUpdateLog log;
+        TestOrderExtension<0> a("A", &log, 0);
+        TestOrderExtension<3> c("C", &log, 0);
+        a.runAfter(cycle ? "C" : "D");
+        if (cycle) {c.runAfter("A");}
+        GLGE::Instance instance("Instance extension graph test", GLGE::Version(0,1,0));
+        instance.addExtension("A", &a);
+        instance.addExtension("C", &c);
+        bool thrown = false;
+        try {instance.start();}
+        catch (const GLGE::Exception&) {thrown = true;}
+        bool active = instance.isActive();
+        if (active) {instance.shutdown();}
+        assertHelper(
+            std::string(cycle ? "A cycle" : "An unknown sibling") + " was rejected",
+            std::string(cycle ? "A cycle" : "An unknown sibling") + (thrown ? " was rejected" : " was accepted") + (active ? " and the instance started" : ""),
+            thrown && !active, fn
+        );
+    }
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+void cookManifestTest(const TestContext* ctx, TestReport* report, const TestFunctions* fn) {
+    //initialize as controlled fail
+    report->result = TEST_CONTROLLED_FAIL;
+
+    //use an own output directory with a cooked pack
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "GLGE_cook_manifest_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    std::filesystem::path pack = root / "models.gcmp";
+    std::ofstream(pack) << "pack";
+    std::filesystem::path file = root / MANIFEST_NAME;
+
+    TestMessage msg;
+    msg.msg = "[INFO] Testing if an unchanged pack is not cooked again";
+    (*(fn->log))(&msg);
+
+    std::map<std::string, GLGE::u64> hashes = {{"models/car.fbx", 0x12}, {"models/truck.fbx", 0xFEDCBA9876543210}};
+    writeCookManifest(file, {{"models", hashes}});
+    CookManifest manifest = readCookManifest(file);
+    bool dirty = isCookPackDirty(manifest, "models", hashes, pack);
+    assertHelper("The pack is up to date", dirty ? "The pack is dirty" : "The pack is up to date", !dirty, fn);
+
+    msg.msg = "[INFO] Testing if a changed source cooks the pack again";
+    (*(fn->log))(&msg);
+
+    std::map<std::string, GLGE::u64> changed = hashes;
+    changed["models/car.fbx"] = 0x13;
+    dirty = isCookPackDirty(manifest, "models", changed, pack);
+    assertHelper("The pack is dirty", dirty ? "The pack is dirty" : "The pack is up to date", dirty, fn);
+
+    msg.msg = "[INFO] Testing if damaged manifest lines cook the pack again instead of failing";
+    (*(fn->log))(&msg);
+
+    //truncate the hash of the last line and add lines with a broken hash and no hash at all
+    std::string content;
+    {
+        std::ifstream f(file);
+        std::stringstream stream;
+        stream << f.rdbuf();
+        content = stream.str();
+    }
+    content.resize(content.size() - 6);
+    content += "\nmodels\tmodels/bus.fbx\tnot a hash\nmodels\n";
+    std::ofstream(file, std::ofstream::trunc) << content;
+
+    std::string error;
+    try {manifest = readCookManifest(file);}
+    catch (const std::exception& e) {error = e.what();}
+    dirty = isCookPackDirty(manifest, "models", hashes, pack);
+    bool kept = manifest.contains("models") && (manifest.at("models").size() == 1) && (manifest.at("models").begin()->second == 0x12);
+    assertHelper(
+        "The manifest was read, the intact entry was kept and the pack is dirty",
+        (error.empty() ? std::string("The manifest was read") : "Reading the manifest failed: " + error) + 
+        (kept ? ", the intact entry was kept" : ", the intact entry was lost") + (dirty ? " and the pack is dirty" : " and the pack is up to date"),
+        error.empty() && kept && dirty, fn
+    );
+
+    std::filesystem::remove_all(root);
+
+    //success
+    report->result = TEST_SUCCESS;
+}
+
+std::vector<Test> tests {
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Job system test",
+            .tags = "job async core",
+            .description = "Test the functionality of the job system",
+            .timeout = uint64_t(1E4),
+            .requirements = TEST_REQUIREMENT_ASYNC_BIT
+        },
+        .invoker = &jobSystemTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Job stealing benchmark",
+            .tags = "job async core benchmark",
+            .description = "Time unbalanced work in the job system, idle workers have to steal it",
+            .timeout = uint64_t(1E4),
+            .requirements = TEST_REQUIREMENT_ASYNC_BIT
+        },
+        .invoker = &jobStealingBenchmark
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Job wait policy benchmark",
+            .tags = "job async core benchmark",
+            .description = "Compare the wake up latency and idle CPU usage of the job system wait policies",
+            .timeout = uint64_t(1E4),
+            .requirements = TEST_REQUIREMENT_ASYNC_BIT
+        },
+        .invoker = &jobWaitPolicyBenchmark
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Intrinsic reference counting test",
+            .tags = "reference_counting core",
+            .description = "Test the functionality of the intrinsic reference counting system",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &referenceCountingTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Event system test",
+            .tags = "events core",
+            .description = "Test that the event system works",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &eventSystemTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Keyboard and mouse test",
+            .tags = "keyboard mouse core",
+            .description = "Test that the abstract keyboard and mouse classes work",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &ioTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Task queue test",
+            .tags = "tasks async core",
+            .description = "Test if tasks can be executed through task queues",
+            .timeout = uint64_t(1E4),
+            .requirements = TEST_REQUIREMENT_ASYNC_BIT
+        },
+        .invoker = &taskTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Derived data cache test",
+            .tags = "assets core",
+            .description = "Test that cooked data is cached by content and corrupted entries are rejected",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &derivedDataCacheTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Asset dependency test",
+            .tags = "assets async core",
+            .description = "Test that asset dependencies are prefetched and cyclic dependencies between threads fail",
+            .timeout = uint64_t(1E4),
+            .requirements = TEST_REQUIREMENT_ASYNC_BIT
+        },
+        .invoker = &assetDependencyTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Compound asset index test",
+            .tags = "assets core",
+            .description = "Test that entries of nested compound assets are found through the flat path index",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &compoundAssetIndexTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "World bulk load test",
+            .tags = "world assets core",
+            .description = "Test that a world stored in the GLGE format is loaded with all objects, components and parents",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &worldBulkLoadTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "World columnar test",
+            .tags = "world assets core",
+            .description = "Test that a world stored in the memory mappable columnar format is loaded with all objects, components, parents and the sibling order",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &worldColumnarTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "World parallel serialization test",
+            .tags = "world assets core",
+            .description = "Test that storing and loading a world in batches on the employer is complete and deterministic",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &worldParallelSerializationTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "World delta test",
+            .tags = "world assets core",
+            .description = "Test that delta snapshots replay the changes since the last snapshot on a loaded world",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &worldDeltaTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Transform propagation test",
+            .tags = "world transform core",
+            .description = "Test that the transform propagator computes all world transforms, skips unchanged objects and follows hierarchy changes",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &transformPropagationTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Changed query test",
+            .tags = "world ecs core",
+            .description = "Test that changed-only queries visit exactly the chunks written to since a tick",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &changedQueryTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "System scheduler test",
+            .tags = "world systems core",
+            .description = "Test that the system scheduler orders conflicting systems, skips disabled ones and reports timings and exceptions",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &systemSchedulerTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Command buffer test",
+            .tags = "world ecs core",
+            .description = "Test that command buffers apply recorded structural changes in the documented order, including from parallel iterations",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &commandBufferTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Persistent query test",
+            .tags = "world ecs core",
+            .description = "Test that persistent queries keep their archtype matches up to date while the world changes",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &persistentQueryTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Sparse component test",
+            .tags = "world ecs core",
+            .description = "Test that sparse components filter queries without moving objects and are cleaned up on removal and destruction",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &sparseComponentTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Chunk arena test",
+            .tags = "world memory core",
+            .description = "Test that worlds allocate their chunks from an arena and report the chunk memory per archtype",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &chunkArenaTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "World compaction test",
+            .tags = "world memory core",
+            .description = "Test that time-sliced compaction releases all empty chunks while keeping object handles valid",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &worldCompactionTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Prefab test",
+            .tags = "world ecs core",
+            .description = "Test that prefabs spawn separate, correctly linked copies of an object subtree",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &prefabTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Spatial index test",
+            .tags = "world spatial core",
+            .description = "Test that radius and box queries of the spatial index stay correct while objects move, are removed and get large bounds",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &spatialIndexTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Hierarchy order test",
+            .tags = "world hierarchy core",
+            .description = "Test that the flattened hierarchy order stays consistent with the sibling links after re-parenting, creation and destruction",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &hierarchyOrderTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Transform compaction test",
+            .tags = "world transform memory core",
+            .description = "Test that the transform propagator re-reads the component storage after a world was compacted",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &transformCompactionTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Instance extension graph test",
+            .tags = "instance extension core",
+            .description = "Test that extensions update in attach order by default, follow their declared dependencies, report the critical path and reject unknown siblings and cycles",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &instanceExtensionGraphTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Cook manifest test",
+            .tags = "asset tools core",
+            .description = "Test that the asset cooker skips unchanged packs and cooks changed packs or packs with damaged manifest lines again",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &cookManifestTest
+    },
+    Test{
+        .header = {
+            .sType = TEST_TEST,
+            .pNext = nullptr
+        },
+        .entry = {
+            .header = {
+                .sType = TEST_ENTRY,
+                .pNext = nullptr
+            },
+            .name = "Compound asset dependency test",
+            .tags = "asset memory core",
+            .description = "Test that nested compound assets load through the dependency graph and that an asset manager waits for its prefetches when it is destroyed",
+            .timeout = uint64_t(1E4),
+            .requirements = 0
+        },
+        .invoker = &compoundAssetDependencyTest
     }
 };
 
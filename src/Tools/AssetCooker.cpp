@@ -0,0 +1,388 @@
+/**
+ * @file AssetCooker.cpp
+ * @author DM8AT
+ * @brief an offline tool that cooks a source asset tree into compound asset packs
+ *
+ * Usage: `AssetCooker <source directory> <output directory> [--force]`
+ *
+ * Every top level directory of the source tree becomes one pack (`<output>/<directory>.gcmp`), files directly in the source
+ * root go into a pack named after the source root. Sub-directories become nested compound assets and every file is stored
+ * under its name without extension, so `models/cars/truck.fbx` can be opened as `cars/truck` from `models.gcmp`.
+ *
+ * Meshes are imported using assimp (including LOD chain and BVH generation), images using stb.
+ *
+ * Cooking is incremental: `<output>/cook.manifest` stores a content hash per input, only packs with changed, added or removed
+ * inputs are rebuilt. Imports are additionally served from a derived data cache in `<output>/.ddc`, so rebuilding a pack only
+ * re-imports the inputs that actually changed.
+ *
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+//add the whole library
+#include "GLGE.h"
+//add the cook manifest
+#include "CookManifest.h"
+
+//add default I/O
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+//add containers
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @brief the version of the cooking pipeline
+ *
+ * Increment this whenever the produced output changes to force a full rebuild
+ */
+static constexpr GLGE::u32 COOK_VERSION = 1;
+
+/**
+ * @brief the kinds of inputs the cooker understands
+ */
+enum class InputKind : GLGE::u8 {
+    /**
+     * @brief a mesh imported using assimp
+     */
+    MESH,
+    /**
+     * @brief an image imported using stb
+     */
+    IMAGE
+};
+
+/**
+ * @brief a single source file to cook
+ */
+struct CookInput {
+    /**
+     * @brief the full path to the source file
+     */
+    std::filesystem::path source;
+    /**
+     * @brief the virtual path of the asset inside its pack (without extension)
+     */
+    std::filesystem::path virtualPath;
+    /**
+     * @brief the key used in the manifest (source path relative to the source root)
+     */
+    std::string manifestName;
+    /**
+     * @brief the name of the pack the input belongs to
+     */
+    std::string pack;
+    /**
+     * @brief the kind of the input
+     */
+    InputKind kind;
+    /**
+     * @brief the format used for importing
+     */
+    GLGE::u32 format;
+    /**
+     * @brief the content hash of the input (including importer and cooker version)
+     */
+    GLGE::u64 hash = 0;
+    /**
+     * @brief a handle to the mesh, if the input is a mesh
+     */
+    GLGE::AssetHandle<GLGE::MeshAsset> mesh;
+    /**
+     * @brief a handle to the image, if the input is an image
+     */
+    GLGE::AssetHandle<GLGE::Graphic::Asset::ImageCPU> image;
+    /**
+     * @brief the error message if cooking failed (empty on success)
+     */
+    std::string error;
+};
+
+/**
+ * @brief a pack of inputs that is written to a single compound asset file
+ */
+struct CookPack {
+    /**
+     * @brief the indices of all inputs of the pack
+     */
+    std::vector<size_t> inputs;
+    /**
+     * @brief the hashes of all inputs by manifest name
+     */
+    std::map<std::string, GLGE::u64> hashes;
+    /**
+     * @brief store if the pack needs to be rebuilt
+     */
+    bool dirty = false;
+    /**
+     * @brief the error message if writing the pack failed (empty on success)
+     */
+    std::string error;
+};
+
+/**
+ * @brief classify a file by its extension
+ *
+ * @param file the file to classify
+ * @param kind the kind of the file, written on success
+ * @param format the import format of the file, written on success
+ * @return `true` if the file can be cooked, `false` if it is ignored
+ */
+static bool classify(const std::filesystem::path& file, InputKind& kind, GLGE::u32& format) {
+    //compare case insensitive
+    std::string ext = file.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) {return static_cast<char>(std::tolower(c));});
+
+    //all mesh formats handled by assimp
+    static const std::set<std::string> meshExtensions = {
+        ".fbx", ".gltf", ".glb", ".obj", ".stl", ".ply", ".3mf", ".blend", ".3ds", ".ase", ".ac", ".ms3d",
+        ".md2", ".md3", ".md5mesh", ".psk", ".smd", ".vta", ".irrmesh", ".dae"
+    };
+    if (meshExtensions.contains(ext)) {
+        kind = InputKind::MESH;
+        format = GLGE::MeshAsset::ASSIMP;
+        return true;
+    }
+
+    //image formats handled by stb
+    using Image = GLGE::Graphic::Asset::ImageCPU;
+    static const std::map<std::string, GLGE::u32> imageExtensions = {
+        {".png", Image::PNG}, {".jpg", Image::JPG}, {".jpeg", Image::JPG}, {".tga", Image::TGA}, {".bmp", Image::BMP}, {".hdr", Image::HDR}
+    };
+    auto it = imageExtensions.find(ext);
+    if (it != imageExtensions.end()) {
+        kind = InputKind::IMAGE;
+        format = it->second;
+        return true;
+    }
+
+    //everything else is not an asset source
+    return false;
+}
+
+/**
+ * @brief import a single input
+ *
+ * @param instance the instance to import with
+ * @param input the input to import
+ */
+static void cookInput(GLGE::Instance& instance, CookInput& input) {
+    //the BVH generation needs an instance bound on the worker thread
+    if (GLGE::Instance::getCurrentInstance() != &instance)
+    {instance.bind();}
+
+    try {
+        if (input.kind == InputKind::MESH)
+        {input.mesh = instance.assets().load<GLGE::MeshAsset>(input.source, input.format);}
+        else
+        {input.image = instance.assets().load<GLGE::Graphic::Asset::ImageCPU>(input.source, input.format);}
+    } catch (const std::exception& e) {
+        input.error = e.what();
+    }
+}
+
+/**
+ * @brief assemble and write a single pack
+ *
+ * @param instance the instance to write with
+ * @param name the name of the pack
+ * @param pack the pack to write
+ * @param inputs all inputs
+ * @param output the output directory
+ */
+static void writePack(GLGE::Instance& instance, const std::string& name, CookPack& pack, std::vector<CookInput>& inputs, const std::filesystem::path& output) {
+    if (GLGE::Instance::getCurrentInstance() != &instance)
+    {instance.bind();}
+
+    try {
+        //create one (empty) compound asset per virtual directory
+        std::map<std::filesystem::path, GLGE::AssetHandle<GLGE::CompoundAsset>> directories;
+        auto getDirectory = [&](const std::filesystem::path& dir) -> GLGE::AssetHandle<GLGE::CompoundAsset>& {
+            auto it = directories.find(dir);
+            if (it == directories.end())
+            {it = directories.emplace(dir, instance.assets().load<GLGE::CompoundAsset>(std::filesystem::path(""))).first;}
+            return it->second;
+        };
+        getDirectory("");
+
+        //write all files to their directories
+        for (size_t idx : pack.inputs) {
+            CookInput& input = inputs[idx];
+            //make sure all parent directories exist
+            for (std::filesystem::path dir = input.virtualPath.parent_path(); !dir.empty(); dir = dir.parent_path())
+            {getDirectory(dir);}
+
+            auto& dir = getDirectory(input.virtualPath.parent_path());
+            std::filesystem::path file = input.virtualPath.filename();
+            if (dir.reference()->hasEntry(file)) {
+                std::stringstream stream;
+                stream << "Two inputs map to the virtual path " << input.virtualPath << ", skipping " << input.source;
+                throw GLGE::Exception(stream.str(), "AssetCooker::writePack");
+            }
+            if (input.kind == InputKind::MESH)
+            {dir.reference()->write(file, input.mesh);}
+            else
+            {dir.reference()->write(file, input.image);}
+        }
+
+        //write the directories into their parents, deepest first so every directory is complete when it is written
+        std::vector<std::filesystem::path> order;
+        for (const auto& [dir, _] : directories) {
+            if (!dir.empty()) {order.push_back(dir);}
+        }
+        std::sort(order.begin(), order.end(), [](const std::filesystem::path& a, const std::filesystem::path& b)
+        {return std::distance(a.begin(), a.end()) > std::distance(b.begin(), b.end());});
+        for (const std::filesystem::path& dir : order)
+        {getDirectory(dir.parent_path()).reference()->write(dir.filename(), directories.at(dir));}
+
+        //store the pack
+        getDirectory("").reference()->export_as(output / (name + ".gcmp"), GLGE::CompoundAsset::GLGE);
+    } catch (const std::exception& e) {
+        pack.error = e.what();
+    }
+}
+
+/**
+ * @brief the entry point of the cooker
+ *
+ * @param argc the amount of arguments
+ * @param argv the arguments
+ * @return `int` 0 on success, 1 if at least one input or pack failed, 2 on invalid usage
+ */
+int main(int argc, char** argv) {
+    //parse the arguments
+    std::vector<std::string> positional;
+    bool force = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--force") {force = true;}
+        else {positional.push_back(arg);}
+    }
+    if (positional.size() != 2) {
+        std::cerr << "Usage: AssetCooker <source directory> <output directory> [--force]\n";
+        return 2;
+    }
+    std::filesystem::path sourceRoot = std::filesystem::absolute(positional[0]).lexically_normal();
+    std::filesystem::path outputRoot = std::filesystem::absolute(positional[1]).lexically_normal();
+    if (!std::filesystem::is_directory(sourceRoot)) {
+        std::cerr << "Source directory " << sourceRoot << " does not exist\n";
+        return 2;
+    }
+    std::filesystem::create_directories(outputRoot);
+
+    //the root pack is named after the source directory
+    std::string rootPack = sourceRoot.has_filename() ? sourceRoot.filename().string() : sourceRoot.parent_path().filename().string();
+
+    //set up the engine
+    GLGE::Instance::init();
+    GLGE::Instance instance("GLGE Asset Cooker", GLGE::Version(0, 1, 0));
+    //unchanged inputs of rebuilt packs are served from the derived data cache
+    GLGE::DerivedDataCache::setDirectory(outputRoot / ".ddc");
+
+    //collect all inputs, sorted so the output is reproducible
+    std::vector<CookInput> inputs;
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(sourceRoot)) {
+        if (entry.is_regular_file()) {files.push_back(entry.path());}
+    }
+    std::sort(files.begin(), files.end());
+    for (const std::filesystem::path& file : files) {
+        CookInput input;
+        if (!classify(file, input.kind, input.format)) {continue;}
+        input.source = file;
+        std::filesystem::path relative = file.lexically_relative(sourceRoot);
+        input.manifestName = relative.generic_string();
+        //the first directory names the pack, root files go to the root pack
+        if (std::distance(relative.begin(), relative.end()) > 1) {
+            input.pack = relative.begin()->string();
+            relative = relative.lexically_relative(*relative.begin());
+        } else
+        {input.pack = rootPack;}
+        input.virtualPath = relative.parent_path() / relative.stem();
+        input.hash = GLGE::DerivedDataCache::computeKey(file, "GLGE::AssetCooker", (GLGE::u64(input.kind) << 32) | input.format, COOK_VERSION);
+        inputs.push_back(std::move(input));
+    }
+
+    //group the inputs into packs and compare them with the last cook
+    std::map<std::string, CookPack> packs;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        CookPack& pack = packs[inputs[i].pack];
+        pack.inputs.push_back(i);
+        pack.hashes[inputs[i].manifestName] = inputs[i].hash;
+    }
+    CookManifest manifest = readCookManifest(outputRoot / MANIFEST_NAME);
+    std::vector<std::string> dirtyPacks;
+    std::vector<size_t> dirtyInputs;
+    for (auto& [name, pack] : packs) {
+        pack.dirty = force || isCookPackDirty(manifest, name, pack.hashes, outputRoot / (name + ".gcmp"));
+        if (!pack.dirty) {continue;}
+        dirtyPacks.push_back(name);
+        dirtyInputs.insert(dirtyInputs.end(), pack.inputs.begin(), pack.inputs.end());
+    }
+    //packs that lost all their inputs are removed
+    for (const auto& [name, _] : manifest) {
+        if (!packs.contains(name)) {
+            std::error_code err;
+            std::filesystem::remove(outputRoot / (name + ".gcmp"), err);
+            std::cout << "Removed pack " << name << "\n";
+        }
+    }
+
+    std::cout << "Found " << inputs.size() << " inputs in " << packs.size() << " packs, " << dirtyPacks.size() << " packs need to be rebuilt\n";
+
+    //import all inputs of dirty packs in parallel
+    GLGE::Tiny::Jobs::Employer& employer = instance.employer();
+    if (!dirtyInputs.empty()) {
+        GLGE::Tiny::Jobs::BulkTask imports(dirtyInputs.size(), [&](size_t i) {cookInput(instance, inputs[dirtyInputs[i]]);});
+        employer.add_bulk(imports);
+        employer.waitIdle();
+    }
+
+    //packs with failed inputs are not written, they would be incomplete
+    bool failed = false;
+    std::vector<std::string> writablePacks;
+    for (const std::string& name : dirtyPacks) {
+        CookPack& pack = packs.at(name);
+        for (size_t idx : pack.inputs) {
+            if (inputs[idx].error.empty()) {continue;}
+            std::cerr << "Failed to cook " << inputs[idx].source << ": " << inputs[idx].error << "\n";
+            pack.error = "At least one input failed to cook";
+        }
+        if (pack.error.empty()) {writablePacks.push_back(name);}
+        else {failed = true;}
+    }
+
+    //assemble and compress all packs in parallel
+    if (!writablePacks.empty()) {
+        GLGE::Tiny::Jobs::BulkTask writes(writablePacks.size(), [&](size_t i) {
+            writePack(instance, writablePacks[i], packs.at(writablePacks[i]), inputs, outputRoot);
+        });
+        employer.add_bulk(writes);
+        employer.waitIdle();
+    }
+    for (const std::string& name : writablePacks) {
+        const CookPack& pack = packs.at(name);
+        if (pack.error.empty()) {std::cout << "Wrote pack " << name << " (" << pack.inputs.size() << " assets)\n";}
+        else {
+            std::cerr << "Failed to write pack " << name << ": " << pack.error << "\n";
+            failed = true;
+        }
+    }
+
+    //record the cooked state, failed packs are not recorded so they are rebuilt next time
+    CookManifest cooked;
+    for (const auto& [name, pack] : packs) {
+        if (pack.error.empty()) {cooked.emplace(name, pack.hashes);}
+    }
+    writeCookManifest(outputRoot / MANIFEST_NAME, cooked);
+    std::cout << "Derived data cache: " << GLGE::DerivedDataCache::getHitCount() << " hits, " << GLGE::DerivedDataCache::getMissCount() << " misses\n";
+
+    return failed ? 1 : 0;
+}
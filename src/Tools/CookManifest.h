@@ -0,0 +1,117 @@
+/**
+ * @file CookManifest.h
+ * @author DM8AT
+ * @brief the manifest the asset cooker uses to detect which packs need to be rebuilt
+ *
+ * The manifest stores one line per input in the form "pack \t input \t hash", with the hash written as 16 hex digits. A
+ * manifest that can't be read (missing, different version, truncated or edited by hand) never stops the cooker, every
+ * entry that can't be parsed is treated as missing so the pack it belongs to is cooked again.
+ *
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef _GLGE_TOOLS_COOK_MANIFEST_
+#define _GLGE_TOOLS_COOK_MANIFEST_
+
+//add the whole library
+#include "GLGE.h"
+
+//add file I/O
+#include <fstream>
+#include <iomanip>
+#include <filesystem>
+//add containers
+#include <map>
+#include <string>
+//add number parsing
+#include <charconv>
+
+/**
+ * @brief the name of the manifest file in the output directory
+ */
+static constexpr const char* MANIFEST_NAME = "cook.manifest";
+
+/**
+ * @brief the header line of the manifest file
+ */
+static constexpr const char* MANIFEST_HEADER = "GLGE_COOK_MANIFEST 1";
+
+/**
+ * @brief the content hashes of all inputs by manifest name, grouped by the name of their pack
+ */
+using CookManifest = std::map<std::string, std::map<std::string, GLGE::u64>>;
+
+/**
+ * @brief read the manifest of the last cook
+ *
+ * Lines that can't be parsed are skipped, so the packs they belong to don't match their inputs anymore and are rebuilt.
+ *
+ * @param file the path to the manifest
+ * @return `CookManifest` the input hashes per pack
+ */
+inline CookManifest readCookManifest(const std::filesystem::path& file) {
+    CookManifest manifest;
+    std::ifstream f(file);
+    if (!f.is_open()) {return manifest;}
+
+    //a different header means a different manifest version, so everything is rebuilt
+    std::string line;
+    if (!std::getline(f, line) || line != MANIFEST_HEADER) {return manifest;}
+
+    //each line is "pack \t input \t hash"
+    while (std::getline(f, line)) {
+        size_t first = line.find('\t');
+        size_t second = line.rfind('\t');
+        if (first == std::string::npos || first == second) {continue;}
+
+        //the hash must be exactly the 16 hex digits that were written, anything else is a damaged entry
+        const char* begin = line.data() + second + 1;
+        const char* end = line.data() + line.size();
+        GLGE::u64 hash = 0;
+        auto [ptr, err] = std::from_chars(begin, end, hash, 16);
+        if ((err != std::errc()) || (ptr != end) || ((end - begin) != 16)) {continue;}
+
+        manifest[line.substr(0, first)][line.substr(first + 1, second - first - 1)] = hash;
+    }
+    return manifest;
+}
+
+/**
+ * @brief write the manifest of the current cook
+ *
+ * @param file the path to the manifest
+ * @param manifest the input hashes of all packs that are up to date
+ */
+inline void writeCookManifest(const std::filesystem::path& file, const CookManifest& manifest) {
+    //write to a temporary first so an interrupted cook never leaves a broken manifest behind
+    std::filesystem::path tmp = file;
+    tmp += ".tmp";
+    {
+        std::ofstream f(tmp, std::ofstream::trunc);
+        f << MANIFEST_HEADER << "\n";
+        for (const auto& [name, hashes] : manifest) {
+            for (const auto& [input, hash] : hashes)
+            {f << name << "\t" << input << "\t" << std::hex << std::setw(16) << std::setfill('0') << hash << std::dec << "\n";}
+        }
+    }
+    std::filesystem::rename(tmp, file);
+}
+
+/**
+ * @brief check if a pack has to be rebuilt
+ *
+ * @param manifest the manifest of the last cook
+ * @param name the name of the pack
+ * @param hashes the current hashes of all inputs of the pack
+ * @param packFile the path to the cooked pack
+ * @return `true` if an input was added, removed, changed or damaged in the manifest or the pack is missing, `false` otherwise
+ */
+inline bool isCookPackDirty(const CookManifest& manifest, const std::string& name, const std::map<std::string, GLGE::u64>& hashes, const std::filesystem::path& packFile) {
+    auto it = manifest.find(name);
+    return (it == manifest.end()) || (it->second != hashes) || !std::filesystem::exists(packFile);
+}
+
+#endif